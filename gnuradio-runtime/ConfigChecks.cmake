@@ -121,3 +121,19 @@ CHECK_CXX_SOURCE_COMPILES("
     " HAVE_MMAP
 )
 GR_ADD_COND_DEF(HAVE_MMAP)
+
+########################################################################
+CHECK_CXX_SOURCE_COMPILES("
+    #include <sys/mman.h>
+    int main(){mlockall(MCL_CURRENT | MCL_FUTURE); return 0;}
+    " HAVE_MLOCKALL
+)
+GR_ADD_COND_DEF(HAVE_MLOCKALL)
+
+########################################################################
+CHECK_CXX_SOURCE_COMPILES("
+    #include <sys/resource.h>
+    int main(){struct rusage usage; getrusage(RUSAGE_THREAD, &usage); return 0;}
+    " HAVE_RUSAGE_THREAD
+)
+GR_ADD_COND_DEF(HAVE_RUSAGE_THREAD)
@@ -137,6 +137,17 @@ public:
      */
     bool fixed_rate() const { return d_fixed_rate; }
 
+    /*!
+     * \brief Return true if the block needs about
+     * fixed_rate_noutput_to_ninput(noutput_items) items on every input.
+     *
+     * Set by the gr::sync_block constructor. When an input falls short,
+     * the scheduler then asks once for the output that the input with
+     * the fewest items allows, instead of halving the request until it
+     * fits. forecast() is still called to check every request.
+     */
+    bool fixed_rate_forecast() const { return d_fixed_rate_forecast; }
+
     // ----------------------------------------------------------------
     //		override these to define your behavior
     // ----------------------------------------------------------------
@@ -791,6 +802,7 @@ private:
     unsigned d_history;
     unsigned d_attr_delay; // the block's sample delay
     bool d_fixed_rate;
+    bool d_fixed_rate_forecast;
     bool d_max_noutput_items_set; // if d_max_noutput_items is valid
     int d_max_noutput_items;      // value of max_noutput_items for this block
     int d_min_noutput_items;
@@ -810,6 +822,11 @@ protected:
 
     void set_fixed_rate(bool fixed_rate) { d_fixed_rate = fixed_rate; }
 
+    void set_fixed_rate_forecast(bool fixed_rate_forecast)
+    {
+        d_fixed_rate_forecast = fixed_rate_forecast;
+    }
+
     /*!
      * \brief  Adds a new tag onto the given output buffer.
      *
@@ -959,6 +976,55 @@ protected:
                             uint64_t rel_end,
                             const pmt::pmt_t& key);
 
+    /*!
+     * \brief Calls \p visitor with the tags of key \p key in a [start,end)
+     * range, in order of offset, without copying them.
+     *
+     * \details
+     * Finds the tags gr::block::get_tags_in_range would return for \p
+     * key, through an index of the tags by key instead of searching all
+     * tags in the range. Returning false from the visitor ends the
+     * lookup, e.g. once the first tag was found:
+     *
+     * \code
+     * uint64_t first = end;
+     * visit_tags_in_range(0, start, end, key, [&first](const tag_t& tag) {
+     *     first = tag.offset;
+     *     return false;
+     * });
+     * \endcode
+     *
+     * The visitor is called with the lock of the input buffer held. It
+     * must not add or remove tags and must copy what it keeps of them.
+     *
+     * \param which_input  an integer of which input stream to pull from
+     * \param abs_start    a uint64 count of the start of the range of interest
+     * \param abs_end      a uint64 count of the end of the range of interest
+     * \param key          a PMT symbol key to filter only tags of this key
+     * \param visitor      called with each tag; returns false to stop
+     */
+    void visit_tags_in_range(unsigned int which_input,
+                             uint64_t abs_start,
+                             uint64_t abs_end,
+                             const pmt::pmt_t& key,
+                             const tag_visitor& visitor);
+
+    /*!
+     * \brief Operates like gr::block::visit_tags_in_range within the
+     * current window of items, like gr::block::get_tags_in_window.
+     *
+     * \param which_input  an integer of which input stream to pull from
+     * \param rel_start    a uint64 count of the start of the range of interest
+     * \param rel_end      a uint64 count of the end of the range of interest
+     * \param key          a PMT symbol key to filter only tags of this key
+     * \param visitor      called with each tag; returns false to stop
+     */
+    void visit_tags_in_window(unsigned int which_input,
+                              uint64_t rel_start,
+                              uint64_t rel_end,
+                              const pmt::pmt_t& key,
+                              const tag_visitor& visitor);
+
     void enable_update_rate(bool en);
 
     /*!
@@ -147,10 +147,7 @@ public:
      * \brief Given a [start,end), returns a vector of all tags in the
      * range with a given key.
      *
-     * Calls get_tags_in_range(which_input, abs_start, abs_end) to get
-     * a vector of tags from the buffers. This function then provides
-     * a secondary filter to the tags to extract only tags with the
-     * given 'key'.
+     * Collects the tags visit_tags_in_range() finds.
      *
      * Tags are tuples of:
      *      (item count, source id, key, value)
@@ -169,6 +166,26 @@ public:
                            const pmt::pmt_t& key,
                            long id);
 
+    /*!
+     * \brief Calls \p visitor with the tags of a given key in a
+     * [start,end) range, without copying them.
+     *
+     * Pass-through function to gr::buffer_reader::visit_tags_in_range().
+     *
+     * \param which_input  an integer of which input stream to pull from
+     * \param abs_start    a uint64 count of the start of the range of interest
+     * \param abs_end      a uint64 count of the end of the range of interest
+     * \param key          a PMT symbol to select only tags of this key
+     * \param id           Block ID
+     * \param visitor      called with each tag; returns false to stop
+     */
+    void visit_tags_in_range(unsigned int which_input,
+                             uint64_t abs_start,
+                             uint64_t abs_end,
+                             const pmt::pmt_t& key,
+                             long id,
+                             const tag_visitor& visitor);
+
     /*!
      * \brief Set core affinity of block to the cores in the vector
      * mask.
@@ -47,7 +47,7 @@ private:
     typedef std::map<std::string, blocksubmap_t> blockmap_t;
 
     blockmap_t d_map;
-    pmt::pmt_t d_ref_map;
+    std::map<std::string, basic_block*> d_ref_map;
     std::map<std::string, block*> primitive_map;
     gr::thread::mutex d_mutex;
 };
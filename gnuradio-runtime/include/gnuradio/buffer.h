@@ -23,6 +23,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 
 namespace gr {
@@ -126,10 +127,14 @@ public:
 
     uint64_t nitems_written() { return d_abs_write_offset; }
 
-    void reset_nitem_counter()
+    /*!
+     * \brief Restart writing at the start of the buffer, counting the
+     * items written from \p nitems_written on.
+     */
+    void reset_nitem_counter(uint64_t nitems_written = 0)
     {
         d_write_index = 0;
-        d_abs_write_offset = 0;
+        d_abs_write_offset = nitems_written;
     }
 
     size_t get_sizeof_item() { return d_sizeof_item; }
@@ -151,6 +156,19 @@ public:
      */
     void add_item_tag(const tag_t& tag);
 
+    /*!
+     * \brief  Adds tags propagated from upstream to the buffer.
+     *
+     * The tags are only queued under the buffer's lock. They are
+     * inserted into the buffer's tag lookup structures when the tags of
+     * the buffer are first looked up, or dropped on pruning if no
+     * reader ever looks at them. Tags at the same offset keep the order
+     * they were added in, as with add_item_tag().
+     *
+     * \param tags       the new tags
+     */
+    void add_item_tags(const std::vector<tag_t>& tags);
+
     /*!
      * \brief  Removes an existing tag from the buffer.
      *
@@ -174,18 +192,38 @@ public:
 
     std::multimap<uint64_t, tag_t>::iterator get_tags_begin()
     {
+        materialize_tags();
         return d_item_tags.begin();
     }
-    std::multimap<uint64_t, tag_t>::iterator get_tags_end() { return d_item_tags.end(); }
+    std::multimap<uint64_t, tag_t>::iterator get_tags_end()
+    {
+        materialize_tags();
+        return d_item_tags.end();
+    }
     std::multimap<uint64_t, tag_t>::iterator get_tags_lower_bound(uint64_t x)
     {
+        materialize_tags();
         return d_item_tags.lower_bound(x);
     }
     std::multimap<uint64_t, tag_t>::iterator get_tags_upper_bound(uint64_t x)
     {
+        materialize_tags();
         return d_item_tags.upper_bound(x);
     }
 
+    /*!
+     * \brief Calls \p visitor with the tags of key \p key at offsets from
+     * \p lower to \p upper inclusive, until it returns false.
+     *
+     * Tags with a symbol key are looked up in an index by key, others
+     * are searched for among all tags in the range. The caller must
+     * hold the buffer's mutex.
+     */
+    void visit_tags(const pmt::pmt_t& key,
+                    uint64_t lower,
+                    uint64_t upper,
+                    const tag_visitor& visitor);
+
     /*!
      * \brief Function to be executed after this object's owner completes the
      * call to general_work()
@@ -319,6 +357,12 @@ protected:
     uint64_t d_abs_write_offset; // num items written since the start
     bool d_done;
     std::multimap<uint64_t, tag_t> d_item_tags;
+    // d_item_tags by (interned) key symbol, in order of offset
+    std::unordered_map<const pmt::pmt_base*,
+                       std::multimap<uint64_t, std::multimap<uint64_t, tag_t>::iterator>>
+        d_item_tags_by_key;
+    // tags from add_item_tags() not yet in d_item_tags, in order added
+    std::vector<tag_t> d_pending_tags;
     uint64_t d_last_min_items_read;
     //
     gr::thread::condition_variable d_cv;
@@ -343,6 +387,21 @@ protected:
 
     virtual bool allocate_buffer([[maybe_unused]] int nitems) { return false; };
 
+    //! Inserts \p tag into d_item_tags and d_item_tags_by_key
+    void insert_tag(const tag_t& tag);
+
+    //! Removes the tag at \p itr from d_item_tags_by_key
+    void unindex_tag(std::multimap<uint64_t, tag_t>::iterator itr);
+
+    //! Moves d_pending_tags into d_item_tags; the caller holds the mutex
+    void materialize_tags()
+    {
+        if (!d_pending_tags.empty()) {
+            insert_pending_tags();
+        }
+    }
+    void insert_pending_tags();
+
     /*!
      * \brief constructor is private.  Use gr_make_buffer to create instances.
      *
@@ -139,6 +139,28 @@ public:
                            uint64_t abs_end,
                            long id);
 
+    /*!
+     * \brief Calls \p visitor with the tags of key \p key in [start,end),
+     * without copying them.
+     *
+     * The tags are the ones get_tags_in_range() returns, in order of
+     * offset; the visitor ends the lookup by returning false. It is
+     * called with the buffer's mutex held, so it must not add or remove
+     * tags, nor keep references to them.
+     *
+     * \param abs_start    a uint64 count of the start of the range of interest
+     * \param abs_end      a uint64 count of the end of the range of interest
+     * \param key          a PMT symbol to select only tags of this key
+     * \param id           the unique ID of the block to make sure already deleted tags
+     * are not visited
+     * \param visitor      called with each tag
+     */
+    void visit_tags_in_range(uint64_t abs_start,
+                             uint64_t abs_end,
+                             const pmt::pmt_t& key,
+                             long id,
+                             const tag_visitor& visitor);
+
     /*!
      * \brief Returns true when the current thread is ready to call the callback,
      * false otherwise. Delegate calls to buffer class's input_blkd_cb_ready().
@@ -0,0 +1,205 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_BUFFER_SHM_H
+#define INCLUDED_GR_RUNTIME_BUFFER_SHM_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/buffer.h>
+#include <gnuradio/buffer_type.h>
+#include <gnuradio/logger.h>
+#include <gnuradio/tags.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gr {
+
+/*!
+ * \brief Buffer in a named shared-memory ring, for passing a stream to
+ * another process without copying.
+ * \ingroup internal
+ *
+ * \details
+ * The items live in a POSIX shared-memory segment that both processes
+ * map. In the producing process the buffer replaces the output buffer
+ * of the block feeding the shm_sink; in the consuming process it is
+ * the output buffer of the shm_source. Both are mapped onto the same
+ * ring, so the items written upstream of the sink are read in place
+ * downstream of the source.
+ *
+ * The number of items published by the producer and released by the
+ * consumer are kept in the segment, next to a ring of serialized
+ * tags. The producer never gets ahead of the consumer by more than the
+ * ring holds, and a consumer that is restarted resumes at the first
+ * item it had not read.
+ *
+ * The block owning the buffer names the segment by implementing
+ * buffer_shm::owner.
+ */
+class GR_RUNTIME_API buffer_shm : public buffer
+{
+public:
+    /*!
+     * \brief Interface of the blocks that own a buffer_shm.
+     */
+    class GR_RUNTIME_API owner
+    {
+    public:
+        virtual ~owner();
+
+        //! Name of the shared-memory segment.
+        virtual std::string shm_name() const = 0;
+    };
+
+    static buffer_type type;
+
+    static buffer_sptr make_buffer(int nitems,
+                                   size_t sizeof_item,
+                                   uint64_t downstream_lcm_nitems,
+                                   uint32_t downstream_max_out_mult,
+                                   block_sptr link = block_sptr(),
+                                   block_sptr buf_owner = block_sptr());
+
+    ~buffer_shm() override;
+
+    int space_available() override;
+
+    void post_work([[maybe_unused]] int nitems) override {}
+
+    /*!
+     * \brief Start producing into the ring.
+     *
+     * Lines the write index up with the items published so far. Items a
+     * consumer that is still running has not read yet are waited for,
+     * those of a consumer that is gone are dropped.
+     */
+    void attach_producer();
+
+    /*!
+     * \brief Start consuming from the ring, at the first item not
+     * released yet.
+     */
+    void attach_consumer();
+
+    /*!
+     * \brief Stop producing; \p eof tells the consumer that no more
+     * items follow.
+     */
+    void detach_producer(bool eof);
+
+    //! Stop consuming.
+    void detach_consumer();
+
+    //! Ring position of the item with nitems_written() == 0.
+    uint64_t offset() const { return d_offset; }
+
+    //! Items published by the producer, in ring positions.
+    uint64_t published() const;
+
+    //! Items released by the consumer, in ring positions.
+    uint64_t released() const;
+
+    //! True if the producer ended the stream at published().
+    bool eof() const;
+
+    void publish(uint64_t nitems);
+
+    /*!
+     * \brief Release the items before \p nitems, after the items before
+     * \p nread were read; the others are kept as history. Neither
+     * position ever moves backwards.
+     */
+    void release(uint64_t nitems, uint64_t nread);
+
+    /*!
+     * \brief Sequence number bumped by every publish and release.
+     *
+     * Pass it to wait() to sleep until the other side made progress.
+     */
+    uint32_t sequence() const;
+
+    /*!
+     * \brief Wait until sequence() differs from \p seq or \p timeout_us
+     * passed. An interruption point.
+     */
+    void wait(uint32_t seq, int timeout_us);
+
+    /*!
+     * \brief Hand tags to the consumer, with offsets in ring positions.
+     * \returns the number of tags that did not fit into the tag ring.
+     */
+    size_t push_tags(const std::vector<tag_t>& tags);
+
+    /*!
+     * \brief Take the tags with ring offsets before \p end.
+     *
+     * Tags before \p start were published for items the consumer
+     * never produced and are skipped. The tags stay in the segment until
+     * their items were read.
+     */
+    void pop_tags(uint64_t start, uint64_t end, std::vector<tag_t>& tags);
+
+protected:
+    bool allocate_buffer(int nitems) override;
+
+    unsigned index_add(unsigned a, unsigned b) override
+    {
+        unsigned s = a + b;
+
+        if (s >= d_bufsize)
+            s -= d_bufsize;
+
+        return s;
+    }
+
+    unsigned index_sub(unsigned a, unsigned b) override
+    {
+        int s = a - b;
+
+        if (s < 0)
+            s += d_bufsize;
+
+        return s;
+    }
+
+private:
+    struct header;
+    struct tag_slot;
+
+    std::string d_name;
+    header* d_header;
+    size_t d_header_size;
+    char* d_ring;
+    size_t d_ring_size;
+    uint64_t d_offset;
+    bool d_attached;
+    uint64_t d_position;
+    uint64_t d_tags_next;
+
+    gr::logger_ptr d_logger;
+    gr::logger_ptr d_debug_logger;
+
+    buffer_shm(const std::string& name,
+               int nitems,
+               size_t sizeof_item,
+               uint64_t downstream_lcm_nitems,
+               uint32_t downstream_max_out_mult,
+               block_sptr link);
+
+    void attach(uint64_t position);
+    void detach();
+    bool consumer_gone() const;
+    void unmap();
+};
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_BUFFER_SHM_H */
@@ -14,6 +14,7 @@
 #include <gnuradio/api.h>
 #include <gnuradio/basic_block.h>
 #include <gnuradio/io_signature.h>
+#include <unordered_map>
 
 namespace gr {
 
@@ -259,9 +260,31 @@ protected:
     basic_block_vector_t calc_downstream_blocks(basic_block_sptr block, int port);
     edge_vector_t calc_upstream_edges(basic_block_sptr block);
     bool has_block_p(basic_block_sptr block);
+    bool has_edge_p(const edge& e) const;
     edge calc_upstream_edge(basic_block_sptr block, int port);
 
 private:
+    /*
+     * Indices of d_edges, so that the queries of a block's connections
+     * do not scan all edges: the edges into and out of each block, in
+     * the order of d_edges, and the source feeding each destination.
+     */
+    struct endpoint_hash {
+        size_t operator()(const endpoint& e) const
+        {
+            return std::hash<basic_block*>()(e.block().get()) * 31 +
+                   static_cast<size_t>(e.port());
+        }
+    };
+    struct block_edges {
+        edge_vector_t in;
+        edge_vector_t out;
+    };
+    std::unordered_map<basic_block_sptr, block_edges> d_block_edges;
+    std::unordered_map<endpoint, endpoint, endpoint_hash> d_upstream;
+
+    const block_edges& find_block_edges(const basic_block_sptr& block) const;
+
     void check_valid_port(gr::io_signature::sptr sig, int port);
     void check_valid_port(const msg_endpoint& e);
     void check_dst_not_used(const endpoint& dst);
@@ -273,11 +296,8 @@ private:
                           bool check_inputs);
 
     basic_block_vector_t calc_downstream_blocks(basic_block_sptr block);
-    basic_block_vector_t calc_reachable_blocks(basic_block_sptr block,
-                                               basic_block_vector_t& blocks);
     void reachable_dfs_visit(basic_block_sptr block, basic_block_vector_t& blocks);
-    basic_block_vector_t calc_adjacent_blocks(basic_block_sptr block,
-                                              basic_block_vector_t& blocks);
+    basic_block_vector_t calc_adjacent_blocks(basic_block_sptr block);
     basic_block_vector_t sort_sources_first(basic_block_vector_t& blocks);
     bool source_p(basic_block_sptr block);
     void topological_dfs_visit(basic_block_sptr block, basic_block_vector_t& output);
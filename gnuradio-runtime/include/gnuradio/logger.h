@@ -47,6 +47,8 @@ using logger_ptr = std::shared_ptr<void>;
 namespace gr {
 using log_level = spdlog::level::level_enum;
 
+class async_log_sink;
+
 class GR_RUNTIME_API logging
 {
 public:
@@ -73,6 +75,7 @@ public:
     //! \brief set the debug logging level
     void set_debug_level(log_level level);
 
+    //! \brief the sink all loggers write to
     spdlog::sink_ptr default_backend() const;
     //! \brief adds a logging sink
     void add_default_sink(const spdlog::sink_ptr& sink);
@@ -83,11 +86,36 @@ public:
     //! \brief add a default-constructed console sink to the debugging logger
     void add_debug_console_sink();
 
+    /*!
+     * \brief queue log records for a background thread to write
+     *
+     * Asynchronously, a logging thread only copies the formatted record
+     * into a lock-free queue of its own; records that find it full are
+     * dropped. Disabling writes the records still queued.
+     */
+    void set_async(bool enabled);
+
+    //! \brief whether log records are written by a background thread
+    bool is_async() const;
+
+    /*!
+     * \brief limit the records each call site of the gr::logger methods
+     * and GR_LOG macros may log per second and logger; 0 for no limit
+     */
+    void set_rate_limit(unsigned int records_per_second);
+
+    //! \brief number of records dropped by the rate limit or full queues
+    uint64_t dropped_records() const;
+
+    //! \brief whether the rate limit lets a record of \p logger at call site \p site pass
+    bool admit(const void* site, const void* logger);
+
     static constexpr const char* default_pattern = "%n :%l: %v";
 
 private:
     logging();
     std::shared_ptr<spdlog::sinks::dist_sink_mt> _default_backend, _debug_backend;
+    std::shared_ptr<async_log_sink> _front;
 };
 
 /*!
@@ -172,77 +200,100 @@ public:
     template <typename... Args>
     inline void trace(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->trace(msg, std::forward<Args>(args)...);
+        log(spdlog::level::trace, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for DEBUG message */
     template <typename... Args>
     inline void debug(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->debug(msg, std::forward<Args>(args)...);
+        log(spdlog::level::debug, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for INFO message */
     template <typename... Args>
     inline void info(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->info(msg, std::forward<Args>(args)...);
+        log(spdlog::level::info, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for INFO message, DEPRECATED */
     template <typename... Args>
     inline void notice(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->info(msg, std::forward<Args>(args)...);
+        log(spdlog::level::info, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for WARN message */
     template <typename... Args>
     inline void warn(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->warn(msg, std::forward<Args>(args)...);
+        log(spdlog::level::warn, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for ERROR message */
     template <typename... Args>
     inline void error(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->error(msg, std::forward<Args>(args)...);
+        log(spdlog::level::err, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for CRITICAL message */
     template <typename... Args>
     inline void crit(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->critical(msg, std::forward<Args>(args)...);
+        log(spdlog::level::critical, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for CRITICAL message, DEPRECATED */
     template <typename... Args>
     inline void alert(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->critical(msg, std::forward<Args>(args)...);
+        log(spdlog::level::critical, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for CRITICAL message, DEPRECATED */
     template <typename... Args>
     inline void fatal(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->critical(msg, std::forward<Args>(args)...);
+        log(spdlog::level::critical, msg, std::forward<Args>(args)...);
     }
 
     /*! \brief inline function, wrapper for CRITICAL message, DEPRECATED */
     template <typename... Args>
     inline void emerg(format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->critical(msg, std::forward<Args>(args)...);
+        log(spdlog::level::critical, msg, std::forward<Args>(args)...);
     }
-    /*! \brief inline function, wrapper for logging with ad-hoc adjustable level*/
+    /*!
+     * \brief inline function, wrapper for logging with ad-hoc adjustable level
+     *
+     * Records below the level of the logger are not formatted, nor are
+     * those the rate limit of gr::logging drops. The format string
+     * identifies the call site, which is limited separately for each
+     * logger.
+     */
     template <typename... Args>
     inline void
     log(spdlog::level::level_enum level, format_string_t<Args...> msg, Args&&... args)
     {
-        d_logger->log(level, msg, std::forward<Args>(args)...);
+        if (d_logger->should_log(level) &&
+            logging::singleton().admit(spdlog::string_view_t(msg).data(), this)) {
+            d_logger->log(level, msg, std::forward<Args>(args)...);
+        }
+    }
+
+    /*!
+     * \brief log \p msg as it is, rate limited as call site \p site
+     *
+     * Used by the GR_LOG macros, each of which passes a site of its own.
+     */
+    template <typename T>
+    inline void log_from(const void* site, spdlog::level::level_enum level, const T& msg)
+    {
+        if (d_logger->should_log(level) && logging::singleton().admit(site, this)) {
+            d_logger->log(level, msg);
+        }
     }
 };
 using logger_ptr = std::shared_ptr<logger>;
@@ -262,56 +313,33 @@ configure_default_loggers(gr::logger_ptr& l, gr::logger_ptr& d, const std::strin
 
 // global logging shorthands
 
-#define GR_LOG_TRACE(log, msg)     \
-    {                              \
-        log->d_logger->trace(msg); \
+// The address of a static in each expansion identifies the call site
+// for the rate limit of gr::logging.
+#define GR_LOG_AT(log, level, msg)               \
+    {                                            \
+        static const char gr_log_site = 0;       \
+        log->log_from(&gr_log_site, level, msg); \
     }
 
-#define GR_LOG_DEBUG(log, msg)     \
-    {                              \
-        log->d_logger->debug(msg); \
-    }
+#define GR_LOG_TRACE(log, msg) GR_LOG_AT(log, spdlog::level::trace, msg)
 
-#define GR_LOG_INFO(log, msg)     \
-    {                             \
-        log->d_logger->info(msg); \
-    }
+#define GR_LOG_DEBUG(log, msg) GR_LOG_AT(log, spdlog::level::debug, msg)
 
-#define GR_LOG_NOTICE(log, msg)   \
-    {                             \
-        log->d_logger->info(msg); \
-    }
+#define GR_LOG_INFO(log, msg) GR_LOG_AT(log, spdlog::level::info, msg)
 
+#define GR_LOG_NOTICE(log, msg) GR_LOG_AT(log, spdlog::level::info, msg)
 
-#define GR_LOG_WARN(log, msg)     \
-    {                             \
-        log->d_logger->warn(msg); \
-    }
+#define GR_LOG_WARN(log, msg) GR_LOG_AT(log, spdlog::level::warn, msg)
 
-#define GR_LOG_ERROR(log, msg)     \
-    {                              \
-        log->d_logger->error(msg); \
-    }
+#define GR_LOG_ERROR(log, msg) GR_LOG_AT(log, spdlog::level::err, msg)
 
-#define GR_LOG_CRIT(log, msg)         \
-    {                                 \
-        log->d_logger->critical(msg); \
-    }
+#define GR_LOG_CRIT(log, msg) GR_LOG_AT(log, spdlog::level::critical, msg)
 
-#define GR_LOG_ALERT(log, msg)        \
-    {                                 \
-        log->d_logger->critical(msg); \
-    }
+#define GR_LOG_ALERT(log, msg) GR_LOG_AT(log, spdlog::level::critical, msg)
 
-#define GR_LOG_FATAL(log, msg)        \
-    {                                 \
-        log->d_logger->critical(msg); \
-    }
+#define GR_LOG_FATAL(log, msg) GR_LOG_AT(log, spdlog::level::critical, msg)
 
-#define GR_LOG_EMERG(log, msg)        \
-    {                                 \
-        log->d_logger->critical(msg); \
-    }
+#define GR_LOG_EMERG(log, msg) GR_LOG_AT(log, spdlog::level::critical, msg)
 
 #endif
 
@@ -31,6 +31,7 @@
 
 #define GR_M_PI 3.14159265358979323846    /* pi */
 #define GR_M_SQRT2 1.41421356237309504880 /* sqrt(2) */
+#define GR_M_LN2 0.69314718055994530942   /* log_e(2) */
 
 
 namespace gr {
@@ -75,6 +75,9 @@ protected:
         d_uniform; // choose uniform distribution, default is [0,1)
     std::uniform_int_distribution<int64_t> d_integer_dis;
 
+    // interleaved XOROSHIRO128+ streams used by the fill_* functions
+    uint64_t d_lanes[2 * XOROSHIRO128P_LANES];
+
 public:
     random(uint64_t seed = 0, int64_t min_integer = 0, int64_t max_integer = 2);
     ~random();
@@ -132,6 +135,34 @@ public:
      * an uniform distribution for the phase.
      */
     gr_complex rayleigh_complex();
+
+    /*!
+     * \brief Fill \p out with \p n uniform random numbers in the range [0.0, 1.0)
+     *
+     * The fill_* functions draw from XOROSHIRO128P_LANES interleaved streams that are
+     * independent of the ones used by the single-value functions above, and transform
+     * whole blocks of variates at once. They are the preferred way to generate noise
+     * for entire buffers.
+     */
+    void fill_uniform(float* out, size_t n);
+
+    /*!
+     * \brief Fill \p out with \p n normally distributed random numbers with zero mean
+     * and variance 1 (Box-Muller transform)
+     */
+    void fill_gaussian(float* out, size_t n);
+
+    /*!
+     * \brief Fill \p out with \p n complex random numbers with zero mean and
+     * variance 1 on real and imaginary part, like rayleigh_complex()
+     */
+    void fill_gaussian(gr_complex* out, size_t n);
+
+    /*!
+     * \brief Fill \p out with \p n Laplacian distributed random numbers, with the
+     * same distribution as laplacian()
+     */
+    void fill_laplacian(float* out, size_t n);
 };
 
 } /* namespace gr */
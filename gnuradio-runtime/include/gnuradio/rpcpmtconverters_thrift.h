@@ -12,7 +12,9 @@
 
 #include "thrift/gnuradio_types.h"
 #include <pmt/pmt.h>
+#include <cstdint>
 #include <map>
+#include <string>
 
 
 namespace rpcpmtconverter {
@@ -92,6 +94,40 @@ template <typename TO_PMT_F>
 struct to_pmt_reg {
     to_pmt_reg(To_PMT& instance, const GNURadio::BaseTypes::type type);
 };
+
+/*!
+ * \brief Builds the frames pushed to StreamReceiver subscribers, in
+ * the compact format described in gnuradio.thrift.
+ *
+ * Values are encoded straight from their PMT, without going through
+ * GNURadio::Knob. The buffer is reused between frames.
+ */
+class snapshot_writer
+{
+public:
+    enum kind_t { LAYOUT = 0, VALUES = 1 };
+
+    //! Type code of values that cannot be encoded.
+    static constexpr uint8_t UNSUPPORTED = 0xff;
+
+    //! Start a new frame of \p count names or values.
+    void begin(kind_t kind,
+               int32_t subscription,
+               uint32_t sequence,
+               int64_t time_ns,
+               uint32_t count);
+    void append_name(const std::string& name);
+    void append_value(const pmt::pmt_t& knob);
+
+    const std::string& data() const { return d_data; }
+
+private:
+    template <typename T>
+    void put(T value);
+    void put_size(size_t size);
+
+    std::string d_data;
+};
 } // namespace rpcpmtconverter
 
 #endif /* RPCPMTCONVERTERS_THRIFT_H */
@@ -16,10 +16,13 @@
 #include <gnuradio/logger.h>
 #include <gnuradio/rpcpmtconverters_thrift.h>
 #include <gnuradio/rpcserver_base.h>
+#include <condition_variable>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 
 #define S(x) #x
 #define S_(x) S(x)
@@ -74,6 +77,26 @@ public:
                      const std::string& port,
                      const std::string& msg);
 
+    /*!
+     * \brief Push snapshots of knobs to a StreamReceiver at a fixed rate.
+     *
+     * Every \p period_ms milliseconds, the values of all knobs matching
+     * one of the regular expressions in \p knobs are pushed as one
+     * frame in the compact format described in gnuradio.thrift to the
+     * StreamReceiver service listening at \p host and \p port.
+     *
+     * All subscriptions are served by one thread. The knobs are looked
+     * up once, and again only when knobs are registered or removed,
+     * so that a snapshot only costs reading the values.
+     *
+     * \returns the id of the subscription, for unsubscribe()
+     */
+    int32_t subscribe(const GNURadio::KnobIDList& knobs,
+                      const int32_t period_ms,
+                      const std::string& host,
+                      const int32_t port);
+    void unsubscribe(const int32_t id);
+
     virtual void shutdown();
 
 private:
@@ -81,6 +104,21 @@ private:
     static gr::logger_ptr d_debug_logger;
 
     std::mutex d_callback_map_lock;
+    // Changes whenever the set of query callbacks does
+    uint64_t d_query_generation = 0;
+
+    struct subscription;
+    typedef std::map<int32_t, std::shared_ptr<subscription>> SubscriptionMap_t;
+    std::mutex d_stream_lock;
+    std::condition_variable d_stream_cond;
+    SubscriptionMap_t d_subscriptions;
+    int32_t d_next_subscription = 0;
+    bool d_stream_done = false;
+    std::thread d_stream_thread;
+
+    void stream_loop();
+    void resolve_knobs(subscription& sub);
+    bool push_snapshot(subscription& sub);
 
     typedef std::map<std::string, configureCallback_t> ConfigureCallbackMap_t;
     ConfigureCallbackMap_t d_setcallbackmap;
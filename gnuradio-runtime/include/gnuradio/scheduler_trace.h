@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_SCHEDULER_TRACE_H
+#define INCLUDED_GR_SCHEDULER_TRACE_H
+
+#include <gnuradio/api.h>
+#include <string>
+
+namespace gr {
+
+/*!
+ * \brief Timeline of what the block threads of the scheduler do.
+ * \ingroup misc
+ *
+ * With the runtime built with ENABLE_SCHEDULER_TRACING, every block
+ * thread records its work calls, its waits for input and for output
+ * space, the notifications it sends to its neighbors and its message
+ * dispatch into a ring buffer of its own. Without it, the tracepoints
+ * are compiled out and these functions do nothing.
+ *
+ * Recording starts enabled if [Tracing] on is set in the preferences.
+ * Each thread keeps the last [Tracing] ring_size events. If [Tracing]
+ * file is set, the trace is written there whenever
+ * gr::top_block::wait() returns, with the events of all threads
+ * recorded since the last clear().
+ */
+namespace scheduler_trace {
+
+//! Returns true if the runtime was built with scheduler tracing
+GR_RUNTIME_API bool available();
+
+//! Starts or stops recording events
+GR_RUNTIME_API void set_enabled(bool enabled);
+
+//! Returns true if events are being recorded
+GR_RUNTIME_API bool enabled();
+
+/*!
+ * \brief Writes the events recorded so far as a Chrome trace (JSON
+ * Trace Event Format), which chrome://tracing and Perfetto open.
+ *
+ * Threads may go on recording while the trace is written; events
+ * they overwrite meanwhile are left out.
+ *
+ * \return false if tracing is not available or the file could not be
+ * written
+ */
+GR_RUNTIME_API bool dump(const std::string& filename);
+
+//! Drops the events recorded so far, and the threads that ended
+GR_RUNTIME_API void clear();
+
+} /* namespace scheduler_trace */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_SCHEDULER_TRACE_H */
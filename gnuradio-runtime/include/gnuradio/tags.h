@@ -13,6 +13,7 @@
 
 #include <gnuradio/api.h>
 #include <pmt/pmt.h>
+#include <functional>
 
 namespace gr {
 
@@ -75,6 +76,12 @@ struct GR_RUNTIME_API tag_t {
     ~tag_t() {}
 };
 
+/*!
+ * \brief Called with each tag a tag lookup finds, in order of offset;
+ * returning false ends the lookup.
+ */
+typedef std::function<bool(const tag_t&)> tag_visitor;
+
 } /* namespace gr */
 
 #endif /*INCLUDED_GR_TAGS_H*/
@@ -105,6 +105,23 @@ public:
      */
     void unlock() override;
 
+    /*!
+     * Apply the connections made and removed since the flowgraph was
+     * started or last reconfigured to the running flowgraph, without
+     * lock() and unlock(). Only the blocks whose connections changed,
+     * and those added or removed, are stopped and rewired; all other
+     * blocks keep running with their buffers.
+     *
+     * If a block that stays in the flowgraph changes its number of
+     * connected ports, the whole flowgraph is restarted as by
+     * unlock(). Does nothing if the flowgraph is not running or is
+     * locked, since start() and unlock() pick up the changes.
+     *
+     * N.B. reconfigure() may not be called from a flowgraph thread
+     * either.
+     */
+    void reconfigure();
+
     /*!
      * Returns a string that lists the edge connections in the
      * flattened flowgraph.
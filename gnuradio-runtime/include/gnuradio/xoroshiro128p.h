@@ -16,9 +16,11 @@
 #ifndef INCLUDED_XOROSHIRO128P_H
 #define INCLUDED_XOROSHIRO128P_H
 #ifdef __cplusplus
+#include <cstddef>
 #include <cstdint>
 extern "C" {
 #else
+#include <stddef.h>
 #include <stdint.h>
 #endif
 
@@ -94,6 +96,64 @@ static inline void xoroshiro128p_seed(uint64_t* state, const uint64_t seed)
     state[1] = splitmix64_next(state);
     xoroshiro128p_jump(state);
 }
+
+/*! \brief number of interleaved streams advanced in lockstep by the bulk functions
+ * Eight 64 bit lanes fill one AVX-512 or two AVX2 registers; the lane loops below are
+ * written so that the compiler can vectorize them.
+ */
+#define XOROSHIRO128P_LANES 8
+
+/*! \brief Seed XOROSHIRO128P_LANES interleaved streams from a 64 bit seed
+ * The state has to hold 2 * XOROSHIRO128P_LANES words and is kept as structure of
+ * arrays: the first XOROSHIRO128P_LANES words are the first state word of every lane,
+ * followed by the second state words. Lane k starts k + 1 jumps (2^64 steps each) after
+ * the state xoroshiro128p_seed() produces for the same seed, so the lanes overlap
+ * neither each other nor a scalar generator seeded identically.
+ */
+static inline void xoroshiro128p_seed_lanes(uint64_t* state, const uint64_t seed)
+{
+    uint64_t lane[2];
+    xoroshiro128p_seed(lane, seed);
+    for (unsigned int k = 0; k < XOROSHIRO128P_LANES; ++k) {
+        xoroshiro128p_jump(lane);
+        state[k] = lane[0];
+        state[XOROSHIRO128P_LANES + k] = lane[1];
+    }
+}
+
+/*! \brief generate the next random number of every lane and update the lane states
+ */
+static inline void xoroshiro128p_next_lanes(uint64_t* state, uint64_t* out)
+{
+    uint64_t* s0 = state;
+    uint64_t* s1 = state + XOROSHIRO128P_LANES;
+    for (unsigned int k = 0; k < XOROSHIRO128P_LANES; ++k) {
+        const uint64_t a = s0[k];
+        const uint64_t b = s1[k] ^ a;
+        out[k] = a + s1[k];
+        s0[k] = rotl(a, 55) ^ b ^ (b << 14);
+        s1[k] = rotl(b, 36);
+    }
+}
+
+/*! \brief Fill out with n random numbers from the interleaved streams in state
+ * Output k belongs to lane k % XOROSHIRO128P_LANES. If n is not a multiple of the lane
+ * count, the numbers of the last, partial round are discarded.
+ */
+static inline void xoroshiro128p_fill(uint64_t* state, uint64_t* out, size_t n)
+{
+    size_t i = 0;
+    for (; i + XOROSHIRO128P_LANES <= n; i += XOROSHIRO128P_LANES) {
+        xoroshiro128p_next_lanes(state, out + i);
+    }
+    if (i < n) {
+        uint64_t tail[XOROSHIRO128P_LANES];
+        xoroshiro128p_next_lanes(state, tail);
+        for (unsigned int k = 0; i < n; ++i, ++k) {
+            out[i] = tail[k];
+        }
+    }
+}
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,276 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "async_log_sink.h"
+#include <spdlog/details/log_msg.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace gr {
+
+struct async_log_sink::record {
+    spdlog::log_clock::time_point time;
+    size_t thread_id;
+    spdlog::level::level_enum level;
+    uint16_t name_size;
+    uint16_t size;
+    char name[64];
+    char payload[416];
+};
+
+/*
+ * Written by one logging thread, read by the background thread.
+ */
+struct async_log_sink::ring {
+    explicit ring(size_t nrecords)
+        : records(new record[nrecords]),
+          mask(nrecords - 1),
+          head(0),
+          tail(0),
+          orphaned(false)
+    {
+    }
+
+    std::unique_ptr<record[]> records;
+    const uint64_t mask;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    // The thread exited; the ring goes once it is drained
+    std::atomic<bool> orphaned;
+};
+
+static size_t round_up_pow2(size_t n)
+{
+    size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+async_log_sink::async_log_sink(spdlog::sink_ptr backend, size_t ring_records)
+    : d_backend(backend),
+      d_ring_records(round_up_pow2(std::max<size_t>(ring_records, 2))),
+      d_async(false),
+      d_dropped(0),
+      d_stop(false),
+      d_rate_limit(0),
+      d_sites(new site_slot[NSITES])
+{
+    for (size_t i = 0; i < NSITES; i++) {
+        d_sites[i].key.store(0);
+        d_sites[i].second.store(0);
+        d_sites[i].count.store(0);
+    }
+}
+
+async_log_sink::~async_log_sink() { set_async(false); }
+
+/*
+ * There is only the one sink of gr::logging, so a thread has at most
+ * one ring. It is allocated the first time the thread logs.
+ */
+async_log_sink::ring& async_log_sink::thread_ring()
+{
+    struct owner {
+        std::shared_ptr<ring> r;
+        ~owner()
+        {
+            if (r)
+                r->orphaned.store(true);
+        }
+    };
+    static thread_local owner local;
+
+    if (!local.r) {
+        local.r = std::make_shared<ring>(d_ring_records);
+        std::lock_guard<std::mutex> guard(d_rings_mutex);
+        d_rings.push_back(local.r);
+    }
+    return *local.r;
+}
+
+void async_log_sink::log(const spdlog::details::log_msg& msg)
+{
+    if (!d_backend->should_log(msg.level))
+        return;
+
+    if (!d_async.load(std::memory_order_relaxed)) {
+        d_backend->log(msg);
+        return;
+    }
+
+    ring& r = thread_ring();
+    const uint64_t head = r.head.load(std::memory_order_relaxed);
+    if (head - r.tail.load(std::memory_order_acquire) > r.mask) {
+        d_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Long names and messages are cut short
+    record& rec = r.records[head & r.mask];
+    rec.time = msg.time;
+    rec.thread_id = msg.thread_id;
+    rec.level = msg.level;
+    rec.name_size = std::min(msg.logger_name.size(), sizeof(rec.name));
+    memcpy(rec.name, msg.logger_name.data(), rec.name_size);
+    rec.size = std::min(msg.payload.size(), sizeof(rec.payload));
+    memcpy(rec.payload, msg.payload.data(), rec.size);
+    r.head.store(head + 1, std::memory_order_release);
+}
+
+void async_log_sink::flush() { d_backend->flush(); }
+
+void async_log_sink::set_pattern(const std::string& pattern)
+{
+    d_backend->set_pattern(pattern);
+}
+
+void async_log_sink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    d_backend->set_formatter(std::move(sink_formatter));
+}
+
+void async_log_sink::set_async(bool enabled)
+{
+    std::lock_guard<std::mutex> control(d_control_mutex);
+    if (enabled == d_async.load())
+        return;
+
+    if (enabled) {
+        d_stop = false;
+        d_thread = std::thread(&async_log_sink::run, this);
+        d_async.store(true);
+    } else {
+        d_async.store(false);
+        {
+            std::lock_guard<std::mutex> guard(d_thread_mutex);
+            d_stop = true;
+        }
+        d_wakeup.notify_one();
+        d_thread.join();
+    }
+}
+
+void async_log_sink::set_rate_limit(unsigned int records_per_second)
+{
+    d_rate_limit.store(records_per_second);
+}
+
+/*
+ * Counts the records of the call site and logger in the current
+ * second. A pair that finds no free slot is not limited.
+ */
+bool async_log_sink::admit(const void* site, const void* logger)
+{
+    const unsigned int limit = d_rate_limit.load(std::memory_order_relaxed);
+    if (limit == 0)
+        return true;
+
+    const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+
+    // Keyed on the logger too: loggers share format strings, such as the
+    // one all Python logging goes through.
+    uint64_t key = (reinterpret_cast<uintptr_t>(site) * 0x9E3779B97F4A7C15ull) ^
+                   (reinterpret_cast<uintptr_t>(logger) * 0xC2B2AE3D27D4EB4Full);
+    if (key == 0)
+        key = 1;
+
+    size_t index = key >> 54;
+    for (int probe = 0; probe < 8; probe++, index = (index + 1) % NSITES) {
+        site_slot& slot = d_sites[index];
+        uint64_t current = slot.key.load(std::memory_order_acquire);
+        if (current == 0 && !slot.key.compare_exchange_strong(current, key) &&
+            current != key)
+            continue;
+        if (current != 0 && current != key)
+            continue;
+
+        int64_t second = slot.second.load(std::memory_order_relaxed);
+        if (second != now && slot.second.compare_exchange_strong(second, now))
+            slot.count.store(0, std::memory_order_relaxed);
+
+        if (slot.count.fetch_add(1, std::memory_order_relaxed) < limit)
+            return true;
+        d_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+size_t async_log_sink::drain()
+{
+    size_t n = 0;
+
+    std::lock_guard<std::mutex> guard(d_rings_mutex);
+    for (const auto& r : d_rings) {
+        uint64_t tail = r->tail.load(std::memory_order_relaxed);
+        const uint64_t head = r->head.load(std::memory_order_acquire);
+        for (; tail < head; tail++, n++) {
+            const record& rec = r->records[tail & r->mask];
+            spdlog::details::log_msg msg(rec.time,
+                                         spdlog::source_loc{},
+                                         spdlog::string_view_t(rec.name, rec.name_size),
+                                         rec.level,
+                                         spdlog::string_view_t(rec.payload, rec.size));
+            msg.thread_id = rec.thread_id;
+            d_backend->log(msg);
+            r->tail.store(tail + 1, std::memory_order_release);
+        }
+    }
+
+    d_rings.erase(std::remove_if(d_rings.begin(),
+                                 d_rings.end(),
+                                 [](const std::shared_ptr<ring>& r) {
+                                     return r->orphaned.load() &&
+                                            r->tail.load() == r->head.load();
+                                 }),
+                  d_rings.end());
+    return n;
+}
+
+void async_log_sink::run()
+{
+    uint64_t reported = d_dropped.load();
+    auto last_report = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(d_thread_mutex);
+    while (!d_stop) {
+        lock.unlock();
+        drain();
+
+        // Tell about dropped records at most once a second
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t dropped = d_dropped.load();
+        if (dropped != reported && now - last_report >= std::chrono::seconds(1)) {
+            const std::string text =
+                fmt::format("dropped {:d} log records", dropped - reported);
+            d_backend->log(
+                spdlog::details::log_msg("logging", spdlog::level::warn, text));
+            reported = dropped;
+            last_report = now;
+        }
+
+        lock.lock();
+        d_wakeup.wait_for(lock, std::chrono::milliseconds(10), [this] { return d_stop; });
+    }
+    lock.unlock();
+
+    drain();
+}
+
+} /* namespace gr */
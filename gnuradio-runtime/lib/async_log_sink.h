@@ -0,0 +1,97 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_ASYNC_LOG_SINK_H
+#define INCLUDED_GR_RUNTIME_ASYNC_LOG_SINK_H
+
+#include <spdlog/common.h>
+#include <spdlog/sinks/sink.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gr {
+
+/*!
+ * \brief Sink all gr::logger instances write to, in front of the
+ * default backend.
+ *
+ * Synchronously, records are handed to the backend right away. In
+ * asynchronous mode, every logging thread copies its formatted records
+ * into a ring of its own, without taking locks or allocating, and one
+ * background thread hands them to the backend. Records that find the
+ * ring full are dropped and counted.
+ *
+ * The sink also keeps the per call site and logger rate limit of
+ * gr::logger.
+ */
+class async_log_sink final : public spdlog::sinks::sink
+{
+public:
+    async_log_sink(spdlog::sink_ptr backend, size_t ring_records);
+    ~async_log_sink() override;
+
+    void log(const spdlog::details::log_msg& msg) override;
+    void flush() override;
+    void set_pattern(const std::string& pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+    void set_async(bool enabled);
+    bool async() const { return d_async.load(); }
+
+    void set_rate_limit(unsigned int records_per_second);
+    bool admit(const void* site, const void* logger);
+
+    uint64_t dropped() const { return d_dropped.load(); }
+
+private:
+    struct record;
+    struct ring;
+
+    const spdlog::sink_ptr d_backend;
+    const size_t d_ring_records;
+
+    std::atomic<bool> d_async;
+    std::atomic<uint64_t> d_dropped;
+
+    // Rings of all threads that logged asynchronously
+    std::mutex d_rings_mutex;
+    std::vector<std::shared_ptr<ring>> d_rings;
+
+    std::mutex d_control_mutex;
+    std::mutex d_thread_mutex;
+    std::condition_variable d_wakeup;
+    bool d_stop;
+    std::thread d_thread;
+
+    // Records per second, call site and logger; the pair hashes to a
+    // key, 0 for a free slot, and the key to one of a fixed number of
+    // slots.
+    struct site_slot {
+        std::atomic<uint64_t> key;
+        std::atomic<int64_t> second;
+        std::atomic<unsigned int> count;
+    };
+    static constexpr size_t NSITES = 1024;
+    std::atomic<unsigned int> d_rate_limit;
+    std::unique_ptr<site_slot[]> d_sites;
+
+    ring& thread_ring();
+    void run();
+    size_t drain();
+};
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_ASYNC_LOG_SINK_H */
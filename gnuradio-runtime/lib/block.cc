@@ -44,6 +44,7 @@ block::block(const std::string& name,
       d_history(1),
       d_attr_delay(0),
       d_fixed_rate(false),
+      d_fixed_rate_forecast(false),
       d_max_noutput_items_set(false),
       d_max_noutput_items(0),
       d_min_noutput_items(0),
@@ -266,6 +267,29 @@ void block::get_tags_in_window(std::vector<tag_t>& v,
                                 unique_id());
 }
 
+void block::visit_tags_in_range(unsigned int which_input,
+                                uint64_t start,
+                                uint64_t end,
+                                const pmt::pmt_t& key,
+                                const tag_visitor& visitor)
+{
+    d_detail->visit_tags_in_range(which_input, start, end, key, unique_id(), visitor);
+}
+
+void block::visit_tags_in_window(unsigned int which_input,
+                                 uint64_t start,
+                                 uint64_t end,
+                                 const pmt::pmt_t& key,
+                                 const tag_visitor& visitor)
+{
+    d_detail->visit_tags_in_range(which_input,
+                                  nitems_read(which_input) + start,
+                                  nitems_read(which_input) + end,
+                                  key,
+                                  unique_id(),
+                                  visitor);
+}
+
 block::tag_propagation_policy_t block::tag_propagation_policy()
 {
     return d_tag_propagation_policy;
@@ -430,7 +454,7 @@ block::replace_buffer(size_t src_port, size_t dst_port, block_sptr block_owner)
     block_detail_sptr detail_ = detail();
     buffer_sptr orig_buffer = detail_->output(src_port);
 
-    buffer_type buftype = block_owner->output_signature()->stream_buffer_type(dst_port);
+    buffer_type buftype = block_owner->input_signature()->stream_buffer_type(dst_port);
 
     // Make a new buffer but this time use the passed in block as the owner
     buffer_sptr new_buffer =
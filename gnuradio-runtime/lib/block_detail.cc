@@ -200,22 +200,23 @@ void block_detail::get_tags_in_range(std::vector<tag_t>& v,
                                      const pmt::pmt_t& key,
                                      long id)
 {
-    std::vector<tag_t> found_items;
-
     v.resize(0);
 
-    // get from gr_buffer_reader's deque of tags
-    d_input[which_input]->get_tags_in_range(found_items, abs_start, abs_end, id);
-
-    // Filter further by key name
-    pmt::pmt_t itemkey;
-    std::vector<tag_t>::iterator itr;
-    for (itr = found_items.begin(); itr != found_items.end(); itr++) {
-        itemkey = (*itr).key;
-        if (pmt::eqv(key, itemkey)) {
-            v.push_back(*itr);
-        }
-    }
+    d_input[which_input]->visit_tags_in_range(
+        abs_start, abs_end, key, id, [&v](const tag_t& tag) {
+            v.push_back(tag);
+            return true;
+        });
+}
+
+void block_detail::visit_tags_in_range(unsigned int which_input,
+                                       uint64_t abs_start,
+                                       uint64_t abs_end,
+                                       const pmt::pmt_t& key,
+                                       long id,
+                                       const tag_visitor& visitor)
+{
+    d_input[which_input]->visit_tags_in_range(abs_start, abs_end, key, id, visitor);
 }
 
 void block_detail::set_processor_affinity(const std::vector<int>& mask)
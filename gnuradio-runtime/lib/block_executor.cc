@@ -12,11 +12,13 @@
 #include "config.h"
 #endif
 
+#include "scheduler_tracepoints.h"
 #include <gnuradio/block.h>
 #include <gnuradio/block_detail.h>
 #include <gnuradio/custom_lock.h>
 #include <gnuradio/prefs.h>
 #include <block_executor.h>
+#include <algorithm>
 #include <limits>
 #include <sstream>
 
@@ -108,6 +110,56 @@ static int min_available_space(block* m,
     return min_space;
 }
 
+//
+// Rescale the offsets of tags read from an input to the output's rate
+// by relative rate, rounding to the nearest item.
+//
+static void scale_tag_offsets(std::vector<tag_t>& tags,
+                              double rrate,
+                              mpq_class& mp_rrate,
+                              bool use_fp_rrate)
+{
+    static const mpq_class one_half(1, 2);
+
+    if (rrate == 1.0) {
+        return;
+    }
+
+    if (use_fp_rrate) {
+        for (auto& tag : tags) {
+            tag.offset = std::llround((double)tag.offset * rrate);
+        }
+        return;
+    }
+
+#ifdef __SIZEOF_INT128__
+    // The exact product of a 64 bit offset and a 64 bit numerator fits
+    // 128 bits, so this rounds like the GMP path below without it.
+    if (mp_rrate.get_num().fits_ulong_p() && mp_rrate.get_den().fits_ulong_p()) {
+        const unsigned __int128 num = mp_rrate.get_num().get_ui();
+        const unsigned __int128 den = mp_rrate.get_den().get_ui();
+        for (auto& tag : tags) {
+            const unsigned __int128 product = tag.offset * num;
+            const unsigned __int128 rem = product % den;
+            tag.offset = (uint64_t)(product / den + (2 * rem >= den ? 1 : 0));
+        }
+        return;
+    }
+#endif
+
+    mpz_class offset;
+    for (auto& tag : tags) {
+        mpz_import(offset.get_mpz_t(), 1, 1, sizeof(tag.offset), 0, 0, &tag.offset);
+        offset = offset * mp_rrate + one_half;
+        tag.offset = offset.get_ui();
+    }
+}
+
+//
+// Tags read from each input are rescaled once and then handed to each
+// output buffer in one batch. The buffers only insert them into their
+// tag lookup structures once a downstream block looks up tags.
+//
 static bool propagate_tags(block::tag_propagation_policy_t policy,
                            block_detail* d,
                            const std::vector<uint64_t>& start_nitems_read,
@@ -117,8 +169,6 @@ static bool propagate_tags(block::tag_propagation_policy_t policy,
                            std::vector<tag_t>& rtags,
                            long block_id)
 {
-    static const mpq_class one_half(1, 2);
-
     // Move tags downstream
     // if a sink, we don't need to move downstream
     if (d->sink_p()) {
@@ -129,10 +179,8 @@ static bool propagate_tags(block::tag_propagation_policy_t policy,
     case block::TPP_DONT:
     case block::TPP_CUSTOM:
         return true;
-    case block::TPP_ALL_TO_ALL: {
+    case block::TPP_ALL_TO_ALL:
         // every tag on every input propagates to everyone downstream
-        std::vector<buffer_sptr> out_buf;
-
         for (int i = 0; i < d->ninputs(); i++) {
             d->get_tags_in_range(
                 rtags, i, start_nitems_read[i], d->nitems_read(i), block_id);
@@ -141,51 +189,16 @@ static bool propagate_tags(block::tag_propagation_policy_t policy,
                 continue;
             }
 
-            if (out_buf.empty()) {
-                out_buf.reserve(d->noutputs());
-                for (int o = 0; o < d->noutputs(); o++)
-                    out_buf.push_back(d->output(o));
-            }
-
-            std::vector<tag_t>::iterator t;
-            if (rrate == 1.0) {
-                for (t = rtags.begin(); t != rtags.end(); t++) {
-                    for (int o = 0; o < d->noutputs(); o++)
-                        out_buf[o]->add_item_tag(*t);
-                }
-            } else if (use_fp_rrate) {
-                for (t = rtags.begin(); t != rtags.end(); t++) {
-                    tag_t new_tag = *t;
-                    new_tag.offset = std::llround((double)new_tag.offset * rrate);
-                    for (int o = 0; o < d->noutputs(); o++)
-                        out_buf[o]->add_item_tag(new_tag);
-                }
-            } else {
-                mpz_class offset;
-                for (t = rtags.begin(); t != rtags.end(); t++) {
-                    tag_t new_tag = *t;
-                    mpz_import(offset.get_mpz_t(),
-                               1,
-                               1,
-                               sizeof(new_tag.offset),
-                               0,
-                               0,
-                               &new_tag.offset);
-                    offset = offset * mp_rrate + one_half;
-                    new_tag.offset = offset.get_ui();
-                    for (int o = 0; o < d->noutputs(); o++)
-                        out_buf[o]->add_item_tag(new_tag);
-                }
-            }
+            scale_tag_offsets(rtags, rrate, mp_rrate, use_fp_rrate);
+            for (int o = 0; o < d->noutputs(); o++)
+                d->output(o)->add_item_tags(rtags);
         }
-    } break;
+        break;
     case block::TPP_ONE_TO_ONE:
         // tags from input i only go to output i
         // this requires d->ninputs() == d->noutputs; this is checked when this
         // type of tag-propagation system is selected in block_detail
         if (d->ninputs() == d->noutputs()) {
-            buffer_sptr out_buf;
-
             for (int i = 0; i < d->ninputs(); i++) {
                 d->get_tags_in_range(
                     rtags, i, start_nitems_read[i], d->nitems_read(i), block_id);
@@ -194,35 +207,8 @@ static bool propagate_tags(block::tag_propagation_policy_t policy,
                     continue;
                 }
 
-                out_buf = d->output(i);
-
-                std::vector<tag_t>::iterator t;
-                if (rrate == 1.0) {
-                    for (t = rtags.begin(); t != rtags.end(); t++) {
-                        out_buf->add_item_tag(*t);
-                    }
-                } else if (use_fp_rrate) {
-                    for (t = rtags.begin(); t != rtags.end(); t++) {
-                        tag_t new_tag = *t;
-                        new_tag.offset = std::llround((double)new_tag.offset * rrate);
-                        out_buf->add_item_tag(new_tag);
-                    }
-                } else {
-                    mpz_class offset;
-                    for (t = rtags.begin(); t != rtags.end(); t++) {
-                        tag_t new_tag = *t;
-                        mpz_import(offset.get_mpz_t(),
-                                   1,
-                                   1,
-                                   sizeof(new_tag.offset),
-                                   0,
-                                   0,
-                                   &new_tag.offset);
-                        offset = offset * mp_rrate + one_half;
-                        new_tag.offset = offset.get_ui();
-                        out_buf->add_item_tag(new_tag);
-                    }
-                }
+                scale_tag_offsets(rtags, rrate, mp_rrate, use_fp_rrate);
+                d->output(i)->add_item_tags(rtags);
             }
         } else {
             std::ostringstream msg;
@@ -264,6 +250,7 @@ block_executor::state block_executor::run_one_iteration()
     int new_alignment = 0;
     int alignment_state = -1;
     int output_idx = 0;
+    bool closed_form_tried = false;
 
     block* m = d_block.get();
     block_detail* d = m->detail().get();
@@ -544,6 +531,22 @@ block_executor::state block_executor::run_one_iteration()
         }
 
         if (i < d->ninputs()) { // not enough input on input[i]
+            // Every input needs as many items, so the input with the fewest
+            // bounds how much output we can ask for. Try that once instead
+            // of halving the request until it fits; forecast() checks it.
+            if (m->fixed_rate_forecast() && !closed_form_tried) {
+                closed_form_tried = true;
+                int min_items_avail =
+                    *std::min_element(d_ninput_items.begin(), d_ninput_items.end());
+                int reqd_noutput_items = round_down(
+                    m->fixed_rate_ninput_to_noutput(min_items_avail), m->output_multiple());
+                reqd_noutput_items = std::max(reqd_noutput_items, m->output_multiple());
+                if (reqd_noutput_items < noutput_items) {
+                    noutput_items = reqd_noutput_items;
+                    goto try_again;
+                }
+            }
+
             // if we can, try reducing the size of our output request
             if (noutput_items > m->output_multiple()) {
                 noutput_items /= 2;
@@ -619,8 +622,10 @@ block_executor::state block_executor::run_one_iteration()
 #endif /* GR_PERFORMANCE_COUNTERS */
 
         // Do the actual work of the block
+        GR_TRACE_BEGIN(work);
         int n =
             m->general_work(noutput_items, d_ninput_items, d_input_items, d_output_items);
+        GR_TRACE_END(work, n);
 
 #ifdef GR_PERFORMANCE_COUNTERS
         if (d_use_pc)
@@ -18,22 +18,25 @@ gr::block_registry global_block_registry;
 
 namespace gr {
 
-block_registry::block_registry() { d_ref_map = pmt::make_dict(); }
+block_registry::block_registry() {}
 
 long block_registry::block_register(basic_block* block)
 {
     gr::thread::scoped_lock guard(d_mutex);
 
-    if (d_map.find(block->name()) == d_map.end()) {
-        d_map[block->name()] = blocksubmap_t();
-        d_map[block->name()][0] = block;
-        return 0;
-    } else {
-        for (size_t i = 0; i <= d_map[block->name()].size(); i++) {
-            if (d_map[block->name()].find(i) == d_map[block->name()].end()) {
-                d_map[block->name()][i] = block;
-                return i;
-            }
+    blocksubmap_t& ids = d_map[block->name()];
+
+    // Without gaps in the ids, the next one is free
+    if (ids.empty() || ids.rbegin()->first == static_cast<long>(ids.size()) - 1) {
+        const long id = ids.size();
+        ids[id] = block;
+        return id;
+    }
+
+    for (size_t i = 0; i <= ids.size(); i++) {
+        if (ids.find(i) == ids.end()) {
+            ids[i] = block;
+            return i;
         }
     }
     throw std::runtime_error("should not reach this");
@@ -44,9 +47,9 @@ void block_registry::block_unregister(basic_block* block)
     gr::thread::scoped_lock guard(d_mutex);
 
     d_map[block->name()].erase(d_map[block->name()].find(block->symbolic_id()));
-    d_ref_map = pmt::dict_delete(d_ref_map, pmt::intern(block->symbol_name()));
+    d_ref_map.erase(block->symbol_name());
     if (block->alias_set()) {
-        d_ref_map = pmt::dict_delete(d_ref_map, pmt::intern(block->alias()));
+        d_ref_map.erase(block->alias());
     }
 }
 
@@ -63,17 +66,17 @@ void block_registry::register_symbolic_name(basic_block* block, std::string name
 {
     gr::thread::scoped_lock guard(d_mutex);
 
-    if (pmt::dict_has_key(d_ref_map, pmt::intern(name))) {
+    if (d_ref_map.count(name)) {
         throw std::runtime_error("symbol already exists, can not re-use!");
     }
-    d_ref_map = pmt::dict_add(d_ref_map, pmt::intern(name), pmt::make_any(block));
+    d_ref_map[name] = block;
 }
 
 void block_registry::update_symbolic_name(basic_block* block, std::string name)
 {
     gr::thread::scoped_lock guard(d_mutex);
 
-    if (pmt::dict_has_key(d_ref_map, pmt::intern(name))) {
+    if (d_ref_map.count(name)) {
         throw std::runtime_error("symbol already exists, can not re-use!");
     }
 
@@ -81,23 +84,24 @@ void block_registry::update_symbolic_name(basic_block* block, std::string name)
     if (block->alias_set()) {
         // And make sure that the registry has the alias key.
         // We test both in case the block's and registry ever get out of sync.
-        if (pmt::dict_has_key(d_ref_map, block->alias_pmt())) {
-            d_ref_map = pmt::dict_delete(d_ref_map, block->alias_pmt());
-        }
+        d_ref_map.erase(block->alias());
     }
-    d_ref_map = pmt::dict_add(d_ref_map, pmt::intern(name), pmt::make_any(block));
+    d_ref_map[name] = block;
 }
 
 basic_block_sptr block_registry::block_lookup(pmt::pmt_t symbol)
 {
     gr::thread::scoped_lock guard(d_mutex);
 
-    pmt::pmt_t ref = pmt::dict_ref(d_ref_map, symbol, pmt::PMT_NIL);
-    if (pmt::eq(ref, pmt::PMT_NIL)) {
+    // Only symbols name blocks; anything else is not found, as before
+    if (!pmt::is_symbol(symbol)) {
+        throw std::runtime_error("block lookup failed! block not found!");
+    }
+    const auto ref = d_ref_map.find(pmt::symbol_to_string(symbol));
+    if (ref == d_ref_map.end()) {
         throw std::runtime_error("block lookup failed! block not found!");
     }
-    basic_block* blk = std::any_cast<basic_block*>(pmt::any_ref(ref));
-    return blk->shared_from_this();
+    return ref->second->shared_from_this();
 }
 
 void block_registry::register_primitive(std::string blk, block* ref)
@@ -163,12 +163,40 @@ void buffer::drop_reader(buffer_reader* reader)
 void buffer::add_item_tag(const tag_t& tag)
 {
     gr::thread::scoped_lock guard(*mutex());
-    d_item_tags.insert(std::pair<uint64_t, tag_t>(tag.offset, tag));
+    materialize_tags();
+    insert_tag(tag);
+}
+
+void buffer::add_item_tags(const std::vector<tag_t>& tags)
+{
+    gr::thread::scoped_lock guard(*mutex());
+    d_pending_tags.insert(d_pending_tags.end(), tags.begin(), tags.end());
+}
+
+void buffer::insert_tag(const tag_t& tag)
+{
+    // Tags mostly arrive in order of offset, which makes the end a good
+    // hint; equal offsets still go after the tags already there.
+    auto itr = d_item_tags.emplace_hint(d_item_tags.end(), tag.offset, tag);
+    if (pmt::is_symbol(tag.key)) {
+        auto& index = d_item_tags_by_key[tag.key.get()];
+        index.emplace_hint(index.end(), tag.offset, itr);
+    }
+}
+
+void buffer::insert_pending_tags()
+{
+    std::stable_sort(d_pending_tags.begin(), d_pending_tags.end(), tag_t::offset_compare);
+    for (const auto& tag : d_pending_tags) {
+        insert_tag(tag);
+    }
+    d_pending_tags.clear();
 }
 
 void buffer::remove_item_tag(const tag_t& tag, long id)
 {
     gr::thread::scoped_lock guard(*mutex());
+    materialize_tags();
     for (std::multimap<uint64_t, tag_t>::iterator it =
              d_item_tags.lower_bound(tag.offset);
          it != d_item_tags.upper_bound(tag.offset);
@@ -201,6 +229,15 @@ void buffer::prune_tags(uint64_t max_time)
       next valid iterator, then erase tmp, which now becomes invalid.
      */
 
+    // Tags no reader looked up yet are dropped without being inserted
+    const uint64_t delay = d_max_reader_delay + bufsize();
+    d_pending_tags.erase(std::remove_if(d_pending_tags.begin(),
+                                        d_pending_tags.end(),
+                                        [delay, max_time](const tag_t& tag) {
+                                            return tag.offset + delay < max_time;
+                                        }),
+                         d_pending_tags.end());
+
     uint64_t item_time;
     std::multimap<uint64_t, tag_t>::iterator itr(d_item_tags.begin()), tmp;
     while (itr != d_item_tags.end()) {
@@ -208,6 +245,7 @@ void buffer::prune_tags(uint64_t max_time)
         if (item_time + d_max_reader_delay + bufsize() < max_time) {
             tmp = itr;
             itr++;
+            unindex_tag(tmp);
             d_item_tags.erase(tmp);
         } else {
             // d_item_tags is a map sorted by offset, so when the if
@@ -218,6 +256,56 @@ void buffer::prune_tags(uint64_t max_time)
     }
 }
 
+void buffer::unindex_tag(std::multimap<uint64_t, tag_t>::iterator itr)
+{
+    const pmt::pmt_t& key = itr->second.key;
+    if (!pmt::is_symbol(key)) {
+        return;
+    }
+
+    auto index = d_item_tags_by_key.find(key.get());
+    auto range = index->second.equal_range(itr->first);
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (entry->second == itr) {
+            index->second.erase(entry);
+            break;
+        }
+    }
+    if (index->second.empty()) {
+        d_item_tags_by_key.erase(index);
+    }
+}
+
+void buffer::visit_tags(const pmt::pmt_t& key,
+                        uint64_t lower,
+                        uint64_t upper,
+                        const tag_visitor& visitor)
+{
+    materialize_tags();
+
+    if (!pmt::is_symbol(key)) {
+        auto itr_end = d_item_tags.upper_bound(upper);
+        for (auto itr = d_item_tags.lower_bound(lower); itr != itr_end; ++itr) {
+            if (pmt::eqv(key, itr->second.key) && !visitor(itr->second)) {
+                return;
+            }
+        }
+        return;
+    }
+
+    // Symbols are interned, so equal keys are the same object
+    auto index = d_item_tags_by_key.find(key.get());
+    if (index == d_item_tags_by_key.end()) {
+        return;
+    }
+    auto itr_end = index->second.upper_bound(upper);
+    for (auto itr = index->second.lower_bound(lower); itr != itr_end; ++itr) {
+        if (!visitor(itr->second->second)) {
+            return;
+        }
+    }
+}
+
 void buffer::on_lock(gr::thread::scoped_lock& lock)
 {
     // NOTE: the protecting mutex (scoped_lock) is held by the custom_lock object
@@ -47,6 +47,8 @@ buffer_add_reader(buffer_sptr buf, int nzero_preload, block_sptr link, int delay
         r->d_read_index = buf->d_write_index - nzero_preload;
     }
 
+    // A reader added to a running buffer counts from where it starts
+    r->d_abs_read_offset = buf->d_abs_write_offset;
     buf->d_readers.push_back(r.get());
 
 #ifdef BUFFER_DEBUG
@@ -176,6 +178,42 @@ void buffer_reader::get_tags_in_range(std::vector<tag_t>& v,
     }
 }
 
+void buffer_reader::visit_tags_in_range(uint64_t abs_start,
+                                        uint64_t abs_end,
+                                        const pmt::pmt_t& key,
+                                        long id,
+                                        const tag_visitor& visitor)
+{
+    gr::thread::scoped_lock guard(*mutex());
+
+    uint64_t lower_bound = abs_start - d_attr_delay;
+    // check for underflow and if so saturate at 0
+    if (lower_bound > abs_start)
+        lower_bound = 0;
+    uint64_t upper_bound = abs_end - d_attr_delay;
+    // check for underflow and if so saturate at 0
+    if (upper_bound > abs_end)
+        upper_bound = 0;
+
+    d_buffer->visit_tags(key, lower_bound, upper_bound, [&](const tag_t& tag) {
+        const uint64_t item_time = tag.offset + d_attr_delay;
+        if ((item_time < abs_start) || (item_time >= abs_end)) {
+            return true;
+        }
+        if (std::find(tag.marked_deleted.begin(), tag.marked_deleted.end(), id) !=
+            tag.marked_deleted.end()) {
+            return true;
+        }
+        // Only tags of a delayed reader need a copy with their offset moved
+        if (d_attr_delay == 0) {
+            return visitor(tag);
+        }
+        tag_t t = tag;
+        t.offset = item_time;
+        return visitor(t);
+    });
+}
+
 long buffer_reader_ncurrently_allocated() { return s_buffer_reader_count; }
 
 } /* namespace gr */
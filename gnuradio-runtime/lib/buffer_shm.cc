@@ -0,0 +1,506 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pagesize.h"
+#include <gnuradio/block.h>
+#include <gnuradio/buffer_reader.h>
+#include <gnuradio/buffer_shm.h>
+#include <gnuradio/thread/thread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include <sys/stat.h>
+#if defined(HAVE_MMAP) && defined(HAVE_SHM_OPEN)
+#include <signal.h>
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace gr {
+
+namespace {
+constexpr uint32_t SHM_MAGIC = 0x67727368; // "grsh"
+constexpr uint32_t SHM_VERSION = 1;
+constexpr uint32_t STATE_READY = 1;
+constexpr size_t NTAG_SLOTS = 256;
+constexpr size_t TAG_SLOT_SIZE = 512;
+} // namespace
+
+/*
+ * Start of the segment. The ring of items follows at the next page
+ * boundary after the tag slots.
+ */
+struct buffer_shm::header {
+    std::atomic<uint32_t> state;
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sizeof_item;
+    uint64_t bufsize;
+    std::atomic<uint32_t> users;
+    std::atomic<uint32_t> seq;
+    std::atomic<uint32_t> waiters;
+    std::atomic<int32_t> producer;
+    std::atomic<int32_t> consumer;
+    std::atomic<uint32_t> eof;
+    std::atomic<uint64_t> published;
+    std::atomic<uint64_t> released;
+    std::atomic<uint64_t> read;
+    std::atomic<uint64_t> tags_pushed;
+    std::atomic<uint64_t> tags_popped;
+};
+
+struct buffer_shm::tag_slot {
+    uint64_t offset;
+    uint32_t size;
+    char data[TAG_SLOT_SIZE - sizeof(uint64_t) - sizeof(uint32_t)];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "buffer_shm needs lock-free 64-bit atomics");
+
+buffer_type buffer_shm::type(buftype<buffer_shm, buffer_shm>{});
+
+buffer_shm::owner::~owner() {}
+
+buffer_sptr buffer_shm::make_buffer(int nitems,
+                                    size_t sizeof_item,
+                                    uint64_t downstream_lcm_nitems,
+                                    uint32_t downstream_max_out_mult,
+                                    block_sptr link,
+                                    block_sptr buf_owner)
+{
+    std::shared_ptr<owner> shm_owner = std::dynamic_pointer_cast<owner>(buf_owner);
+    if (!shm_owner) {
+        throw std::invalid_argument(
+            "buffer_shm: the owner of the buffer does not name a segment");
+    }
+    return buffer_sptr(new buffer_shm(shm_owner->shm_name(),
+                                      nitems,
+                                      sizeof_item,
+                                      downstream_lcm_nitems,
+                                      downstream_max_out_mult,
+                                      link));
+}
+
+buffer_shm::buffer_shm(const std::string& name,
+                       int nitems,
+                       size_t sizeof_item,
+                       uint64_t downstream_lcm_nitems,
+                       uint32_t downstream_max_out_mult,
+                       block_sptr link)
+    : buffer(buffer_mapping_type::double_mapped,
+             nitems,
+             sizeof_item,
+             downstream_lcm_nitems,
+             downstream_max_out_mult,
+             link),
+      d_name(name.empty() || name[0] != '/' ? "/" + name : name),
+      d_header(nullptr),
+      d_header_size(0),
+      d_ring(nullptr),
+      d_ring_size(0),
+      d_offset(0),
+      d_attached(false),
+      d_position(0),
+      d_tags_next(0)
+{
+    gr::configure_default_loggers(d_logger, d_debug_logger, "buffer_shm");
+    if (!allocate_buffer(nitems)) {
+        unmap();
+        throw std::runtime_error("buffer_shm: cannot map segment " + d_name);
+    }
+}
+
+buffer_shm::~buffer_shm()
+{
+#if defined(HAVE_MMAP) && defined(HAVE_SHM_OPEN)
+    // The last one to leave removes the segment
+    if (d_header->users.fetch_sub(1) == 1)
+        shm_unlink(d_name.c_str());
+#endif
+    unmap();
+}
+
+void buffer_shm::unmap()
+{
+#if defined(HAVE_MMAP) && defined(HAVE_SHM_OPEN)
+    if (d_ring)
+        munmap(d_ring, 3 * d_ring_size);
+    if (d_header)
+        munmap(d_header, d_header_size);
+#endif
+    d_ring = nullptr;
+    d_header = nullptr;
+}
+
+/*!
+ * Creates or opens the segment and maps the ring three times in a row,
+ * so that d_base can be moved anywhere in the first copy by attach().
+ */
+bool buffer_shm::allocate_buffer(int nitems)
+{
+#if !defined(HAVE_MMAP) || !defined(HAVE_SHM_OPEN)
+    d_logger->error("mmap or shm_open is not available");
+    return false;
+#else
+    const size_t page = gr::pagesize();
+
+    // Any buffer size must fill whole pages
+    const size_t min_nitems = page / std::gcd(d_sizeof_item, page);
+    size_t bufsize = ((nitems + min_nitems - 1) / min_nitems) * min_nitems;
+
+    const size_t header_size =
+        ((sizeof(header) + NTAG_SLOTS * sizeof(tag_slot) + page - 1) / page) * page;
+
+    bool created = true;
+    int fd = shm_open(d_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1 && errno == EEXIST) {
+        created = false;
+        fd = shm_open(d_name.c_str(), O_RDWR, 0600);
+    }
+    if (fd == -1) {
+        d_logger->error("shm_open [{:s}] failed: {:s}", d_name, strerror(errno));
+        return false;
+    }
+
+    if (created) {
+        if (ftruncate(fd, (off_t)(header_size + bufsize * d_sizeof_item)) == -1) {
+            d_logger->error("ftruncate failed: {:s}", strerror(errno));
+            close(fd);
+            shm_unlink(d_name.c_str());
+            return false;
+        }
+    } else {
+        // Give the process creating the segment the time to size it
+        struct stat st;
+        for (int i = 0; fstat(fd, &st) == 0 && (size_t)st.st_size < header_size; i++) {
+            if (i == 1000) {
+                d_logger->error("segment {:s} is not initialized", d_name);
+                close(fd);
+                return false;
+            }
+            usleep(1000);
+        }
+    }
+
+    void* hdr = mmap(nullptr, header_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED) {
+        d_logger->error("mmap of {:s} failed: {:s}", d_name, strerror(errno));
+        close(fd);
+        return false;
+    }
+    d_header = static_cast<header*>(hdr);
+    d_header_size = header_size;
+
+    if (created) {
+        d_header->magic = SHM_MAGIC;
+        d_header->version = SHM_VERSION;
+        d_header->sizeof_item = d_sizeof_item;
+        d_header->bufsize = bufsize;
+        d_header->state.store(STATE_READY);
+    } else {
+        for (int i = 0; d_header->state.load() != STATE_READY; i++) {
+            if (i == 1000) {
+                d_logger->error("segment {:s} is not initialized", d_name);
+                close(fd);
+                return false;
+            }
+            usleep(1000);
+        }
+        if (d_header->magic != SHM_MAGIC || d_header->version != SHM_VERSION ||
+            d_header->sizeof_item != d_sizeof_item) {
+            d_logger->error("segment {:s} exists with items of {:d} bytes",
+                            d_name,
+                            d_header->sizeof_item);
+            close(fd);
+            return false;
+        }
+        bufsize = d_header->bufsize;
+        if (bufsize < (size_t)nitems) {
+            d_logger->warn("segment {:s} holds {:d} items, {:d} were asked for",
+                           d_name,
+                           bufsize,
+                           nitems);
+        }
+    }
+    d_ring_size = bufsize * d_sizeof_item;
+    void* ring = mmap(
+        nullptr, 3 * d_ring_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) {
+        d_logger->error("reserving {:d} bytes failed", 3 * d_ring_size);
+        close(fd);
+        return false;
+    }
+    d_ring = static_cast<char*>(ring);
+    for (int i = 0; i < 3; i++) {
+        void* copy = mmap(d_ring + i * d_ring_size,
+                          d_ring_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_FIXED,
+                          fd,
+                          (off_t)header_size);
+        if (copy == MAP_FAILED) {
+            d_logger->error("mmap of {:s} failed: {:s}", d_name, strerror(errno));
+            close(fd);
+            return false;
+        }
+    }
+    close(fd);
+
+    d_header->users.fetch_add(1);
+    d_bufsize = bufsize;
+    d_base = d_ring;
+    return true;
+#endif
+}
+
+int buffer_shm::space_available()
+{
+    if (d_readers.empty())
+        return d_bufsize - 1;
+
+    // Find out the maximum amount of data available to our readers
+    int most_data = d_readers[0]->items_available();
+    uint64_t min_items_read = d_readers[0]->nitems_read();
+    for (size_t i = 1; i < d_readers.size(); i++) {
+        most_data = std::max(most_data, d_readers[i]->items_available());
+        min_items_read = std::min(min_items_read, d_readers[i]->nitems_read());
+    }
+
+    if (min_items_read != d_last_min_items_read) {
+        prune_tags(d_last_min_items_read);
+        d_last_min_items_read = min_items_read;
+    }
+
+    return d_bufsize - most_data - 1;
+}
+
+bool buffer_shm::consumer_gone() const
+{
+    const int32_t consumer = d_header->consumer.load();
+#if defined(HAVE_MMAP) && defined(HAVE_SHM_OPEN)
+    return consumer == 0 || (kill(consumer, 0) == -1 && errno == ESRCH);
+#else
+    return consumer == 0;
+#endif
+}
+
+static void wake(std::atomic<uint32_t>& seq, std::atomic<uint32_t>& waiters)
+{
+    seq.fetch_add(1);
+    if (waiters.load() == 0)
+        return;
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq), FUTEX_WAKE, INT32_MAX, 0, 0, 0);
+#endif
+}
+
+void buffer_shm::attach(uint64_t position)
+{
+    gr::thread::scoped_lock guard(*mutex());
+
+    // Restarted in this process: the items still in the buffer stay
+    // where they are.
+    if (d_attached) {
+        d_offset = d_position - d_abs_write_offset;
+        return;
+    }
+
+    // Move the window onto the ring so that the write index is at the
+    // ring position of the next item.
+    const uint64_t shift = (position % d_bufsize + d_bufsize - d_write_index) % d_bufsize;
+    d_base = d_ring + shift * d_sizeof_item;
+    d_offset = position - d_abs_write_offset;
+    d_attached = true;
+}
+
+void buffer_shm::detach()
+{
+    gr::thread::scoped_lock guard(*mutex());
+    d_position = d_offset + d_abs_write_offset;
+}
+
+void buffer_shm::attach_producer()
+{
+    d_header->producer.store(getpid());
+
+    // Items the consumer read but keeps as history are not waited for;
+    // it only looks at them again with the items that follow.
+    uint64_t position = published();
+    while (true) {
+        const uint32_t seq = sequence();
+        if (d_header->read.load() >= position)
+            break;
+
+        if (consumer_gone()) {
+            d_logger->warn("{:s}: dropping {:d} items of a consumer that is gone",
+                           d_name,
+                           position - released());
+            release(position, position);
+            break;
+        }
+        wait(seq, 10000);
+    }
+
+    d_header->eof.store(0);
+    attach(position);
+}
+
+void buffer_shm::attach_consumer()
+{
+    d_header->consumer.store(getpid());
+    d_tags_next = d_header->tags_popped.load();
+    attach(d_header->read.load());
+}
+
+void buffer_shm::detach_producer(bool eof)
+{
+    if (eof)
+        d_header->eof.store(1);
+    d_header->producer.store(0);
+    publish(published());
+    detach();
+}
+
+void buffer_shm::detach_consumer()
+{
+    d_header->consumer.store(0);
+    wake(d_header->seq, d_header->waiters);
+    detach();
+}
+
+uint64_t buffer_shm::published() const
+{
+    return d_header->published.load(std::memory_order_acquire);
+}
+
+uint64_t buffer_shm::released() const
+{
+    return d_header->released.load(std::memory_order_acquire);
+}
+
+bool buffer_shm::eof() const { return d_header->eof.load() != 0; }
+
+uint32_t buffer_shm::sequence() const { return d_header->seq.load(); }
+
+void buffer_shm::publish(uint64_t nitems)
+{
+    d_header->published.store(nitems, std::memory_order_release);
+    wake(d_header->seq, d_header->waiters);
+}
+
+void buffer_shm::release(uint64_t nitems, uint64_t nread)
+{
+    uint64_t current = d_header->released.load();
+    while (current < nitems &&
+           !d_header->released.compare_exchange_weak(current, nitems)) {
+    }
+    current = d_header->read.load();
+    while (current < nread && !d_header->read.compare_exchange_weak(current, nread)) {
+    }
+
+    // Tags of items not read yet are taken again by a restarted consumer
+    const tag_slot* slots = reinterpret_cast<const tag_slot*>(d_header + 1);
+    uint64_t popped = d_header->tags_popped.load();
+    while (popped < d_tags_next && slots[popped % NTAG_SLOTS].offset < nread)
+        popped++;
+    d_header->tags_popped.store(popped, std::memory_order_release);
+    wake(d_header->seq, d_header->waiters);
+}
+
+void buffer_shm::wait(uint32_t seq, int timeout_us)
+{
+    boost::this_thread::interruption_point();
+
+    d_header->waiters.fetch_add(1);
+    if (d_header->seq.load() == seq) {
+#ifdef __linux__
+        struct timespec timeout = { timeout_us / 1000000, (timeout_us % 1000000) * 1000 };
+        syscall(SYS_futex,
+                reinterpret_cast<uint32_t*>(&d_header->seq),
+                FUTEX_WAIT,
+                seq,
+                &timeout,
+                0,
+                0);
+#else
+        boost::this_thread::sleep_for(
+            boost::chrono::microseconds(std::min(timeout_us, 100)));
+#endif
+    }
+    d_header->waiters.fetch_sub(1);
+
+    boost::this_thread::interruption_point();
+}
+
+size_t buffer_shm::push_tags(const std::vector<tag_t>& tags)
+{
+    tag_slot* slots = reinterpret_cast<tag_slot*>(d_header + 1);
+    size_t dropped = 0;
+
+    uint64_t pushed = d_header->tags_pushed.load();
+    for (const tag_t& tag : tags) {
+        const std::string data =
+            pmt::serialize_str(pmt::make_tuple(tag.key, tag.value, tag.srcid));
+        if (data.size() > sizeof(tag_slot::data) ||
+            pushed - d_header->tags_popped.load() >= NTAG_SLOTS) {
+            dropped++;
+            continue;
+        }
+
+        tag_slot& slot = slots[pushed % NTAG_SLOTS];
+        slot.offset = tag.offset;
+        slot.size = data.size();
+        memcpy(slot.data, data.data(), data.size());
+        d_header->tags_pushed.store(++pushed, std::memory_order_release);
+    }
+    return dropped;
+}
+
+void buffer_shm::pop_tags(uint64_t start, uint64_t end, std::vector<tag_t>& tags)
+{
+    const tag_slot* slots = reinterpret_cast<const tag_slot*>(d_header + 1);
+
+    const uint64_t pushed = d_header->tags_pushed.load(std::memory_order_acquire);
+    for (; d_tags_next < pushed; d_tags_next++) {
+        const tag_slot& slot = slots[d_tags_next % NTAG_SLOTS];
+        if (slot.offset >= end)
+            break;
+        if (slot.offset < start)
+            continue;
+
+        pmt::pmt_t tuple = pmt::deserialize_str(std::string(slot.data, slot.size));
+        tag_t tag;
+        tag.offset = slot.offset;
+        tag.key = pmt::tuple_ref(tuple, 0);
+        tag.value = pmt::tuple_ref(tuple, 1);
+        tag.srcid = pmt::tuple_ref(tuple, 2);
+        tags.push_back(tag);
+    }
+}
+
+} /* namespace gr */
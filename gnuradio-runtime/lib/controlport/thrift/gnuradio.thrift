@@ -84,6 +84,25 @@ typedef map<string, Knob> KnobMap
 typedef map<string, KnobProp> KnobPropMap
 typedef map<string, string> WaveformArgMap
 
+/*
+ * Snapshots of subscribed knobs are pushed to a StreamReceiver as
+ * frames in a compact binary format instead of KnobMaps. All numbers
+ * are little-endian; a frame starts with a header of
+ *
+ *   u8 version (1), u8 kind, i32 subscription, u32 sequence,
+ *   i64 time (ns since the epoch), u32 count
+ *
+ * A frame of kind 0 lists the names of the count knobs of the
+ * subscription, each as u16 length and UTF-8 bytes. It is sent first
+ * and again whenever the set of matching knobs changes.
+ *
+ * A frame of kind 1 holds the values of the knobs, in the same order.
+ * Each value is a u8 BaseTypes code followed by the value: i64 for
+ * BOOL and LONG, f64 for DOUBLE, two f64 for COMPLEX, or a u32 length
+ * followed by the elements for STRING and the vectors, with complex
+ * elements as two f32. Code 255 marks a value that could not be
+ * encoded and has no data.
+ */
 service StreamReceiver {
         void push(1:VectorC data);
 }
@@ -94,5 +113,7 @@ service ControlPort {
         KnobMap getRe(1:KnobIDList knobs);
         KnobPropMap properties(1:KnobIDList knobs);
         void postMessage(1:string blk_alias, 2:string port, 3:binary msg);
+        i32 subscribe(1:KnobIDList knobs, 2:i32 period_ms, 3:string host, 4:i32 port);
+        void unsubscribe(1:i32 id);
         void shutdown();
 }
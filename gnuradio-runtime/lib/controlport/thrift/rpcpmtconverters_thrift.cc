@@ -11,6 +11,9 @@
 #include <gnuradio/gr_complex.h>
 #include <gnuradio/logger.h>
 #include <gnuradio/rpcpmtconverters_thrift.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 GNURadio::Knob rpcpmtconverter::from_pmt(const pmt::pmt_t& knob)
 {
@@ -265,3 +268,136 @@ pmt::pmt_t rpcpmtconverter::To_PMT::operator()(const GNURadio::Knob& knob)
 {
     return to_pmt_map[knob.type](knob);
 }
+
+template <typename T>
+void rpcpmtconverter::snapshot_writer::put(T value)
+{
+    static_assert(std::is_integral<T>::value, "only integers are written directly");
+    typedef typename std::make_unsigned<T>::type U;
+    U bits = static_cast<U>(value);
+    for (size_t i = 0; i < sizeof(T); i++) {
+        d_data.push_back(static_cast<char>(bits & 0xff));
+        bits = static_cast<U>(bits >> 8);
+    }
+}
+
+template <>
+void rpcpmtconverter::snapshot_writer::put<float>(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(bits);
+}
+
+template <>
+void rpcpmtconverter::snapshot_writer::put<double>(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(bits);
+}
+
+void rpcpmtconverter::snapshot_writer::put_size(size_t size)
+{
+    put(static_cast<uint32_t>(size));
+}
+
+void rpcpmtconverter::snapshot_writer::begin(kind_t kind,
+                                             int32_t subscription,
+                                             uint32_t sequence,
+                                             int64_t time_ns,
+                                             uint32_t count)
+{
+    d_data.clear();
+    put(uint8_t(1));
+    put(static_cast<uint8_t>(kind));
+    put(subscription);
+    put(sequence);
+    put(time_ns);
+    put(count);
+}
+
+void rpcpmtconverter::snapshot_writer::append_name(const std::string& name)
+{
+    const size_t size = std::min<size_t>(name.size(), UINT16_MAX);
+    put(static_cast<uint16_t>(size));
+    d_data.append(name, 0, size);
+}
+
+void rpcpmtconverter::snapshot_writer::append_value(const pmt::pmt_t& knob)
+{
+    size_t size;
+    if (pmt::is_real(knob)) {
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::DOUBLE));
+        put(pmt::to_double(knob));
+    } else if (pmt::is_symbol(knob)) {
+        const std::string value = pmt::symbol_to_string(knob);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::STRING));
+        put_size(value.size());
+        d_data.append(value);
+    } else if (pmt::is_integer(knob)) {
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::LONG));
+        put(static_cast<int64_t>(pmt::to_long(knob)));
+    } else if (pmt::is_bool(knob)) {
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::BOOL));
+        put(static_cast<int64_t>(pmt::to_bool(knob)));
+    } else if (pmt::is_uint64(knob)) {
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::LONG));
+        put(static_cast<int64_t>(pmt::to_uint64(knob)));
+    } else if (pmt::is_complex(knob)) {
+        const std::complex<double> value = pmt::to_complex(knob);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::COMPLEX));
+        put(value.real());
+        put(value.imag());
+    } else if (pmt::is_f32vector(knob)) {
+        const float* start = pmt::f32vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::F32VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i]);
+        }
+    } else if (pmt::is_f64vector(knob)) {
+        const double* start = pmt::f64vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::F64VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i]);
+        }
+    } else if (pmt::is_s64vector(knob)) {
+        const int64_t* start = pmt::s64vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::S64VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i]);
+        }
+    } else if (pmt::is_s32vector(knob)) {
+        const int32_t* start = pmt::s32vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::S32VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i]);
+        }
+    } else if (pmt::is_s16vector(knob)) {
+        const int16_t* start = pmt::s16vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::S16VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i]);
+        }
+    } else if (pmt::is_s8vector(knob)) {
+        const int8_t* start = pmt::s8vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::S8VECTOR));
+        put_size(size);
+        d_data.append(reinterpret_cast<const char*>(start), size);
+    } else if (pmt::is_c32vector(knob)) {
+        const gr_complex* start = pmt::c32vector_elements(knob, size);
+        put(static_cast<uint8_t>(GNURadio::BaseTypes::C32VECTOR));
+        put_size(size);
+        for (size_t i = 0; i < size; i++) {
+            put(start[i].real());
+            put(start[i].imag());
+        }
+    } else {
+        put(UNSUPPORTED);
+    }
+}
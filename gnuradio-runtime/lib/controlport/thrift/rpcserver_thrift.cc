@@ -9,11 +9,14 @@
  */
 
 #include "thrift/ControlPort.h"
+#include "thrift/StreamReceiver.h"
 #include <gnuradio/rpcserver_thrift.h>
 #include <pmt/pmt.h>
 #include <thrift/protocol/TBinaryProtocol.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TTransportUtils.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <regex>
 #include <sstream>
@@ -36,6 +39,14 @@ rpcserver_thrift::rpcserver_thrift()
 rpcserver_thrift::~rpcserver_thrift()
 {
     // std::cerr << "rpcserver_thrift::dtor" ;
+    {
+        std::scoped_lock lock(d_stream_lock);
+        d_stream_done = true;
+    }
+    d_stream_cond.notify_all();
+    if (d_stream_thread.joinable()) {
+        d_stream_thread.join();
+    }
 }
 
 void rpcserver_thrift::registerConfigureCallback(const std::string& id,
@@ -103,6 +114,7 @@ void rpcserver_thrift::registerQueryCallback(const std::string& id,
         GR_LOG_INFO(d_debug_logger, msg.str());
     }
     d_getcallbackmap.insert(QueryCallbackMap_t::value_type(id, callback));
+    d_query_generation++;
 }
 
 void rpcserver_thrift::unregisterQueryCallback(const std::string& id)
@@ -123,6 +135,7 @@ void rpcserver_thrift::unregisterQueryCallback(const std::string& id)
     }
 
     d_getcallbackmap.erase(iter);
+    d_query_generation++;
 }
 
 
@@ -272,6 +285,189 @@ void rpcserver_thrift::postMessage(const std::string& alias,
     }
 }
 
+struct rpcserver_thrift::subscription {
+    int32_t id;
+    std::vector<std::regex> patterns;
+    std::chrono::steady_clock::duration period;
+    std::chrono::steady_clock::time_point next;
+
+    std::shared_ptr<apache::thrift::transport::TTransport> transport;
+    std::unique_ptr<GNURadio::StreamReceiverClient> client;
+
+    // Knobs matching the patterns as of d_query_generation == generation
+    uint64_t generation = UINT64_MAX;
+    std::vector<std::string> names;
+    std::vector<gr::messages::msg_producer_sptr> producers;
+    std::vector<pmt::pmt_t> values;
+
+    uint32_t sequence = 0;
+    snapshot_writer writer;
+
+    ~subscription()
+    {
+        if (transport) {
+            transport->close();
+        }
+    }
+};
+
+int32_t rpcserver_thrift::subscribe(const GNURadio::KnobIDList& knobs,
+                                    const int32_t period_ms,
+                                    const std::string& host,
+                                    const int32_t port)
+{
+    if (period_ms <= 0) {
+        throw apache::thrift::TApplicationException(
+            "rpcserver_thrift: subscription period must be positive");
+    }
+
+    auto sub = std::make_shared<subscription>();
+    for (const std::string& knob : knobs) {
+        sub->patterns.emplace_back(knob);
+    }
+    sub->period = std::chrono::milliseconds(period_ms);
+
+    // Connect to the receiver before taking any lock.
+    auto socket = std::make_shared<apache::thrift::transport::TSocket>(host, port);
+    sub->transport = std::make_shared<apache::thrift::transport::TBufferedTransport>(socket);
+    sub->client = std::make_unique<GNURadio::StreamReceiverClient>(
+        std::make_shared<apache::thrift::protocol::TBinaryProtocol>(sub->transport));
+    sub->transport->open();
+
+    std::scoped_lock lock(d_stream_lock);
+    sub->id = d_next_subscription++;
+    sub->next = std::chrono::steady_clock::now();
+    d_subscriptions[sub->id] = sub;
+    if (!d_stream_thread.joinable()) {
+        d_stream_thread = std::thread([this] { stream_loop(); });
+    }
+    d_stream_cond.notify_one();
+
+    if (DEBUG) {
+        std::ostringstream msg;
+        msg << "subscription " << sub->id << " streaming to " << host << ":" << port;
+        GR_LOG_INFO(d_debug_logger, msg.str());
+    }
+    return sub->id;
+}
+
+void rpcserver_thrift::unsubscribe(const int32_t id)
+{
+    std::scoped_lock lock(d_stream_lock);
+    if (d_subscriptions.erase(id) == 0) {
+        std::stringstream s;
+        s << "rpcserver_thrift: unsubscribe from unknown subscription " << id;
+        throw apache::thrift::TApplicationException(s.str());
+    }
+}
+
+void rpcserver_thrift::stream_loop()
+{
+    std::unique_lock<std::mutex> lock(d_stream_lock);
+    while (!d_stream_done) {
+        if (d_subscriptions.empty()) {
+            d_stream_cond.wait(lock);
+            continue;
+        }
+
+        // Serve the subscription that is due first.
+        const std::shared_ptr<subscription> sub =
+            std::min_element(d_subscriptions.begin(),
+                             d_subscriptions.end(),
+                             [](const SubscriptionMap_t::value_type& a,
+                                const SubscriptionMap_t::value_type& b) {
+                                 return a.second->next < b.second->next;
+                             })
+                ->second;
+        const auto now = std::chrono::steady_clock::now();
+        if (now < sub->next) {
+            d_stream_cond.wait_until(lock, sub->next);
+            continue;
+        }
+
+        // Keep the rate fixed, but skip periods we could not keep up with.
+        sub->next += sub->period;
+        if (sub->next < now) {
+            sub->next = now + sub->period;
+        }
+
+        lock.unlock();
+        const bool pushed = push_snapshot(*sub);
+        lock.lock();
+        if (!pushed) {
+            d_subscriptions.erase(sub->id);
+        }
+    }
+}
+
+void rpcserver_thrift::resolve_knobs(subscription& sub)
+{
+    sub.names.clear();
+    sub.producers.clear();
+    for (const auto& knob : d_getcallbackmap) {
+        if (cur_priv > knob.second.priv) {
+            continue;
+        }
+        for (const std::regex& re : sub.patterns) {
+            if (std::regex_match(knob.first, re)) {
+                sub.names.push_back(knob.first);
+                sub.producers.push_back(knob.second.callback);
+                break;
+            }
+        }
+    }
+    sub.values.resize(sub.producers.size());
+    sub.generation = d_query_generation;
+}
+
+bool rpcserver_thrift::push_snapshot(subscription& sub)
+{
+    bool new_layout = false;
+    {
+        // The map lock keeps blocks from removing their knobs while they
+        // are read; the values themselves are read without locking.
+        std::scoped_lock lock(d_callback_map_lock);
+        if (sub.generation != d_query_generation) {
+            resolve_knobs(sub);
+            new_layout = true;
+        }
+        for (size_t i = 0; i < sub.producers.size(); i++) {
+            sub.values[i] = sub.producers[i]->retrieve();
+        }
+    }
+
+    const int64_t time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+    try {
+        if (new_layout) {
+            sub.writer.begin(snapshot_writer::LAYOUT,
+                             sub.id,
+                             sub.sequence++,
+                             time_ns,
+                             sub.names.size());
+            for (const std::string& name : sub.names) {
+                sub.writer.append_name(name);
+            }
+            sub.client->push(sub.writer.data());
+        }
+
+        sub.writer.begin(snapshot_writer::VALUES,
+                         sub.id,
+                         sub.sequence++,
+                         time_ns,
+                         sub.values.size());
+        for (const pmt::pmt_t& value : sub.values) {
+            sub.writer.append_value(value);
+        }
+        sub.client->push(sub.writer.data());
+    } catch (const apache::thrift::TException& e) {
+        d_logger->warn("dropping subscription {:d}: {:s}", sub.id, e.what());
+        return false;
+    }
+    return true;
+}
+
 void rpcserver_thrift::shutdown()
 {
     if (DEBUG) {
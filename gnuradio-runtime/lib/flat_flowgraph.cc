@@ -21,6 +21,7 @@
 #include <gnuradio/logger.h>
 #include <gnuradio/prefs.h>
 #include <volk/volk.h>
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <numeric>
@@ -273,12 +274,7 @@ void flat_flowgraph::merge_connections(flat_flowgraph_sptr old_ffg)
          old_edge++) {
         d_debug_logger->debug("merge: testing old edge {:s}...", old_edge->identifier());
 
-        edge_viter_t new_edge;
-        for (new_edge = d_edges.begin(); new_edge != d_edges.end(); new_edge++)
-            if (new_edge->src() == old_edge->src() && new_edge->dst() == old_edge->dst())
-                break;
-
-        if (new_edge == d_edges.end()) { // not found in new edge list
+        if (!has_edge_p(*old_edge)) { // not found in new edge list
             d_debug_logger->debug("not in new edge list");
             // zero the buffer reader on RHS of old edge
             block_sptr block(cast_to_block_sptr(old_edge->dst().block()));
@@ -357,6 +353,142 @@ void flat_flowgraph::merge_connections(flat_flowgraph_sptr old_ffg)
     }
 }
 
+basic_block_vector_t flat_flowgraph::calc_changed_blocks(flat_flowgraph_sptr old_ffg)
+{
+    basic_block_vector_t changed;
+
+    for (const edge& e : d_edges) {
+        if (!old_ffg->has_edge_p(e)) {
+            changed.push_back(e.src().block());
+            changed.push_back(e.dst().block());
+        }
+    }
+    for (const edge& e : old_ffg->d_edges) {
+        if (!has_edge_p(e)) {
+            changed.push_back(e.src().block());
+            changed.push_back(e.dst().block());
+        }
+    }
+
+    // Blocks only connected through message ports
+    for (const basic_block_sptr& block : d_blocks) {
+        if (!old_ffg->has_block_p(block))
+            changed.push_back(block);
+    }
+    for (const basic_block_sptr& block : old_ffg->d_blocks) {
+        if (!has_block_p(block))
+            changed.push_back(block);
+    }
+
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+bool flat_flowgraph::merge_changed_connections(flat_flowgraph_sptr old_ffg,
+                                               const basic_block_vector_t& changed)
+{
+    for (const basic_block_sptr& p : changed) {
+        block_sptr block = cast_to_block_sptr(p);
+        if (!has_block_p(p) || !block->detail())
+            continue;
+
+        int ninputs = calc_used_ports(p, true).size();
+        int noutputs = calc_used_ports(p, false).size();
+        if (ninputs != block->detail()->ninputs() ||
+            noutputs != block->detail()->noutputs()) {
+            d_debug_logger->debug("merge: ports of {:s} changed", block->identifier());
+            return false;
+        }
+    }
+
+    // Clear the buffer readers on the RHS of the old edges going away;
+    // both ends of these are changed blocks.
+    for (const basic_block_sptr& p : changed) {
+        if (!old_ffg->has_block_p(p))
+            continue;
+
+        for (const edge& e : old_ffg->calc_upstream_edges(p)) {
+            if (!has_edge_p(e)) {
+                d_debug_logger->debug("merge: dropping edge {:s}", e.identifier());
+                block_sptr block = cast_to_block_sptr(e.dst().block());
+                block->detail()->set_input(e.dst().port(), buffer_reader_sptr());
+            }
+        }
+    }
+
+    for (const basic_block_sptr& p : changed) {
+        block_sptr block = cast_to_block_sptr(p);
+        if (has_block_p(p) && !block->detail()) {
+            d_debug_logger->debug("merge: allocating new detail for block {:s}",
+                                  block->identifier());
+            allocate_block_detail(block);
+        }
+    }
+
+    for (const basic_block_sptr& p : changed) {
+        if (!has_block_p(p))
+            continue;
+
+        block_sptr block = cast_to_block_sptr(p);
+        if (!old_ffg->has_block_p(p)) {
+            d_debug_logger->debug("merge: connecting new block {:s}",
+                                  block->identifier());
+            connect_block_inputs(block);
+
+            // Its readers start at the write position of buffers that keep
+            // running, whose tags other readers still need. Count the items
+            // of its new outputs on from there, so that tags stay lined up.
+            block_detail_sptr detail = block->detail();
+            const uint64_t nread = detail->ninputs() > 0 ? detail->nitems_read(0) : 0;
+            const uint64_t nwritten =
+                nread * block->relative_rate_i() / block->relative_rate_d();
+            for (int o = 0; o < detail->noutputs(); o++)
+                detail->output(o)->reset_nitem_counter(nwritten);
+            block->set_unaligned(0);
+            block->set_is_unaligned(false);
+            continue;
+        }
+
+        // Keep the readers of the inputs that are still connected to the
+        // same buffer, with the items not read yet.
+        block_detail_sptr detail = block->detail();
+        for (int i = 0; i < detail->ninputs(); i++) {
+            edge e = calc_upstream_edge(p, i);
+            block_sptr src_block = cast_to_block_sptr(e.src().block());
+            buffer_sptr src_buffer = src_block->detail()->output(e.src().port());
+            buffer_reader_sptr old_reader = detail->input(i);
+            if (old_reader && src_buffer == old_reader->buffer())
+                continue;
+
+            d_debug_logger->debug("merge: new reader for {:s}:{:d}",
+                                  block->identifier(),
+                                  i);
+            detail->set_input(i,
+                              buffer_add_reader(src_buffer,
+                                                block->history() - 1,
+                                                block,
+                                                block->sample_delay(e.src().port())));
+        }
+    }
+
+    // Subscribe the message connections that are new; the ones removed
+    // were unsubscribed by msg_disconnect.
+    for (const msg_edge& e : d_msg_edges) {
+        const auto old_edge = std::find_if(
+            old_ffg->d_msg_edges.begin(),
+            old_ffg->d_msg_edges.end(),
+            [&e](const msg_edge& o) { return o.src() == e.src() && o.dst() == e.dst(); });
+        if (old_edge != old_ffg->d_msg_edges.end())
+            continue;
+
+        e.src().block()->message_port_sub(
+            e.src().port(), pmt::cons(e.dst().block()->alias_pmt(), e.dst().port()));
+    }
+
+    return true;
+}
+
 void flat_flowgraph::setup_buffer_alignment(block_sptr block)
 {
     const int alignment = volk_get_alignment();
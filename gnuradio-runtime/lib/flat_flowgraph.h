@@ -41,6 +41,26 @@ public:
     // Merge applicable connections from existing flat flowgraph
     void merge_connections(flat_flowgraph_sptr sfg);
 
+    /*!
+     * Calculate the blocks whose stream connections differ from those
+     * in \p old_ffg, including the blocks that were added or removed.
+     */
+    basic_block_vector_t calc_changed_blocks(flat_flowgraph_sptr old_ffg);
+
+    /*!
+     * Merge the connections of the \p changed blocks from \p old_ffg,
+     * leaving the details and buffer readers of all other blocks as
+     * they are, so that those can keep running.
+     *
+     * Returns false without changing anything if the number of ports
+     * in use of a changed block that keeps its detail is different;
+     * merge_connections has to be used then.
+     */
+    bool merge_changed_connections(flat_flowgraph_sptr old_ffg,
+                                   const basic_block_vector_t& changed);
+
+    using flowgraph::has_block_p;
+
     // Return a string list of edges
     std::string edge_list();
 
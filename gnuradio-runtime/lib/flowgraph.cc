@@ -13,6 +13,7 @@
 #endif
 
 #include <gnuradio/flowgraph.h>
+#include <algorithm>
 #include <iterator>
 #include <sstream>
 #include <stdexcept>
@@ -52,21 +53,42 @@ void flowgraph::connect(const endpoint& src, const endpoint& dst)
     check_type_match(src, dst);
 
     // Alles klar, Herr Kommissar
-    d_edges.push_back(edge(src, dst));
+    const edge e(src, dst);
+    d_edges.push_back(e);
+    d_block_edges[src.block()].out.push_back(e);
+    d_block_edges[dst.block()].in.push_back(e);
+    d_upstream.emplace(dst, src);
+}
+
+template <class T>
+static void erase_edge(std::vector<T>& edges, const T& e)
+{
+    edges.erase(std::find_if(edges.begin(), edges.end(), [&e](const T& other) {
+        return other.src() == e.src() && other.dst() == e.dst();
+    }));
 }
 
 void flowgraph::disconnect(const endpoint& src, const endpoint& dst)
 {
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++) {
-        if (src == p->src() && dst == p->dst()) {
-            d_edges.erase(p);
-            return;
-        }
+    const auto upstream = d_upstream.find(dst);
+    if (upstream == d_upstream.end() || !(upstream->second == src)) {
+        std::stringstream msg;
+        msg << "cannot disconnect edge " << edge(src, dst) << ", not found";
+        throw std::invalid_argument(msg.str());
     }
 
-    std::stringstream msg;
-    msg << "cannot disconnect edge " << edge(src, dst) << ", not found";
-    throw std::invalid_argument(msg.str());
+    const edge e(src, dst);
+    d_upstream.erase(upstream);
+    erase_edge(d_edges, e);
+    erase_edge(d_block_edges[src.block()].out, e);
+    erase_edge(d_block_edges[dst.block()].in, e);
+    for (const basic_block_sptr& block : { src.block(), dst.block() }) {
+        const auto edges = d_block_edges.find(block);
+        if (edges != d_block_edges.end() && edges->second.in.empty() &&
+            edges->second.out.empty()) {
+            d_block_edges.erase(edges);
+        }
+    }
 }
 
 void flowgraph::validate()
@@ -101,6 +123,8 @@ void flowgraph::clear()
     // Boost shared pointers will deallocate as needed
     d_blocks.clear();
     d_edges.clear();
+    d_block_edges.clear();
+    d_upstream.clear();
 }
 
 void flowgraph::check_valid_port(gr::io_signature::sptr sig, int port)
@@ -142,12 +166,12 @@ void flowgraph::check_valid_port(const msg_endpoint& e)
 void flowgraph::check_dst_not_used(const endpoint& dst)
 {
     // A destination is in use if it is already on the edge list
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++)
-        if (p->dst() == dst) {
-            std::stringstream msg;
-            msg << "destination already in use by edge " << (*p);
-            throw std::invalid_argument(msg.str());
-        }
+    const auto upstream = d_upstream.find(dst);
+    if (upstream != d_upstream.end()) {
+        std::stringstream msg;
+        msg << "destination already in use by edge " << edge(upstream->second, dst);
+        throw std::invalid_argument(msg.str());
+    }
 }
 
 void flowgraph::check_type_match(const endpoint& src, const endpoint& dst)
@@ -184,17 +208,26 @@ basic_block_vector_t flowgraph::calc_used_blocks()
     return unique_vector<basic_block_sptr>(tmp);
 }
 
+const flowgraph::block_edges&
+flowgraph::find_block_edges(const basic_block_sptr& block) const
+{
+    static const block_edges unconnected;
+    const auto edges = d_block_edges.find(block);
+    return edges == d_block_edges.end() ? unconnected : edges->second;
+}
+
 std::vector<int> flowgraph::calc_used_ports(basic_block_sptr block, bool check_inputs)
 {
     std::vector<int> tmp;
 
     // Collect all seen ports
-    edge_vector_t edges = calc_connections(block, check_inputs);
-    for (edge_viter_t p = edges.begin(); p != edges.end(); p++) {
-        if (check_inputs == true)
-            tmp.push_back(p->dst().port());
-        else
-            tmp.push_back(p->src().port());
+    const block_edges& edges = find_block_edges(block);
+    if (check_inputs == true) {
+        for (const edge& e : edges.in)
+            tmp.push_back(e.dst().port());
+    } else {
+        for (const edge& e : edges.out)
+            tmp.push_back(e.src().port());
     }
 
     return unique_vector<int>(tmp);
@@ -202,19 +235,8 @@ std::vector<int> flowgraph::calc_used_ports(basic_block_sptr block, bool check_i
 
 edge_vector_t flowgraph::calc_connections(basic_block_sptr block, bool check_inputs)
 {
-    edge_vector_t result;
-
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++) {
-        if (check_inputs) {
-            if (p->dst().block() == block)
-                result.push_back(*p);
-        } else {
-            if (p->src().block() == block)
-                result.push_back(*p);
-        }
-    }
-
-    return result; // assumes no duplicates
+    const block_edges& edges = find_block_edges(block);
+    return check_inputs ? edges.in : edges.out; // assumes no duplicates
 }
 
 void flowgraph::check_contiguity(basic_block_sptr block,
@@ -262,9 +284,9 @@ basic_block_vector_t flowgraph::calc_downstream_blocks(basic_block_sptr block, i
 {
     basic_block_vector_t tmp;
 
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++)
-        if (p->src() == endpoint(block, port))
-            tmp.push_back(p->dst().block());
+    for (const edge& e : find_block_edges(block).out)
+        if (e.src().port() == port)
+            tmp.push_back(e.dst().block());
 
     return unique_vector<basic_block_sptr>(tmp);
 }
@@ -273,91 +295,72 @@ basic_block_vector_t flowgraph::calc_downstream_blocks(basic_block_sptr block)
 {
     basic_block_vector_t tmp;
 
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++)
-        if (p->src().block() == block)
-            tmp.push_back(p->dst().block());
+    for (const edge& e : find_block_edges(block).out)
+        tmp.push_back(e.dst().block());
 
     return unique_vector<basic_block_sptr>(tmp);
 }
 
 edge_vector_t flowgraph::calc_upstream_edges(basic_block_sptr block)
 {
-    edge_vector_t result;
-
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++)
-        if (p->dst().block() == block)
-            result.push_back(*p);
-
-    return result; // Assume no duplicates
+    return find_block_edges(block).in; // Assume no duplicates
 }
 
 bool flowgraph::has_block_p(basic_block_sptr block)
 {
-    basic_block_viter_t result;
-    result = std::find(d_blocks.begin(), d_blocks.end(), block);
-    return (result != d_blocks.end());
+    // d_blocks is sorted by calc_used_blocks
+    return std::binary_search(d_blocks.begin(), d_blocks.end(), block);
 }
 
-edge flowgraph::calc_upstream_edge(basic_block_sptr block, int port)
+bool flowgraph::has_edge_p(const edge& e) const
 {
-    edge result;
+    const auto upstream = d_upstream.find(e.dst());
+    return upstream != d_upstream.end() && upstream->second == e.src();
+}
 
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++) {
-        if (p->dst() == endpoint(block, port)) {
-            result = (*p);
-            break;
-        }
-    }
+edge flowgraph::calc_upstream_edge(basic_block_sptr block, int port)
+{
+    const endpoint dst(block, port);
+    const auto upstream = d_upstream.find(dst);
+    if (upstream == d_upstream.end())
+        return edge();
 
-    return result;
+    return edge(upstream->second, dst);
 }
 
 std::vector<basic_block_vector_t> flowgraph::partition()
 {
     std::vector<basic_block_vector_t> result;
     basic_block_vector_t blocks = calc_used_blocks();
-    basic_block_vector_t graph;
-
-    while (!blocks.empty()) {
-        graph = calc_reachable_blocks(blocks[0], blocks);
-        assert(graph.size());
-        result.push_back(topological_sort(graph));
-
-        for (basic_block_viter_t p = graph.begin(); p != graph.end(); p++)
-            blocks.erase(find(blocks.begin(), blocks.end(), *p));
-    }
-
-    return result;
-}
-
-basic_block_vector_t flowgraph::calc_reachable_blocks(basic_block_sptr block,
-                                                      basic_block_vector_t& blocks)
-{
-    basic_block_vector_t result;
 
     // Mark all blocks as unvisited
     for (basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++)
         (*p)->set_color(basic_block::WHITE);
 
-    // Recursively mark all reachable blocks
-    reachable_dfs_visit(block, blocks);
+    // Each block not reached from an earlier one starts a new partition.
+    // Sorting leaves all blocks of a partition BLACK.
+    for (basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++) {
+        if ((*p)->color() != basic_block::WHITE)
+            continue;
 
-    // Collect all the blocks that have been visited
-    for (basic_block_viter_t p = blocks.begin(); p != blocks.end(); p++)
-        if ((*p)->color() == basic_block::BLACK)
-            result.push_back(*p);
+        basic_block_vector_t graph;
+        reachable_dfs_visit(*p, graph);
+        std::sort(graph.begin(), graph.end());
+        result.push_back(topological_sort(graph));
+    }
 
     return result;
 }
 
-// Recursively mark all reachable blocks from given block and block list
+// Recursively mark and collect all blocks reachable from the given block
 void flowgraph::reachable_dfs_visit(basic_block_sptr block, basic_block_vector_t& blocks)
 {
     // Mark the current one as visited
     block->set_color(basic_block::BLACK);
+    blocks.push_back(block);
 
     // Recurse into adjacent vertices
-    basic_block_vector_t adjacent = calc_adjacent_blocks(block, blocks);
+    basic_block_vector_t adjacent = calc_adjacent_blocks(block);
 
     for (basic_block_viter_t p = adjacent.begin(); p != adjacent.end(); p++)
         if ((*p)->color() == basic_block::WHITE)
@@ -365,18 +368,16 @@ void flowgraph::reachable_dfs_visit(basic_block_sptr block, basic_block_vector_t
 }
 
 // Return a list of block adjacent to a given block along any edge
-basic_block_vector_t flowgraph::calc_adjacent_blocks(basic_block_sptr block,
-                                                     basic_block_vector_t& blocks)
+basic_block_vector_t flowgraph::calc_adjacent_blocks(basic_block_sptr block)
 {
     basic_block_vector_t tmp;
 
     // Find any blocks that are inputs or outputs
-    for (edge_viter_t p = d_edges.begin(); p != d_edges.end(); p++) {
-        if (p->src().block() == block)
-            tmp.push_back(p->dst().block());
-        if (p->dst().block() == block)
-            tmp.push_back(p->src().block());
-    }
+    const block_edges& edges = find_block_edges(block);
+    for (const edge& e : edges.out)
+        tmp.push_back(e.dst().block());
+    for (const edge& e : edges.in)
+        tmp.push_back(e.src().block());
 
     return unique_vector<basic_block_sptr>(tmp);
 }
@@ -422,7 +423,7 @@ basic_block_vector_t flowgraph::sort_sources_first(basic_block_vector_t& blocks)
 
 bool flowgraph::source_p(basic_block_sptr block)
 {
-    return calc_upstream_edges(block).empty();
+    return find_block_edges(block).in.empty();
 }
 
 void flowgraph::topological_dfs_visit(basic_block_sptr block,
@@ -14,6 +14,7 @@
 #include "config.h"
 #endif
 
+#include "async_log_sink.h"
 #include <gnuradio/logger.h>
 #include <gnuradio/prefs.h>
 
@@ -55,6 +56,11 @@ logging::logging()
         auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_st>();
         _default_backend->add_sink(console_sink);
     }
+
+    _front = std::make_shared<async_log_sink>(
+        _default_backend, pref->get_long("LOG", "async_queue_size", 1024));
+    _front->set_rate_limit(pref->get_long("LOG", "rate_limit", 0));
+    _front->set_async(pref->get_bool("LOG", "async", false));
 }
 
 void logging::set_default_level(log_level level) { _default_backend->set_level(level); }
@@ -66,7 +72,7 @@ logging& logging::singleton()
     return the_only_one;
 }
 
-spdlog::sink_ptr logging::default_backend() const { return _default_backend; }
+spdlog::sink_ptr logging::default_backend() const { return _front; }
 void logging::add_default_sink(const spdlog::sink_ptr& sink)
 {
     _default_backend->add_sink(sink);
@@ -76,6 +82,18 @@ void logging::add_debug_sink(const spdlog::sink_ptr& sink)
     _debug_backend->add_sink(sink);
 };
 
+void logging::set_async(bool enabled) { _front->set_async(enabled); }
+bool logging::is_async() const { return _front->async(); }
+void logging::set_rate_limit(unsigned int records_per_second)
+{
+    _front->set_rate_limit(records_per_second);
+}
+uint64_t logging::dropped_records() const { return _front->dropped(); }
+bool logging::admit(const void* site, const void* logger)
+{
+    return _front->admit(site, logger);
+}
+
 void logging::add_default_console_sink()
 {
     add_default_sink(std::make_shared<spdlog::sinks::stdout_color_sink_st>());
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#include <gnuradio/random.h>
+#include <gnuradio/xoroshiro128p.h>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+template <typename T>
+void moments(const std::vector<T>& v, double& mean, double& var)
+{
+    double sum = 0.0, sum2 = 0.0;
+    for (const auto x : v) {
+        sum += x;
+        sum2 += static_cast<double>(x) * x;
+    }
+    mean = sum / v.size();
+    var = sum2 / v.size() - mean * mean;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(t_lanes_match_scalar_streams)
+{
+    uint64_t lanes[2 * XOROSHIRO128P_LANES];
+    xoroshiro128p_seed_lanes(lanes, 42);
+
+    uint64_t scalar[XOROSHIRO128P_LANES][2];
+    uint64_t seed_state[2];
+    xoroshiro128p_seed(seed_state, 42);
+    for (unsigned int k = 0; k < XOROSHIRO128P_LANES; k++) {
+        xoroshiro128p_jump(seed_state);
+        scalar[k][0] = seed_state[0];
+        scalar[k][1] = seed_state[1];
+    }
+
+    // odd length to exercise the partial round
+    std::vector<uint64_t> out(5 * XOROSHIRO128P_LANES + 3);
+    xoroshiro128p_fill(lanes, out.data(), out.size());
+    for (size_t i = 0; i < out.size(); i++) {
+        BOOST_CHECK_EQUAL(out[i], xoroshiro128p_next(scalar[i % XOROSHIRO128P_LANES]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(t_fill_uniform)
+{
+    gr::random rng(1);
+    std::vector<float> v(100001);
+    rng.fill_uniform(v.data(), v.size());
+    for (const auto x : v) {
+        BOOST_REQUIRE(x >= 0.0f && x < 1.0f);
+    }
+    double mean, var;
+    moments(v, mean, var);
+    BOOST_CHECK_SMALL(mean - 0.5, 0.01);
+    BOOST_CHECK_SMALL(var - 1.0 / 12, 0.005);
+}
+
+BOOST_AUTO_TEST_CASE(t_fill_gaussian)
+{
+    gr::random rng(2);
+    std::vector<float> v(100001);
+    rng.fill_gaussian(v.data(), v.size());
+    double mean, var;
+    moments(v, mean, var);
+    BOOST_CHECK_SMALL(mean, 0.02);
+    BOOST_CHECK_SMALL(var - 1.0, 0.02);
+
+    std::vector<gr_complex> c(50000);
+    rng.fill_gaussian(c.data(), c.size());
+    std::vector<float> re(c.size()), im(c.size());
+    for (size_t i = 0; i < c.size(); i++) {
+        re[i] = c[i].real();
+        im[i] = c[i].imag();
+    }
+    moments(re, mean, var);
+    BOOST_CHECK_SMALL(mean, 0.02);
+    BOOST_CHECK_SMALL(var - 1.0, 0.03);
+    moments(im, mean, var);
+    BOOST_CHECK_SMALL(mean, 0.02);
+    BOOST_CHECK_SMALL(var - 1.0, 0.03);
+}
+
+BOOST_AUTO_TEST_CASE(t_fill_laplacian)
+{
+    gr::random rng(3);
+    std::vector<float> v(100001);
+    rng.fill_laplacian(v.data(), v.size());
+    double mean, var;
+    moments(v, mean, var);
+    // unit scale Laplacian: variance 2
+    BOOST_CHECK_SMALL(mean, 0.02);
+    BOOST_CHECK_SMALL(var - 2.0, 0.05);
+}
+
+BOOST_AUTO_TEST_CASE(t_fill_reseed)
+{
+    gr::random rng(43);
+    std::vector<float> a(1000), b(1000);
+    rng.fill_gaussian(a.data(), a.size());
+    rng.reseed(43);
+    rng.fill_gaussian(b.data(), b.size());
+    BOOST_CHECK(a == b);
+}
@@ -29,16 +29,34 @@
 
 #include <gnuradio/math.h>
 #include <gnuradio/random.h>
+#include <volk/volk.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 
 namespace gr {
 
+namespace {
+// Number of variates transformed per pass of the fill_* functions; sized so that the
+// scratch buffers stay in L1 cache.
+constexpr size_t BULK_BLOCK = 256;
+
+// 24 bit mantissa scaling, maps the upper bits of a random word into [0, 1)
+constexpr float BULK_SCALE = 1.0f / 16777216.0f;
+
+inline float bulk_hi(uint64_t x) { return static_cast<float>(x >> 40) * BULK_SCALE; }
+inline float bulk_lo(uint64_t x)
+{
+    return static_cast<float>((x >> 8) & 0xffffff) * BULK_SCALE;
+}
+} // namespace
+
 random::random(uint64_t seed, int64_t min_integer, int64_t max_integer)
     : d_rng(seed), d_integer_dis(0, 1)
 {
     d_gauss_stored = false; // set gasdev (gauss distributed numbers) on calculation state
+    xoroshiro128p_seed_lanes(d_lanes, seed);
 
     // Setup random number generators
     set_integer_limits(min_integer, max_integer);
@@ -57,8 +75,10 @@ void random::reseed(uint64_t seed)
         auto now = std::chrono::system_clock::now().time_since_epoch();
         auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
         d_rng.seed(ns);
+        xoroshiro128p_seed_lanes(d_lanes, ns);
     } else {
         d_rng.seed(d_seed);
+        xoroshiro128p_seed_lanes(d_lanes, d_seed);
     }
 }
 
@@ -130,4 +150,102 @@ gr_complex random::rayleigh_complex() { return gr_complex(gasdev(), gasdev()); }
 
 float random::rayleigh() { return sqrtf(-2.0 * logf(ran1())); }
 
+/*
+ * Every 64 bit word yields two 24 bit uniform variates.
+ */
+void random::fill_uniform(float* out, size_t n)
+{
+    uint64_t bits[BULK_BLOCK];
+    while (n > 0) {
+        const size_t nwords = std::min((n + 1) / 2, BULK_BLOCK);
+        const size_t nout = std::min(2 * nwords, n);
+        xoroshiro128p_fill(d_lanes, bits, nwords);
+        for (size_t i = 0; i < nout / 2; i++) {
+            out[2 * i] = bulk_hi(bits[i]);
+            out[2 * i + 1] = bulk_lo(bits[i]);
+        }
+        if (nout & 1) {
+            out[nout - 1] = bulk_hi(bits[nwords - 1]);
+        }
+        out += nout;
+        n -= nout;
+    }
+}
+
+/*
+ * Box-Muller transform: each 64 bit word gives a radius variate in (0, 1] and a phase
+ * variate in [0, 1), which are turned into a pair of independent normal variates. The
+ * transcendental parts run through VOLK over whole blocks.
+ */
+void random::fill_gaussian(gr_complex* out, size_t n)
+{
+    uint64_t bits[BULK_BLOCK];
+    alignas(64) float radius[BULK_BLOCK];
+    alignas(64) float phase[BULK_BLOCK];
+    alignas(64) float c[BULK_BLOCK];
+    alignas(64) float s[BULK_BLOCK];
+
+    while (n > 0) {
+        const size_t nblock = std::min(n, BULK_BLOCK);
+        xoroshiro128p_fill(d_lanes, bits, nblock);
+        for (size_t i = 0; i < nblock; i++) {
+            radius[i] = static_cast<float>((bits[i] >> 40) + 1) * BULK_SCALE;
+            phase[i] = bulk_lo(bits[i]) * static_cast<float>(2.0 * GR_M_PI);
+        }
+        // r = sqrt(-2 ln(u)) = sqrt(-2 ln(2) log2(u))
+        volk_32f_log2_32f(radius, radius, nblock);
+        for (size_t i = 0; i < nblock; i++) {
+            radius[i] *= static_cast<float>(-2.0 * GR_M_LN2);
+        }
+        volk_32f_sqrt_32f(radius, radius, nblock);
+        volk_32f_cos_32f(c, phase, nblock);
+        volk_32f_sin_32f(s, phase, nblock);
+        for (size_t i = 0; i < nblock; i++) {
+            out[i] = gr_complex(radius[i] * c[i], radius[i] * s[i]);
+        }
+        out += nblock;
+        n -= nblock;
+    }
+}
+
+void random::fill_gaussian(float* out, size_t n)
+{
+    gr_complex pairs[BULK_BLOCK / 2];
+    while (n > 0) {
+        const size_t nout = std::min(n, BULK_BLOCK);
+        const size_t npairs = (nout + 1) / 2;
+        fill_gaussian(pairs, npairs);
+        std::copy_n(reinterpret_cast<const float*>(pairs), nout, out);
+        out += nout;
+        n -= nout;
+    }
+}
+
+/*
+ * Same inverse transform as laplacian(), applied to a block at a time; the uniform
+ * variates are centered in their quantization interval to keep the result symmetric.
+ */
+void random::fill_laplacian(float* out, size_t n)
+{
+    uint64_t bits[BULK_BLOCK];
+    alignas(64) float mag[BULK_BLOCK];
+
+    while (n > 0) {
+        const size_t nblock = std::min(n, BULK_BLOCK);
+        xoroshiro128p_fill(d_lanes, bits, nblock);
+        for (size_t i = 0; i < nblock; i++) {
+            const float z = (static_cast<float>(bits[i] >> 40) + 0.5f) * BULK_SCALE;
+            mag[i] = (z > 0.5f) ? 2.0f * (1.0f - z) : 2.0f * z;
+        }
+        volk_32f_log2_32f(mag, mag, nblock);
+        for (size_t i = 0; i < nblock; i++) {
+            // the top bit chose the half of the distribution
+            const float sign = (bits[i] >> 63) ? -1.0f : 1.0f;
+            out[i] = sign * static_cast<float>(GR_M_LN2) * mag[i];
+        }
+        out += nblock;
+        n -= nblock;
+    }
+}
+
 } /* namespace gr */
@@ -256,6 +256,121 @@ static void t3_body()
 }
 
 
+// ----------------------------------------------------------------------------
+// test looking up tags by key, including a delayed reader
+//
+
+static gr::tag_t make_tag(uint64_t offset, const pmt::pmt_t& key)
+{
+    gr::tag_t tag;
+    tag.offset = offset;
+    tag.key = key;
+    return tag;
+}
+
+static void t4_body()
+{
+    int nitems = 4000 / sizeof(int);
+
+    gr::buffer_sptr buf(gr::buffer_double_mapped::make_buffer(
+        nitems, sizeof(int), nitems, 1, gr::block_sptr()));
+    gr::buffer_reader_sptr r0(buffer_add_reader(buf, 0, gr::block_sptr()));
+    gr::buffer_reader_sptr r1(buffer_add_reader(buf, 10, gr::block_sptr()));
+
+    const pmt::pmt_t key_a = pmt::mp("a");
+    const pmt::pmt_t key_b = pmt::mp("b");
+    for (uint64_t offset = 0; offset < 100; offset += 5) {
+        buf->add_item_tag(make_tag(offset, offset % 2 ? key_a : key_b));
+    }
+    buf->add_item_tag(make_tag(20, pmt::from_long(1)));
+
+    std::vector<uint64_t> offsets;
+    auto collect = [&offsets](const gr::tag_t& tag) {
+        offsets.push_back(tag.offset);
+        return true;
+    };
+
+    r0->visit_tags_in_range(20, 50, key_a, 0, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 25, 35, 45 }));
+
+    // the delayed reader sees the tags 10 items later
+    offsets.clear();
+    r1->visit_tags_in_range(20, 50, key_a, 0, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 25, 35, 45 }));
+    offsets.clear();
+    r1->visit_tags_in_range(30, 50, key_b, 0, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 30, 40 }));
+
+    // keys that are not symbols are compared with pmt::eqv
+    offsets.clear();
+    r0->visit_tags_in_range(0, 100, pmt::from_long(1), 0, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 20 }));
+
+    // stop after the first tag
+    int count = 0;
+    r0->visit_tags_in_range(0, 100, key_b, 0, [&count](const gr::tag_t&) {
+        count++;
+        return false;
+    });
+    BOOST_CHECK_EQUAL(count, 1);
+
+    // tags marked deleted by a block are skipped for it only
+    buf->remove_item_tag(make_tag(30, key_b), 7);
+    offsets.clear();
+    r0->visit_tags_in_range(20, 50, key_b, 7, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 20, 40 }));
+    offsets.clear();
+    r0->visit_tags_in_range(20, 50, key_b, 0, collect);
+    BOOST_CHECK(offsets == std::vector<uint64_t>({ 20, 30, 40 }));
+}
+
+
+// ----------------------------------------------------------------------------
+// test tags added in batches keep the order of offset, then of adding
+//
+
+static void t5_body()
+{
+    int nitems = 4000 / sizeof(int);
+
+    gr::buffer_sptr buf(gr::buffer_double_mapped::make_buffer(
+        nitems, sizeof(int), nitems, 1, gr::block_sptr()));
+    gr::buffer_reader_sptr r0(buffer_add_reader(buf, 0, gr::block_sptr()));
+
+    const pmt::pmt_t key = pmt::mp("a");
+    std::vector<gr::tag_t> batch;
+    for (uint64_t offset : { 30, 10, 20 }) {
+        batch.push_back(make_tag(offset, key));
+        batch.back().value = pmt::from_long(0);
+    }
+    buf->add_item_tags(batch);
+    for (auto& tag : batch) {
+        tag.value = pmt::from_long(1);
+    }
+    buf->add_item_tags(batch);
+
+    gr::tag_t tag = make_tag(20, key);
+    tag.value = pmt::from_long(2);
+    buf->add_item_tag(tag);
+
+    std::vector<gr::tag_t> tags;
+    r0->get_tags_in_range(tags, 0, 100, 0);
+    BOOST_REQUIRE_EQUAL(tags.size(), 7);
+    const uint64_t offsets[] = { 10, 10, 20, 20, 20, 30, 30 };
+    const long values[] = { 0, 1, 0, 1, 2, 0, 1 };
+    for (size_t i = 0; i < tags.size(); i++) {
+        BOOST_CHECK_EQUAL(tags[i].offset, offsets[i]);
+        BOOST_CHECK_EQUAL(pmt::to_long(tags[i].value), values[i]);
+    }
+
+    // batched tags are pruned like the others, looked up or not
+    buf->add_item_tags(std::vector<gr::tag_t>({ make_tag(40, key) }));
+    buf->prune_tags(35 + buf->bufsize());
+    r0->get_tags_in_range(tags, 0, 100, 0);
+    BOOST_REQUIRE_EQUAL(tags.size(), 1);
+    BOOST_CHECK_EQUAL(tags[0].offset, 40);
+}
+
 // ----------------------------------------------------------------------------
 BOOST_AUTO_TEST_CASE(t0) { leak_check(t0_body); }
 
@@ -264,3 +379,7 @@ BOOST_AUTO_TEST_CASE(t1) { leak_check(t1_body); }
 BOOST_AUTO_TEST_CASE(t2) { leak_check(t2_body); }
 
 BOOST_AUTO_TEST_CASE(t3) { leak_check(t3_body); }
+
+BOOST_AUTO_TEST_CASE(t4) { leak_check(t4_body); }
+
+BOOST_AUTO_TEST_CASE(t5) { leak_check(t5_body); }
@@ -12,9 +12,12 @@
  * directory into a single test suite.  As you create new test cases,
  * add them here.
  */
+#include <gnuradio/dictionary_logger_backend.h>
 #include <gnuradio/logger.h>
 #include <boost/test/unit_test.hpp>
 #include <memory>
+#include <thread>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(t1)
 {
@@ -47,3 +50,109 @@ BOOST_AUTO_TEST_CASE(t2)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(t3_async)
+{
+    auto& logging_system = gr::logging::singleton();
+    auto backend = std::make_shared<gr::dictionary_logger_backend>(std::regex("t3_.*"));
+    logging_system.add_default_sink(backend);
+
+    constexpr int n_threads = 4;
+    constexpr int n_messages = 200;
+
+    logging_system.set_async(true);
+    BOOST_CHECK(logging_system.is_async());
+    const auto dropped = logging_system.dropped_records();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([t]() {
+            gr::logger log("t3_" + std::to_string(t));
+            log.set_level(gr::log_level::info);
+            for (int i = 0; i < n_messages; i++) {
+                log.info("{:d}", i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Disabling writes what is still queued
+    logging_system.set_async(false);
+    BOOST_CHECK(!logging_system.is_async());
+
+    auto map = backend->get_map();
+    size_t logged = 0;
+    for (int t = 0; t < n_threads; t++) {
+        logged += map["t3_" + std::to_string(t)].size();
+    }
+    BOOST_CHECK_EQUAL(logged + logging_system.dropped_records() - dropped,
+                      size_t(n_threads * n_messages));
+}
+
+BOOST_AUTO_TEST_CASE(t4_rate_limit)
+{
+    auto& logging_system = gr::logging::singleton();
+    auto backend = std::make_shared<gr::dictionary_logger_backend>(std::regex("t4"));
+    logging_system.add_default_sink(backend);
+
+    gr::logger log("t4");
+    log.set_level(gr::log_level::info);
+
+    constexpr unsigned int limit = 10;
+    logging_system.set_rate_limit(limit);
+    const auto dropped = logging_system.dropped_records();
+    for (int i = 0; i < 1000; i++) {
+        log.info("limited {:d}", i);
+    }
+    logging_system.set_rate_limit(0);
+
+    // The loop may run across the start of a second
+    const size_t logged = backend->get_map()["t4"].size();
+    BOOST_CHECK(logged >= limit);
+    BOOST_CHECK(logged <= 2 * limit);
+    BOOST_CHECK_EQUAL(logging_system.dropped_records() - dropped, 1000 - logged);
+}
+
+BOOST_AUTO_TEST_CASE(t5_rate_limit_sites)
+{
+    auto& logging_system = gr::logging::singleton();
+    auto backend = std::make_shared<gr::dictionary_logger_backend>(std::regex("t5_.*"));
+    logging_system.add_default_sink(backend);
+
+    // Two call sites, one a GR_LOG macro, each with a limit of its own
+    auto log_a = std::make_shared<gr::logger>("t5_a");
+    auto log_b = std::make_shared<gr::logger>("t5_b");
+    // Two loggers sharing one call site, as all Python logging does, each
+    // with a limit of its own, too
+    auto log_c = std::make_shared<gr::logger>("t5_c");
+    auto log_d = std::make_shared<gr::logger>("t5_d");
+    auto shared_site = [](gr::logger& log, int i) { log.info("shared {:d}", i); };
+    for (auto& log : { log_a, log_b, log_c, log_d })
+        log->set_level(gr::log_level::info);
+
+    constexpr unsigned int limit = 10;
+    constexpr int n_messages = 500;
+    logging_system.set_async(true);
+    logging_system.set_rate_limit(limit);
+    const auto dropped = logging_system.dropped_records();
+    for (int i = 0; i < n_messages; i++) {
+        log_a->info("site a {:d}", i);
+        GR_LOG_INFO(log_b, "site b");
+        shared_site(*log_c, i);
+        shared_site(*log_d, i);
+    }
+    logging_system.set_rate_limit(0);
+    logging_system.set_async(false);
+
+    auto map = backend->get_map();
+    size_t logged = 0;
+    for (const char* name : { "t5_a", "t5_b", "t5_c", "t5_d" }) {
+        const size_t n = map[name].size();
+        BOOST_CHECK_MESSAGE(n >= limit && n <= 2 * limit, name << " logged " << n);
+        logged += n;
+    }
+    BOOST_CHECK_EQUAL(logging_system.dropped_records() - dropped,
+                      4 * n_messages - logged);
+}
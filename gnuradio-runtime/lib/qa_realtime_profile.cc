@@ -0,0 +1,43 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "realtime_profile.h"
+#include <boost/test/unit_test.hpp>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_CASE(t0)
+{
+    BOOST_CHECK(gr::realtime_profile::parse_cpus("").empty());
+    BOOST_CHECK(gr::realtime_profile::parse_cpus("3") == std::vector<int>({ 3 }));
+    BOOST_CHECK(gr::realtime_profile::parse_cpus("0, 2-4,7") ==
+                std::vector<int>({ 0, 2, 3, 4, 7 }));
+}
+
+BOOST_AUTO_TEST_CASE(t1)
+{
+    BOOST_CHECK_THROW(gr::realtime_profile::parse_cpus("a"), std::invalid_argument);
+    BOOST_CHECK_THROW(gr::realtime_profile::parse_cpus("4-2"), std::invalid_argument);
+    BOOST_CHECK_THROW(gr::realtime_profile::parse_cpus("1+2"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(t2)
+{
+    gr::realtime_profile profile(false, false, "2-3", false);
+    BOOST_CHECK(profile.thread_cpus(0) == std::vector<int>({ 2 }));
+    BOOST_CHECK(profile.thread_cpus(1) == std::vector<int>({ 3 }));
+    BOOST_CHECK(profile.thread_cpus(2) == std::vector<int>({ 2 }));
+
+    gr::realtime_profile unpinned(false, false, "", false);
+    BOOST_CHECK(unpinned.thread_cpus(0).empty());
+}
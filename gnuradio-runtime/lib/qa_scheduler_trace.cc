@@ -0,0 +1,143 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <gnuradio/io_signature.h>
+#include <gnuradio/scheduler_trace.h>
+#include <gnuradio/sync_block.h>
+#include <gnuradio/top_block.h>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+// Mocked up blocks that produce a number of items and throw them away
+class count_source : public gr::sync_block
+{
+public:
+    count_source(int nitems)
+        : sync_block("count_source",
+                     gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1, 1, sizeof(int))),
+          d_left(nitems)
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override
+    {
+        if (d_left == 0)
+            return WORK_DONE;
+
+        const int n = std::min(noutput_items, d_left);
+        int* out = static_cast<int*>(output_items[0]);
+        for (int i = 0; i < n; i++)
+            out[i] = i;
+        d_left -= n;
+        return n;
+    }
+
+private:
+    int d_left;
+};
+
+class drop_sink : public gr::sync_block
+{
+public:
+    drop_sink()
+        : sync_block("drop_sink",
+                     gr::io_signature::make(1, 1, sizeof(int)),
+                     gr::io_signature::make(0, 0, 0))
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override
+    {
+        return noutput_items;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(t1_dump)
+{
+    if (!gr::scheduler_trace::available()) {
+        BOOST_TEST_MESSAGE("scheduler tracing not built, skipping");
+        return;
+    }
+
+    gr::scheduler_trace::clear();
+    gr::scheduler_trace::set_enabled(true);
+
+    auto src = gnuradio::make_block_sptr<count_source>(100000);
+    auto sink = gnuradio::make_block_sptr<drop_sink>();
+    gr::top_block_sptr tb = gr::make_top_block("t1_dump");
+    tb->connect(src, 0, sink, 0);
+    tb->run();
+    gr::scheduler_trace::set_enabled(false);
+
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "qa_scheduler_trace.json").string();
+    BOOST_REQUIRE(gr::scheduler_trace::dump(filename));
+
+    boost::property_tree::ptree trace;
+    boost::property_tree::read_json(filename, trace);
+    std::remove(filename.c_str());
+
+    std::map<int, std::string> thread_names;
+    std::map<int, std::vector<std::string>> open_spans;
+    std::map<int, int> work_calls;
+    for (const auto& [key, e] : trace.get_child("traceEvents")) {
+        const int tid = e.get<int>("tid");
+        const std::string name = e.get<std::string>("name");
+        const std::string ph = e.get<std::string>("ph");
+        if (ph == "M") {
+            BOOST_CHECK_EQUAL(name, "thread_name");
+            thread_names[tid] = e.get<std::string>("args.name");
+            continue;
+        }
+
+        // Events only follow the metadata of their thread
+        BOOST_REQUIRE(thread_names.count(tid));
+        if (ph == "B") {
+            open_spans[tid].push_back(name);
+            if (name == "work")
+                work_calls[tid]++;
+        } else if (ph == "E") {
+            BOOST_REQUIRE(!open_spans[tid].empty());
+            BOOST_CHECK_EQUAL(open_spans[tid].back(), name);
+            open_spans[tid].pop_back();
+        }
+    }
+
+    // The threads ended on their own, so every span was closed
+    for (const auto& [tid, spans] : open_spans)
+        BOOST_CHECK(spans.empty());
+
+    for (const auto& block : { src->identifier(), sink->identifier() }) {
+        bool found = false;
+        for (const auto& [tid, name] : thread_names) {
+            if (name == block) {
+                found = true;
+                BOOST_CHECK(work_calls[tid] > 0);
+            }
+        }
+        BOOST_CHECK_MESSAGE(found, "no thread named " << block);
+    }
+}
@@ -0,0 +1,174 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "pagesize.h"
+#include "realtime_profile.h"
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer_double_mapped.h>
+#include <gnuradio/logger.h>
+#include <gnuradio/prefs.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#ifdef HAVE_RUSAGE_THREAD
+#include <sys/resource.h>
+#endif
+
+namespace gr {
+
+const realtime_profile& realtime_profile::get()
+{
+    static const realtime_profile profile(
+        prefs::singleton()->get_bool("Realtime", "lock_memory", false),
+        prefs::singleton()->get_bool("Realtime", "prefault_buffers", false),
+        prefs::singleton()->get_string("Realtime", "cpus", ""),
+        prefs::singleton()->get_bool("Realtime", "report_thread_usage", false));
+    return profile;
+}
+
+realtime_profile::realtime_profile(bool lock_memory,
+                                   bool prefault_buffers,
+                                   const std::string& cpus,
+                                   bool report_thread_usage)
+    : d_lock_memory(lock_memory),
+      d_prefault_buffers(prefault_buffers),
+      d_report_thread_usage(report_thread_usage)
+{
+    try {
+        d_cpus = parse_cpus(cpus);
+    } catch (const std::invalid_argument& e) {
+        gr::logger logger("realtime_profile");
+        logger.error("Ignoring [Realtime] cpus: {:s}", e.what());
+    }
+}
+
+std::vector<int> realtime_profile::parse_cpus(const std::string& cpus)
+{
+    std::vector<int> result;
+    std::istringstream list(cpus);
+    std::string range;
+    while (std::getline(list, range, ',')) {
+        if (range.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        int first, last;
+        char dash;
+        std::istringstream range_stream(range);
+        if (!(range_stream >> first)) {
+            throw std::invalid_argument("bad CPU list \"" + cpus + "\"");
+        }
+        last = first;
+        if (range_stream >> dash && !(dash == '-' && range_stream >> last)) {
+            throw std::invalid_argument("bad CPU list \"" + cpus + "\"");
+        }
+        if (first < 0 || last < first) {
+            throw std::invalid_argument("bad CPU range \"" + range + "\"");
+        }
+        for (int cpu = first; cpu <= last; cpu++) {
+            result.push_back(cpu);
+        }
+    }
+    return result;
+}
+
+std::vector<int> realtime_profile::thread_cpus(size_t index) const
+{
+    if (d_cpus.empty()) {
+        return {};
+    }
+    return { d_cpus[index % d_cpus.size()] };
+}
+
+// Faults in the pages from p to p + len, without changing their contents
+static void prefault(const char* p, size_t len)
+{
+#if defined(HAVE_SYS_MMAN_H) && defined(MADV_POPULATE_WRITE)
+    // Populates writable pages, so the first write does not fault either
+    const uintptr_t page = pagesize();
+    const uintptr_t start = reinterpret_cast<uintptr_t>(p) & ~(page - 1);
+    if (madvise(reinterpret_cast<void*>(start),
+                reinterpret_cast<uintptr_t>(p) + len - start,
+                MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    const size_t page_size = pagesize();
+    for (size_t offset = 0; offset < len; offset += page_size) {
+        static_cast<void>(*static_cast<const volatile char*>(p + offset));
+    }
+}
+
+void realtime_profile::prepare_buffers(const block_vector_t& blocks) const
+{
+    gr::logger logger("realtime_profile");
+
+    if (d_lock_memory) {
+#ifdef HAVE_MLOCKALL
+        // MCL_CURRENT also faults in all pages mapped so far
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            logger.warn("mlockall failed, memory is not locked: {:s}", strerror(errno));
+        }
+#else
+        logger.warn("Locking memory is not supported on this platform");
+#endif
+    }
+
+    if (!d_prefault_buffers) {
+        return;
+    }
+
+    for (const block_sptr& block : blocks) {
+        block_detail_sptr detail = block->detail();
+        for (int i = 0; i < detail->noutputs(); i++) {
+            buffer_sptr buf = detail->output(i);
+            // Only the default buffers surely are host memory; both
+            // mappings of the double mapped buffer have page tables.
+            if (!dynamic_cast<buffer_double_mapped*>(buf.get())) {
+                continue;
+            }
+            prefault(buf->base(), 2 * size_t(buf->bufsize()) * buf->get_sizeof_item());
+        }
+    }
+}
+
+void realtime_profile::report_thread_usage(const block_sptr& block)
+{
+    gr::logger logger("realtime_profile");
+#ifdef HAVE_RUSAGE_THREAD
+    struct rusage usage;
+    if (getrusage(RUSAGE_THREAD, &usage) != 0) {
+        logger.warn("{:s}: getrusage failed: {:s}", block->identifier(), strerror(errno));
+        return;
+    }
+    logger.info("{:s}: {:d} minor and {:d} major page faults, {:d} voluntary and {:d} "
+                "involuntary context switches",
+                block->identifier(),
+                usage.ru_minflt,
+                usage.ru_majflt,
+                usage.ru_nvcsw,
+                usage.ru_nivcsw);
+#else
+    logger.warn("{:s}: thread usage is not available on this platform",
+                block->identifier());
+#endif
+}
+
+} /* namespace gr */
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_REALTIME_PROFILE_H
+#define INCLUDED_GR_RUNTIME_REALTIME_PROFILE_H
+
+#include <gnuradio/api.h>
+#include <gnuradio/block.h>
+#include <string>
+#include <vector>
+
+namespace gr {
+
+/*!
+ * \brief How flowgraphs are set up for realtime deployment, from the
+ * [Realtime] section of the preferences.
+ *
+ * - lock_memory: lock all current and future memory of the process
+ *   into RAM before the block threads start.
+ * - prefault_buffers: fault in the pages of the block output buffers
+ *   before the block threads start, so work() does not on first use.
+ * - cpus: CPUs to spread the block threads over, one CPU per thread in
+ *   turn, e.g. "2-5,7". Blocks with a processor affinity keep it.
+ * - report_thread_usage: log the page faults and context switches of
+ *   each block thread when it ends.
+ */
+class GR_RUNTIME_API realtime_profile
+{
+public:
+    //! The profile of the preferences, read once
+    static const realtime_profile& get();
+
+    realtime_profile(bool lock_memory,
+                     bool prefault_buffers,
+                     const std::string& cpus,
+                     bool report_thread_usage);
+
+    /*!
+     * \brief Locks the memory of the process and faults in the output
+     * buffers of \p blocks, as the profile asks.
+     */
+    void prepare_buffers(const block_vector_t& blocks) const;
+
+    /*!
+     * \brief Returns the CPU the \p index-th block thread runs on, or
+     * an empty vector if the profile does not pin it.
+     */
+    std::vector<int> thread_cpus(size_t index) const;
+
+    bool reports_thread_usage() const { return d_report_thread_usage; }
+
+    //! Logs the page faults and context switches of the calling thread
+    static void report_thread_usage(const block_sptr& block);
+
+    //! Parses a list of CPUs and CPU ranges like "0,2-4"
+    static std::vector<int> parse_cpus(const std::string& cpus);
+
+private:
+    bool d_lock_memory;
+    bool d_prefault_buffers;
+    std::vector<int> d_cpus;
+    bool d_report_thread_usage;
+};
+
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_RUNTIME_REALTIME_PROFILE_H */
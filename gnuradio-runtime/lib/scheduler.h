@@ -52,6 +52,21 @@ public:
      * \brief Block until the graph is done.
      */
     virtual void wait() = 0;
+
+    /*!
+     * \brief Stop executing the given blocks and wait until they have
+     * stopped, leaving the rest of the graph running.
+     *
+     * Used to rewire part of a running graph. The blocks are not
+     * marked done.
+     */
+    virtual void stop_blocks(const block_vector_t& blocks) = 0;
+
+    /*!
+     * \brief Begin executing the given blocks as part of the running
+     * graph, e.g. blocks added or rewired since they were stopped.
+     */
+    virtual void start_blocks(const block_vector_t& blocks) = 0;
 };
 
 } /* namespace gr */
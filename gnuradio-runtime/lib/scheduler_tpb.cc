@@ -12,10 +12,13 @@
 #include <config.h>
 #endif
 
+#include "realtime_profile.h"
 #include "scheduler_tpb.h"
 #include "tpb_thread_body.h"
 #include <gnuradio/thread/thread_body_wrapper.h>
+#include <functional>
 #include <sstream>
+#include <stdexcept>
 
 namespace gr {
 
@@ -24,18 +27,33 @@ class tpb_container
     block_sptr d_block;
     int d_max_noutput_items;
     thread::barrier_sptr d_start_sync;
+    std::vector<int> d_cpus;
+    std::function<void()> d_exited;
+
+    // Reports the end of the thread body, however it ends
+    struct exit_guard {
+        const std::function<void()>& exited;
+        ~exit_guard() { exited(); }
+    };
 
 public:
     tpb_container(block_sptr block,
                   int max_noutput_items,
-                  thread::barrier_sptr start_sync)
-        : d_block(block), d_max_noutput_items(max_noutput_items), d_start_sync(start_sync)
+                  thread::barrier_sptr start_sync,
+                  std::vector<int> cpus,
+                  std::function<void()> exited)
+        : d_block(block),
+          d_max_noutput_items(max_noutput_items),
+          d_start_sync(start_sync),
+          d_cpus(cpus),
+          d_exited(exited)
     {
     }
 
     void operator()()
     {
-        tpb_thread_body body(d_block, d_start_sync, d_max_noutput_items);
+        exit_guard guard{ d_exited };
+        tpb_thread_body body(d_block, d_start_sync, d_max_noutput_items, d_cpus);
     }
 };
 
@@ -48,10 +66,11 @@ scheduler_tpb::make(flat_flowgraph_sptr ffg, int max_noutput_items, bool catch_e
 scheduler_tpb::scheduler_tpb(flat_flowgraph_sptr ffg,
                              int max_noutput_items,
                              bool catch_exceptions)
-    : scheduler(ffg, max_noutput_items, catch_exceptions)
+    : scheduler(ffg, max_noutput_items, catch_exceptions),
+      d_nrunning(0),
+      d_max_noutput_items(max_noutput_items),
+      d_catch_exceptions(catch_exceptions)
 {
-    int block_max_noutput_items;
-
     // Get a topologically sorted vector of all the blocks in use.
     // Being topologically sorted probably isn't going to matter, but
     // there's a non-zero chance it might help...
@@ -60,39 +79,114 @@ scheduler_tpb::scheduler_tpb(flat_flowgraph_sptr ffg,
     used_blocks = ffg->topological_sort(used_blocks);
     block_vector_t blocks = flat_flowgraph::make_block_vector(used_blocks);
 
+    start_threads(blocks);
+}
+
+scheduler_tpb::~scheduler_tpb()
+{
+    stop();
+    for (auto& [block, thread] : d_threads) {
+        thread->join();
+    }
+}
+
+void scheduler_tpb::start_threads(const block_vector_t& blocks)
+{
     // Ensure that the done flag is clear on all blocks
 
     for (size_t i = 0; i < blocks.size(); i++) {
         blocks[i]->detail()->set_done(false);
     }
 
+    // Lock and fault in the buffers before any block runs
+    const realtime_profile& profile = realtime_profile::get();
+    profile.prepare_buffers(blocks);
+
     thread::barrier_sptr start_sync =
         std::make_shared<thread::barrier>(blocks.size() + 1);
 
     // Fire off a thead for each block
+    {
+        gr::thread::scoped_lock lock(d_mutex);
+        for (size_t i = 0; i < blocks.size(); i++) {
+            if (d_threads.count(blocks[i])) {
+                throw std::invalid_argument("scheduler_tpb: block " +
+                                            blocks[i]->identifier() +
+                                            " is already running");
+            }
+        }
 
-    for (size_t i = 0; i < blocks.size(); i++) {
-        std::stringstream name;
-        name << "thread-per-block[" << i << "]: " << blocks[i];
-
-        // If set, use internal value instead of global value
-        if (blocks[i]->is_set_max_noutput_items()) {
-            block_max_noutput_items = blocks[i]->max_noutput_items();
-        } else {
-            block_max_noutput_items = max_noutput_items;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            std::stringstream name;
+            name << "thread-per-block[" << d_threads.size() << "]: " << blocks[i];
+
+            // If set, use internal value instead of global value
+            int block_max_noutput_items;
+            if (blocks[i]->is_set_max_noutput_items()) {
+                block_max_noutput_items = blocks[i]->max_noutput_items();
+            } else {
+                block_max_noutput_items = d_max_noutput_items;
+            }
+            d_threads[blocks[i]] = std::make_unique<gr::thread::thread>(
+                thread::thread_body_wrapper<tpb_container>(
+                    tpb_container(blocks[i],
+                                  block_max_noutput_items,
+                                  start_sync,
+                                  profile.thread_cpus(d_threads.size()),
+                                  [this]() { thread_exited(); }),
+                    name.str(),
+                    d_catch_exceptions));
+            d_nrunning++;
         }
-        d_threads.create_thread(thread::thread_body_wrapper<tpb_container>(
-            tpb_container(blocks[i], block_max_noutput_items, start_sync),
-            name.str(),
-            catch_exceptions));
     }
     start_sync->wait();
 }
 
-scheduler_tpb::~scheduler_tpb() { stop(); }
+void scheduler_tpb::thread_exited()
+{
+    gr::thread::scoped_lock lock(d_mutex);
+    d_nrunning--;
+    d_exited.notify_all();
+}
+
+void scheduler_tpb::stop()
+{
+    gr::thread::scoped_lock lock(d_mutex);
+    for (auto& [block, thread] : d_threads) {
+        thread->interrupt();
+    }
+}
+
+void scheduler_tpb::wait()
+{
+    gr::thread::scoped_lock lock(d_mutex);
+    while (d_nrunning > 0) {
+        d_exited.wait(lock);
+    }
+}
 
-void scheduler_tpb::stop() { d_threads.interrupt_all(); }
+void scheduler_tpb::stop_blocks(const block_vector_t& blocks)
+{
+    std::vector<std::unique_ptr<gr::thread::thread>> stopping;
+    {
+        gr::thread::scoped_lock lock(d_mutex);
+        for (const block_sptr& block : blocks) {
+            auto it = d_threads.find(block);
+            if (it == d_threads.end()) {
+                continue;
+            }
+            it->second->interrupt();
+            stopping.push_back(std::move(it->second));
+            d_threads.erase(it);
+        }
+    }
+
+    // The threads report their exit under d_mutex
+    for (auto& thread : stopping) {
+        thread->join();
+    }
+}
 
-void scheduler_tpb::wait() { d_threads.join_all(); }
+void scheduler_tpb::start_blocks(const block_vector_t& blocks) { start_threads(blocks); }
 
 } /* namespace gr */
@@ -13,7 +13,9 @@
 
 #include "scheduler.h"
 #include <gnuradio/api.h>
-#include <gnuradio/thread/thread_group.h>
+#include <gnuradio/thread/thread.h>
+#include <map>
+#include <memory>
 
 namespace gr {
 
@@ -22,7 +24,17 @@ namespace gr {
  */
 class GR_RUNTIME_API scheduler_tpb : public scheduler
 {
-    gr::thread::thread_group d_threads;
+    // The threads are kept per block, so that single blocks can be
+    // stopped and started while the others keep running.
+    std::map<block_sptr, std::unique_ptr<gr::thread::thread>> d_threads;
+    gr::thread::mutex d_mutex; // protects d_threads and d_nrunning
+    gr::thread::condition_variable d_exited;
+    int d_nrunning;
+    int d_max_noutput_items;
+    bool d_catch_exceptions;
+
+    void start_threads(const block_vector_t& blocks);
+    void thread_exited();
 
 protected:
     /*!
@@ -49,6 +61,10 @@ public:
      * \brief Block until the graph is done.
      */
     void wait() override;
+
+    void stop_blocks(const block_vector_t& blocks) override;
+
+    void start_blocks(const block_vector_t& blocks) override;
 };
 
 } /* namespace gr */
@@ -0,0 +1,244 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "scheduler_tracepoints.h"
+#include <gnuradio/scheduler_trace.h>
+
+#ifdef GR_SCHEDULER_TRACING
+
+#include <gnuradio/logger.h>
+#include <gnuradio/prefs.h>
+#include <gnuradio/thread/thread.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace gr {
+namespace scheduler_trace {
+
+std::atomic<bool> s_enabled(false);
+thread_local thread_ring* t_ring = nullptr;
+
+static gr::thread::mutex s_rings_mutex;
+static std::vector<std::shared_ptr<thread_ring>> s_rings;
+
+static const char* event_names[] = {
+    "work",
+    "wait_input",
+    "wait_output",
+    "notify_neighbors",
+    "notify_upstream",
+    "dispatch_msg",
+};
+
+// Takes [Tracing] on from the preferences before the first use
+static void init_enabled()
+{
+    static std::once_flag once;
+    std::call_once(once, []() {
+        s_enabled.store(prefs::singleton()->get_bool("Tracing", "on", false));
+    });
+}
+
+static size_t ring_capacity()
+{
+    const long size = prefs::singleton()->get_long("Tracing", "ring_size", 65536);
+    size_t capacity = 1;
+    while (capacity < size_t(std::max(size, 2L))) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+thread_ring::thread_ring(const std::string& name, size_t capacity)
+    : d_head(0),
+      d_start(0),
+      d_exited(false),
+      d_name(name),
+      d_mask(capacity - 1),
+      d_slots(new slot[capacity])
+{
+}
+
+thread_registration::thread_registration(const std::string& name)
+{
+    init_enabled();
+    static const size_t capacity = ring_capacity();
+    auto ring = std::make_shared<thread_ring>(name, capacity);
+    {
+        gr::thread::scoped_lock lock(s_rings_mutex);
+        s_rings.push_back(ring);
+    }
+    t_ring = ring.get();
+}
+
+thread_registration::~thread_registration()
+{
+    t_ring->d_exited.store(true);
+    t_ring = nullptr;
+}
+
+static std::string json_escape(const std::string& s)
+{
+    std::string escaped;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += fmt::format("\\u{:04x}", int(c));
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+static void dump_ring(std::FILE* f, const thread_ring& ring, int tid, bool& first)
+{
+    fmt::print(f,
+               "{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},"
+               "\"args\":{{\"name\":\"{}\"}}}}",
+               first ? "" : ",\n",
+               tid,
+               json_escape(ring.name()));
+    first = false;
+
+    // Copy what is there, then drop what the thread overwrote meanwhile
+    const uint64_t head = ring.d_head.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(ring.d_start.load(),
+                                    head - std::min(head, uint64_t(ring.capacity())));
+    std::vector<std::pair<uint64_t, uint64_t>> events;
+    events.reserve(head - begin);
+    for (uint64_t i = begin; i < head; i++) {
+        events.emplace_back(ring.at(i).time_ns.load(std::memory_order_relaxed),
+                            ring.at(i).info.load(std::memory_order_relaxed));
+    }
+    const uint64_t head_after = ring.d_head.load(std::memory_order_acquire);
+    const uint64_t valid = head_after - std::min(head_after, uint64_t(ring.capacity()));
+    const size_t skip = valid > begin ? std::min(size_t(valid - begin), events.size()) : 0;
+
+    for (size_t i = skip; i < events.size(); i++) {
+        const uint64_t info = events[i].second;
+        const auto e = static_cast<unsigned>(info & 0xff);
+        const auto p = static_cast<phase>((info >> 8) & 0xff);
+        const int32_t arg = static_cast<int32_t>(info >> 32);
+        if (e >= sizeof(event_names) / sizeof(*event_names)) {
+            continue;
+        }
+        const double ts = events[i].first / 1e3; // in us
+        switch (p) {
+        case phase::begin:
+            fmt::print(f,
+                       ",\n{{\"name\":\"{}\",\"ph\":\"B\",\"ts\":{:.3f},\"pid\":0,"
+                       "\"tid\":{}}}",
+                       event_names[e],
+                       ts,
+                       tid);
+            break;
+        case phase::end:
+            fmt::print(f,
+                       ",\n{{\"name\":\"{}\",\"ph\":\"E\",\"ts\":{:.3f},\"pid\":0,"
+                       "\"tid\":{},\"args\":{{\"result\":{}}}}}",
+                       event_names[e],
+                       ts,
+                       tid,
+                       arg);
+            break;
+        case phase::instant:
+            fmt::print(f,
+                       ",\n{{\"name\":\"{}\",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},"
+                       "\"pid\":0,\"tid\":{}}}",
+                       event_names[e],
+                       ts,
+                       tid);
+            break;
+        }
+    }
+}
+
+bool available() { return true; }
+
+void set_enabled(bool enabled)
+{
+    init_enabled();
+    s_enabled.store(enabled);
+}
+
+bool enabled()
+{
+    init_enabled();
+    return s_enabled.load();
+}
+
+bool dump(const std::string& filename)
+{
+    std::vector<std::shared_ptr<thread_ring>> rings;
+    {
+        gr::thread::scoped_lock lock(s_rings_mutex);
+        rings = s_rings;
+    }
+
+    std::FILE* f = std::fopen(filename.c_str(), "w");
+    if (!f) {
+        gr::logger logger("scheduler_trace");
+        logger.error("Cannot write trace to {:s}", filename);
+        return false;
+    }
+    fmt::print(f, "{{\"traceEvents\":[\n");
+    bool first = true;
+    for (size_t i = 0; i < rings.size(); i++) {
+        dump_ring(f, *rings[i], int(i), first);
+    }
+    fmt::print(f, "\n]}}\n");
+    return std::fclose(f) == 0;
+}
+
+void clear()
+{
+    gr::thread::scoped_lock lock(s_rings_mutex);
+    std::vector<std::shared_ptr<thread_ring>> running;
+    for (auto& ring : s_rings) {
+        if (!ring->d_exited.load()) {
+            ring->d_start.store(ring->d_head.load(std::memory_order_acquire));
+            running.push_back(ring);
+        }
+    }
+    s_rings.swap(running);
+}
+
+} /* namespace scheduler_trace */
+} /* namespace gr */
+
+#else
+
+namespace gr {
+namespace scheduler_trace {
+
+bool available() { return false; }
+
+void set_enabled(bool) {}
+
+bool enabled() { return false; }
+
+bool dump(const std::string&) { return false; }
+
+void clear() {}
+
+} /* namespace scheduler_trace */
+} /* namespace gr */
+
+#endif /* GR_SCHEDULER_TRACING */
@@ -0,0 +1,147 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_RUNTIME_SCHEDULER_TRACEPOINTS_H
+#define INCLUDED_GR_RUNTIME_SCHEDULER_TRACEPOINTS_H
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/*
+ * Tracepoints of the scheduler, see gnuradio/scheduler_trace.h.
+ *
+ *   GR_TRACE_THREAD(name)         records the events of the calling thread
+ *                                 under name until the end of the scope
+ *   GR_TRACE_BEGIN(event)         starts a span of event
+ *   GR_TRACE_END(event, arg)      ends it; arg is shown with the span
+ *   GR_TRACE_INSTANT(event)       marks a point in time
+ *
+ * Without GR_SCHEDULER_TRACING they expand to nothing.
+ */
+
+#ifdef GR_SCHEDULER_TRACING
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace gr {
+namespace scheduler_trace {
+
+enum class event : uint8_t {
+    work,
+    wait_input,
+    wait_output,
+    notify_neighbors,
+    notify_upstream,
+    dispatch_msg,
+};
+
+enum class phase : uint8_t { begin, end, instant };
+
+/*!
+ * \brief Events of one thread, written by that thread only.
+ *
+ * Slots are written with relaxed atomics and published by the release
+ * store of the head, so a reader may copy them while the thread goes
+ * on; it drops what may have been overwritten in the meantime.
+ */
+class thread_ring
+{
+public:
+    struct slot {
+        std::atomic<uint64_t> time_ns;
+        std::atomic<uint64_t> info; // event | phase << 8 | arg << 32
+    };
+
+    thread_ring(const std::string& name, size_t capacity);
+
+    void record(event e, phase p, int32_t arg) noexcept
+    {
+        const uint64_t head = d_head.load(std::memory_order_relaxed);
+        slot& s = d_slots[head & d_mask];
+        s.time_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count(),
+                        std::memory_order_relaxed);
+        s.info.store(uint64_t(e) | uint64_t(p) << 8 | uint64_t(uint32_t(arg)) << 32,
+                     std::memory_order_relaxed);
+        d_head.store(head + 1, std::memory_order_release);
+    }
+
+    const std::string& name() const { return d_name; }
+    size_t capacity() const { return d_mask + 1; }
+    const slot& at(uint64_t index) const { return d_slots[index & d_mask]; }
+
+    std::atomic<uint64_t> d_head;
+    std::atomic<uint64_t> d_start; // first index not cleared
+    std::atomic<bool> d_exited;
+
+private:
+    const std::string d_name;
+    const uint64_t d_mask;
+    std::unique_ptr<slot[]> d_slots;
+};
+
+extern std::atomic<bool> s_enabled;
+extern thread_local thread_ring* t_ring;
+
+inline void record(event e, phase p, int32_t arg = 0) noexcept
+{
+    if (t_ring && s_enabled.load(std::memory_order_relaxed)) {
+        t_ring->record(e, p, arg);
+    }
+}
+
+//! Gives the calling thread a ring while it exists
+class thread_registration
+{
+public:
+    thread_registration(const std::string& name);
+    ~thread_registration();
+};
+
+} /* namespace scheduler_trace */
+} /* namespace gr */
+
+#define GR_TRACE_THREAD(name) \
+    gr::scheduler_trace::thread_registration gr_trace_registration(name)
+#define GR_TRACE_BEGIN(e)                                          \
+    gr::scheduler_trace::record(gr::scheduler_trace::event::e,     \
+                                gr::scheduler_trace::phase::begin)
+#define GR_TRACE_END(e, arg)                                   \
+    gr::scheduler_trace::record(gr::scheduler_trace::event::e, \
+                                gr::scheduler_trace::phase::end, \
+                                (arg))
+#define GR_TRACE_INSTANT(e)                                        \
+    gr::scheduler_trace::record(gr::scheduler_trace::event::e,     \
+                                gr::scheduler_trace::phase::instant)
+
+#else
+
+#define GR_TRACE_THREAD(name) \
+    do {                      \
+    } while (0)
+#define GR_TRACE_BEGIN(e) \
+    do {                  \
+    } while (0)
+#define GR_TRACE_END(e, arg) \
+    do {                     \
+    } while (0)
+#define GR_TRACE_INSTANT(e) \
+    do {                    \
+    } while (0)
+
+#endif /* GR_SCHEDULER_TRACING */
+
+#endif /* INCLUDED_GR_RUNTIME_SCHEDULER_TRACEPOINTS_H */
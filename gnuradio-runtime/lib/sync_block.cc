@@ -22,6 +22,7 @@ sync_block::sync_block(const std::string& name,
     : block(name, input_signature, output_signature)
 {
     set_fixed_rate(true);
+    set_fixed_rate_forecast(true);
 }
 
 void sync_block::forecast(int noutput_items, gr_vector_int& ninput_items_required)
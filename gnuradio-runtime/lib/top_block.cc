@@ -73,6 +73,8 @@ void top_block::lock() { d_impl->lock(); }
 
 void top_block::unlock() { d_impl->unlock(); }
 
+void top_block::reconfigure() { d_impl->reconfigure(); }
+
 std::string top_block::edge_list() { return d_impl->edge_list(); }
 
 std::string top_block::msg_edge_list() { return d_impl->msg_edge_list(); }
@@ -19,6 +19,7 @@
 #include "top_block_impl.h"
 #include <gnuradio/logger.h>
 #include <gnuradio/prefs.h>
+#include <gnuradio/scheduler_trace.h>
 #include <gnuradio/top_block.h>
 
 #include <cstdlib>
@@ -151,6 +152,14 @@ void top_block_impl::wait()
             d_lock_cond.wait(lock);
         }
     } while (true);
+
+    // Only now are the threads done, not when they are stopped to
+    // reconfigure the flowgraph
+    const std::string trace_file =
+        prefs::singleton()->get_string("Tracing", "file", "");
+    if (!trace_file.empty() && scheduler_trace::enabled()) {
+        scheduler_trace::dump(trace_file);
+    }
 }
 
 void top_block_impl::wait_for_jobs()
@@ -186,6 +195,47 @@ void top_block_impl::unlock()
     d_lock_cond.notify_all();
 }
 
+void top_block_impl::reconfigure()
+{
+    gr::thread::scoped_lock lock(d_mutex);
+
+    // Otherwise start() or unlock() pick up the changes
+    if (d_state == IDLE || d_lock_count > 0)
+        return;
+
+    flat_flowgraph_sptr new_ffg = d_owner->flatten();
+    new_ffg->validate();
+
+    basic_block_vector_t changed = new_ffg->calc_changed_blocks(d_ffg);
+    basic_block_vector_t stopping, starting;
+    for (const basic_block_sptr& block : changed) {
+        if (d_ffg->has_block_p(block))
+            stopping.push_back(block);
+        if (new_ffg->has_block_p(block))
+            starting.push_back(block);
+    }
+    d_debug_logger->debug("reconfigure: {:d} of {:d} blocks changed",
+                          changed.size(),
+                          d_ffg->calc_used_blocks().size());
+
+    d_scheduler->stop_blocks(flat_flowgraph::make_block_vector(stopping));
+
+    if (!new_ffg->merge_changed_connections(d_ffg, changed)) {
+        // A block kept its detail with a different number of ports,
+        // which its neighbors may depend on: rewire the whole graph.
+        d_logger->debug("reconfigure: port count changed, restarting all blocks");
+        d_scheduler->stop();
+        restart();
+        return;
+    }
+    d_ffg = new_ffg;
+
+    d_scheduler->start_blocks(flat_flowgraph::make_block_vector(starting));
+
+    // wait() may have seen all threads exit while the blocks were stopped
+    d_retry_wait = true;
+}
+
 /*
  * restart is called with d_mutex held
  */
@@ -45,6 +45,9 @@ public:
     // Unlock the top block at end of reconfiguration
     void unlock();
 
+    // Rewire the blocks with changed connections while the rest runs
+    void reconfigure();
+
     // Return a string list of edges
     std::string edge_list();
 
@@ -12,6 +12,8 @@
 #include <config.h>
 #endif
 
+#include "realtime_profile.h"
+#include "scheduler_tracepoints.h"
 #include "tpb_thread_body.h"
 #include <gnuradio/prefs.h>
 #include <pmt/pmt.h>
@@ -22,7 +24,8 @@ namespace gr {
 
 tpb_thread_body::tpb_thread_body(block_sptr block,
                                  gr::thread::barrier_sptr start_sync,
-                                 int max_noutput_items)
+                                 int max_noutput_items,
+                                 const std::vector<int>& cpus)
     : d_exec(block, max_noutput_items)
 {
     // std::cerr << "tpb_thread_body: " << block << std::endl;
@@ -53,8 +56,23 @@ tpb_thread_body::tpb_thread_body(block_sptr block,
     // Set thread affinity if it was set before fg was started.
     if (!block->processor_affinity().empty()) {
         gr::thread::thread_bind_to_processor(d->thread, block->processor_affinity());
+    } else if (!cpus.empty()) {
+        gr::thread::thread_bind_to_processor(d->thread, cpus);
     }
 
+    // Report the usage of the thread however it ends
+    struct usage_guard {
+        const block_sptr& block;
+        ~usage_guard()
+        {
+            if (realtime_profile::get().reports_thread_usage()) {
+                realtime_profile::report_thread_usage(block);
+            }
+        }
+    } usage_report{ block };
+
+    GR_TRACE_THREAD(block->identifier());
+
     // Set thread priority if it was set before fg was started
     if (block->thread_priority() > 0) {
         gr::thread::set_thread_priority(d->thread, block->thread_priority());
@@ -76,7 +94,9 @@ tpb_thread_body::tpb_thread_body(block_sptr block,
             // startup sequence of the threads.
             if (block->has_msg_handler(i.first)) {
                 while ((msg = block->delete_head_nowait(i.first))) {
+                    GR_TRACE_BEGIN(dispatch_msg);
                     block->dispatch_msg(i.first, msg);
+                    GR_TRACE_END(dispatch_msg, 0);
                 }
             } else {
                 // If we don't have a handler but are building up messages,
@@ -111,15 +131,18 @@ tpb_thread_body::tpb_thread_body(block_sptr block,
 
         switch (s) {
         case block_executor::READY: // Tell neighbors we made progress.
+            GR_TRACE_INSTANT(notify_neighbors);
             d->d_tpb.notify_neighbors(d);
             break;
 
         case block_executor::READY_NO_OUTPUT: // Notify upstream only
+            GR_TRACE_INSTANT(notify_upstream);
             d->d_tpb.notify_upstream(d);
             break;
 
         case block_executor::DONE: // Game over.
             block->notify_msg_neighbors();
+            GR_TRACE_INSTANT(notify_neighbors);
             d->d_tpb.notify_neighbors(d);
             return;
 
@@ -131,16 +154,21 @@ tpb_thread_body::tpb_thread_body(block_sptr block,
                 boost::system_time const timeout =
                     boost::get_system_time() +
                     boost::posix_time::milliseconds(block->blkd_input_timer_value());
-                d->d_tpb.input_cond.timed_wait(guard, timeout);
+                GR_TRACE_BEGIN(wait_input);
+                const bool notified = d->d_tpb.input_cond.timed_wait(guard, timeout);
+                GR_TRACE_END(wait_input, notified);
+                static_cast<void>(notified);
             }
         } break;
 
         case block_executor::BLKD_OUT: // Wait for output buffer space.
         {
             gr::thread::scoped_lock guard(d->d_tpb.mutex);
+            GR_TRACE_BEGIN(wait_output);
             while (!d->d_tpb.output_changed) {
                 d->d_tpb.output_cond.wait(guard);
             }
+            GR_TRACE_END(wait_output, 0);
         } break;
 
         default:
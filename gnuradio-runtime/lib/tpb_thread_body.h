@@ -30,9 +30,14 @@ class GR_RUNTIME_API tpb_thread_body
     block_executor d_exec;
 
 public:
+    /*!
+     * \param cpus  the CPUs to bind the thread to if the block has no
+     *              processor affinity, none if empty
+     */
     tpb_thread_body(block_sptr block,
                     thread::barrier_sptr start_sync,
-                    int max_noutput_items = 100000);
+                    int max_noutput_items = 100000,
+                    const std::vector<int>& cpus = std::vector<int>());
     ~tpb_thread_body();
 };
 
@@ -12,11 +12,13 @@ from thrift import Thrift
 from thrift.transport import TSocket
 from thrift.transport import TTransport
 from thrift.protocol import TBinaryProtocol
-from gnuradio.ctrlport.GNURadio import ControlPort
+from gnuradio.ctrlport.GNURadio import ControlPort, StreamReceiver
 from gnuradio.ctrlport import RPCConnection
 from gnuradio import gr
 import pmt
+import struct
 import sys
+import threading
 
 
 class ThriftRadioClient(object):
@@ -41,6 +43,126 @@ class ThriftRadioClient(object):
         return self.radio
 
 
+"""
+Snapshot frames pushed for ControlPort subscriptions, see gnuradio.thrift
+for the format.
+"""
+
+SNAPSHOT_HEADER = struct.Struct('<BBiIqI')
+SNAPSHOT_LAYOUT = 0
+SNAPSHOT_VALUES = 1
+SNAPSHOT_UNSUPPORTED = 255
+
+
+def decode_snapshot(data):
+    """
+    Decode a snapshot frame into (kind, subscription, sequence, time_ns,
+    items), with the knob names as items of a layout frame and the
+    values of a values frame.
+    """
+    from gnuradio.ctrlport.GNURadio.ttypes import BaseTypes
+    (version, kind, subscription, sequence, time_ns,
+     count) = SNAPSHOT_HEADER.unpack_from(data)
+    if version != 1:
+        raise ValueError("unknown snapshot version {0}".format(version))
+    pos = SNAPSHOT_HEADER.size
+
+    def take(fmt):
+        nonlocal pos
+        values = struct.unpack_from(fmt, data, pos)
+        pos += struct.calcsize(fmt)
+        return values
+
+    def take_vector(elem):
+        (n,) = take('<I')
+        return list(take('<{0}{1}'.format(n, elem)))
+
+    items = []
+    for _ in range(count):
+        if kind == SNAPSHOT_LAYOUT:
+            (n,) = take('<H')
+            items.append(bytes(data[pos:pos + n]).decode('utf-8'))
+            pos += n
+            continue
+
+        (code,) = take('<B')
+        if code in (BaseTypes.BOOL, BaseTypes.LONG):
+            (value,) = take('<q')
+            if code == BaseTypes.BOOL:
+                value = bool(value)
+        elif code == BaseTypes.DOUBLE:
+            (value,) = take('<d')
+        elif code == BaseTypes.COMPLEX:
+            value = complex(*take('<2d'))
+        elif code == BaseTypes.STRING:
+            (n,) = take('<I')
+            value = bytes(data[pos:pos + n]).decode('utf-8')
+            pos += n
+        elif code == BaseTypes.F32VECTOR:
+            value = take_vector('f')
+        elif code == BaseTypes.F64VECTOR:
+            value = take_vector('d')
+        elif code == BaseTypes.S64VECTOR:
+            value = take_vector('q')
+        elif code == BaseTypes.S32VECTOR:
+            value = take_vector('i')
+        elif code == BaseTypes.S16VECTOR:
+            value = take_vector('h')
+        elif code == BaseTypes.S8VECTOR:
+            value = take_vector('b')
+        elif code == BaseTypes.C32VECTOR:
+            (n,) = take('<I')
+            v = take('<{0}f'.format(2 * n))
+            value = [complex(re, im) for re, im in zip(v[0::2], v[1::2])]
+        elif code == SNAPSHOT_UNSUPPORTED:
+            value = None
+        else:
+            raise ValueError("unknown knob type {0}".format(code))
+        items.append(value)
+    return (kind, subscription, sequence, time_ns, items)
+
+
+class SnapshotReceiver(object):
+    """
+    Receives the snapshots of one subscription on a listening socket
+    and hands them to callback(time_ns, {knob: value}).
+    """
+
+    def __init__(self, callback, host):
+        from thrift.transport import TSocket
+        self.callback = callback
+        self.names = []
+        self.server = TSocket.TServerSocket(host=host, port=0)
+        self.server.listen()
+        self.host = host
+        self.port = self.server.handle.getsockname()[1]
+        self.thread = threading.Thread(target=self.run, daemon=True)
+        self.thread.start()
+
+    def push(self, data):
+        (kind, _, _, time_ns, items) = decode_snapshot(data)
+        if kind == SNAPSHOT_LAYOUT:
+            self.names = items
+        else:
+            self.callback(time_ns, dict(zip(self.names, items)))
+
+    def run(self):
+        client = self.server.accept()
+        transport = TTransport.TBufferedTransport(client)
+        protocol = TBinaryProtocol.TBinaryProtocol(transport)
+        processor = StreamReceiver.Processor(self)
+        try:
+            while True:
+                processor.process(protocol, protocol)
+        except TTransport.TTransportException:
+            pass
+        finally:
+            transport.close()
+
+    def close(self):
+        self.server.close()
+
+
 """
 RPC Client interface for the Apache Thrift middle-ware RPC transport.
 
@@ -79,6 +201,7 @@ class RPCConnectionThrift(RPCConnection.RPCConnection):
         super(RPCConnectionThrift, self).__init__(
             method='thrift', port=port, host=host)
         self.newConnection(host, port)
+        self.receivers = {}
 
         self.unpack_dict = {
             self.BaseTypes.BOOL: lambda k, b: self.Knob(k, b.value.a_bool, self.BaseTypes.BOOL),
@@ -196,6 +319,34 @@ class RPCConnectionThrift(RPCConnection.RPCConnection):
             sys.stderr.write(
                 "setKnobs: Invalid type; must be dict, list, or tuple\n")
 
+    def subscribe(self, knobs, period_ms, callback, host=None):
+        '''
+        knobs: list of regular expressions for the knobs to stream.
+        period_ms: time between two snapshots in milliseconds.
+        callback: called as callback(time_ns, {knob: value}) from a
+                  receiver thread for every snapshot.
+        host: address the flowgraph connects back to; defaults to the
+              host of this connection.
+        Returns the id of the subscription, for unsubscribe().
+        '''
+        if host is None:
+            host = self.thriftclient.host
+        receiver = SnapshotReceiver(callback, host)
+        try:
+            sid = self.thriftclient.radio.subscribe(
+                list(knobs), int(period_ms), receiver.host, receiver.port)
+        except Exception:
+            receiver.close()
+            raise
+        self.receivers[sid] = receiver
+        return sid
+
+    def unsubscribe(self, sid):
+        receiver = self.receivers.pop(sid, None)
+        self.thriftclient.radio.unsubscribe(sid)
+        if receiver:
+            receiver.close()
+
     def shutdown(self):
         self.thriftclient.radio.shutdown()
 
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(block.h)                                                   */
-/* BINDTOOL_HEADER_FILE_HASH(18c70c95c54b95bab0af13e9fb687530)                     */
+/* BINDTOOL_HEADER_FILE_HASH(78bcc2a152bcf529eb7006f3cc0ecdd0)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
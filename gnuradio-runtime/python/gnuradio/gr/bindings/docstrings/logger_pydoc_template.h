@@ -42,4 +42,8 @@ static const char* __doc_gr_logging_add_default_sink = R"doc()doc";
 static const char* __doc_gr_logging_add_debug_sink = R"doc()doc";
 static const char* __doc_gr_logging_add_default_console_sink = R"doc()doc";
 static const char* __doc_gr_logging_add_debug_console_sink = R"doc()doc";
+static const char* __doc_gr_logging_set_async = R"doc()doc";
+static const char* __doc_gr_logging_is_async = R"doc()doc";
+static const char* __doc_gr_logging_set_rate_limit = R"doc()doc";
+static const char* __doc_gr_logging_dropped_records = R"doc()doc";
 static const char* __doc_gr_logging_default_pattern = R"doc()doc";
@@ -36,6 +36,9 @@ static const char* __doc_gr_top_block_lock = R"doc()doc";
 static const char* __doc_gr_top_block_unlock = R"doc()doc";
 
 
+static const char* __doc_gr_top_block_reconfigure = R"doc()doc";
+
+
 static const char* __doc_gr_top_block_edge_list = R"doc()doc";
 
 
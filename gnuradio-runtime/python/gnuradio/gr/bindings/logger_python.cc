@@ -15,7 +15,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(logger.h)                                                  */
-/* BINDTOOL_HEADER_FILE_HASH(b6745a64dce4f006d5bece226c75a01e)                     */
+/* BINDTOOL_HEADER_FILE_HASH(16200014d4b3986361683eff88aad7df)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -147,6 +147,17 @@ void bind_logger(py::module& m)
         .def("add_debug_console_sink",
              &logging::add_debug_console_sink,
              D(logging, add_debug_console_sink))
+        .def("set_async",
+             &logging::set_async,
+             py::arg("enabled"),
+             py::call_guard<py::gil_scoped_release>(),
+             D(logging, set_async))
+        .def("is_async", &logging::is_async, D(logging, is_async))
+        .def("set_rate_limit",
+             &logging::set_rate_limit,
+             py::arg("records_per_second"),
+             D(logging, set_rate_limit))
+        .def("dropped_records", &logging::dropped_records, D(logging, dropped_records))
         .def_property_readonly_static(
             "default_pattern",
             [](py::object) { return logging::default_pattern; },
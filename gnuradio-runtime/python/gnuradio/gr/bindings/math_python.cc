@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(math.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(85ba2e8e7191733cc35f70005e2d99e9)                     */
+/* BINDTOOL_HEADER_FILE_HASH(b794ab2b695826cfc0e37124737c3bda)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(random.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(489c2917f344c75e2001d0c670de7784)                     */
+/* BINDTOOL_HEADER_FILE_HASH(8986411efe36ddb5c610e2b048392d30)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(top_block.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(96d9ff1131a52a5089606f658e0ff48e)                     */
+/* BINDTOOL_HEADER_FILE_HASH(8bb36fc98c7f06c6d4d628f7b77fd299)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -67,6 +67,11 @@ void top_block_unlock_unlocked(gr::top_block_sptr r) noexcept(false)
     GR_PYTHON_BLOCKING_CODE(r->unlock();)
 }
 
+void top_block_reconfigure_unlocked(gr::top_block_sptr r) noexcept(false)
+{
+    GR_PYTHON_BLOCKING_CODE(r->reconfigure();)
+}
+
 
 void bind_top_block(py::module& m)
 {
@@ -105,6 +110,9 @@ void bind_top_block(py::module& m)
         .def("unlock", &top_block::unlock, D(top_block, unlock))
 
 
+        .def("reconfigure", &top_block::reconfigure, D(top_block, reconfigure))
+
+
         .def("edge_list", &top_block::edge_list, D(top_block, edge_list))
 
 
@@ -151,4 +159,5 @@ void bind_top_block(py::module& m)
     m.def("top_block_wait_unlocked", &top_block_wait_unlocked);
     m.def("top_block_stop_unlocked", &top_block_stop_unlocked);
     m.def("top_block_unlock_unlocked", &top_block_unlock_unlocked);
+    m.def("top_block_reconfigure_unlocked", &top_block_reconfigure_unlocked);
 }
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+#
+# Copyright 2023 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+#
+
+import os
+import socket
+import threading
+
+
+def free_port():
+    with socket.socket() as s:
+        s.bind(('127.0.0.1', 0))
+        return s.getsockname()[1]
+
+
+# ControlPort has to be enabled before the runtime reads its preferences
+PORT = free_port()
+os.environ['GR_CONF_CONTROLPORT_ON'] = 'True'
+os.environ['GR_CONF_THRIFT_PORT'] = str(PORT)
+
+from gnuradio import gr, gr_unittest, blocks  # noqa: E402
+from gnuradio.ctrlport.RPCConnectionThrift import RPCConnectionThrift  # noqa: E402
+
+
+class test_ctrlport_stream(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        src = blocks.null_source(gr.sizeof_float)
+        self.throttle = blocks.throttle(gr.sizeof_float, 1e5)
+        dst = blocks.null_sink(gr.sizeof_float)
+        self.tb.connect(src, self.throttle, dst)
+        self.tb.start()
+
+    def tearDown(self):
+        self.tb.stop()
+        self.tb.wait()
+        self.tb = None
+
+    def test_001_subscribe(self):
+        radio = RPCConnectionThrift('127.0.0.1', PORT)
+        knob = self.throttle.alias() + '::sample_rate'
+
+        snapshots = []
+        received = threading.Event()
+
+        def callback(time_ns, values):
+            snapshots.append((time_ns, values))
+            if len(snapshots) >= 3:
+                received.set()
+
+        sid = radio.subscribe([self.throttle.alias() + '::.*'], 10, callback)
+        self.assertTrue(received.wait(10))
+        radio.unsubscribe(sid)
+
+        times = [t for t, _ in snapshots[:3]]
+        self.assertEqual(times, sorted(times))
+        for _, values in snapshots[:3]:
+            self.assertAlmostEqual(values[knob], 1e5)
+
+        with self.assertRaises(Exception):
+            radio.unsubscribe(sid)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_ctrlport_stream)
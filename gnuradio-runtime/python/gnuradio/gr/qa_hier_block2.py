@@ -143,6 +143,107 @@ class test_hier_block2(gr_unittest.TestCase):
         tb.stop()
         tb.wait()
 
+    def test_013_reconfigure(self):
+        # Swap the block of one branch while the other one keeps running
+        nitems = 10**6
+        tags = []
+        for offset in range(0, nitems, 1000):
+            tag = gr.tag_t()
+            tag.offset = offset
+            tag.key = pmt.intern("count")
+            tag.value = pmt.from_uint64(offset)
+            tags.append(tag)
+
+        tb = gr.top_block()
+        src_a = blocks.vector_source_f([1.0], repeat=True)
+        thr_a = blocks.throttle(gr.sizeof_float, 100000)
+        probe_a = blocks.probe_signal_f()
+        src_b = blocks.vector_source_f(list(range(nitems)), False, 1, tags)
+        thr_b = blocks.throttle(gr.sizeof_float, 100000)
+        mult_pos = blocks.multiply_const_ff(1.0)
+        dst_b = blocks.vector_sink_f()
+        tb.connect(src_a, thr_a, probe_a)
+        tb.connect(src_b, thr_b, mult_pos, dst_b)
+        tb.start()
+        time.sleep(0.2)
+
+        mult_neg = blocks.multiply_const_ff(-1.0)
+        tb.disconnect(thr_b, mult_pos)
+        tb.disconnect(mult_pos, dst_b)
+        tb.connect(thr_b, mult_neg, dst_b)
+        nread = probe_a.nitems_read(0)
+        tb.reconfigure()
+        time.sleep(0.2)
+        tb.stop()
+        tb.wait()
+        # not restarted, so the item counters carry on
+        self.assertGreater(probe_a.nitems_read(0), nread)
+
+        # The new block starts where the old one stopped reading, without
+        # reading earlier items of the running buffer again
+        data = dst_b.data()
+        swap = next(i for i, x in enumerate(data) if x < 0)
+        before = data[:swap]
+        after = [-x for x in data[swap:]]
+        self.assertGreater(len(after), 1000)
+        self.assertEqual(list(before), [float(i) for i in range(len(before))])
+        self.assertGreater(after[0], before[-1])
+        self.assertEqual(after, [after[0] + i for i in range(len(after))])
+
+        # Tags keep the offsets of the items they were put on
+        result = dst_b.tags()
+        self.assertGreater(len(result), 0)
+        self.assertTrue(any(tag.offset > after[0] for tag in result))
+        for tag in result:
+            self.assertEqual(pmt.to_uint64(tag.value), tag.offset)
+
+    def test_014_reconfigure_port_count(self):
+        # A second input on a running block falls back to a full restart
+        tb = gr.top_block()
+        src_a = blocks.vector_source_f([1.0], repeat=True)
+        thr_a = blocks.throttle(gr.sizeof_float, 100000)
+        add = blocks.add_ff()
+        probe = blocks.probe_signal_f()
+        tb.connect(src_a, thr_a, add, probe)
+        tb.start()
+        time.sleep(0.2)
+        self.assertEqual(probe.level(), 1.0)
+
+        src_b = blocks.vector_source_f([1.0], repeat=True)
+        thr_b = blocks.throttle(gr.sizeof_float, 100000)
+        tb.connect(src_b, thr_b, (add, 1))
+        nread = probe.nitems_read(0)
+        tb.reconfigure()
+        time.sleep(0.05)
+        self.assertEqual(probe.level(), 2.0)
+        # restarted, so the item counters were reset
+        self.assertLess(probe.nitems_read(0), nread)
+        tb.stop()
+        tb.wait()
+
+    def test_015_reconfigure_message(self):
+        # Move a message connection to a new block
+        tb = gr.top_block()
+        strobe = blocks.message_strobe(pmt.intern("hi"), 10)
+        dbg_a = blocks.message_debug()
+        tb.msg_connect(strobe, "strobe", dbg_a, "store")
+        tb.start()
+        time.sleep(0.2)
+        self.assertGreater(dbg_a.num_messages(), 0)
+
+        dbg_b = blocks.message_debug()
+        tb.msg_disconnect(strobe, "strobe", dbg_a, "store")
+        tb.msg_connect(strobe, "strobe", dbg_b, "store")
+        tb.reconfigure()
+        time.sleep(0.05)
+        nmsgs = dbg_a.num_messages()
+        time.sleep(0.2)
+        self.assertEqual(dbg_a.num_messages(), nmsgs)
+        self.assertGreater(dbg_b.num_messages(), 0)
+        self.assertTrue(pmt.eq(dbg_b.get_message(0), pmt.intern("hi")))
+        tb.stop()
+        tb.wait()
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_hier_block2)
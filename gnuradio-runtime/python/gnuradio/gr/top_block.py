@@ -12,7 +12,8 @@
 from .gr_python import (top_block_pb,
                         top_block_wait_unlocked, top_block_run_unlocked,
                         top_block_start_unlocked, top_block_stop_unlocked,
-                        top_block_unlock_unlocked, logger)  # , dot_graph_tb)
+                        top_block_unlock_unlocked,
+                        top_block_reconfigure_unlocked, logger)  # , dot_graph_tb)
 
 from .hier_block2 import hier_block2
 import threading
@@ -134,6 +135,13 @@ class top_block(hier_block2):
         """
         top_block_unlock_unlocked(self._impl)
 
+    def reconfigure(self):
+        """
+        Apply changed connections to the running flow-graph, restarting
+        only the blocks whose connections changed.
+        """
+        top_block_reconfigure_unlocked(self._impl)
+
     def wait(self):
         """
         Wait for the flowgraph to finish running
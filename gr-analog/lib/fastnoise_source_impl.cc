@@ -16,6 +16,8 @@
 #include "fastnoise_source_impl.h"
 #include <gnuradio/io_signature.h>
 #include <gnuradio/xoroshiro128p.h>
+#include <volk/volk.h>
+#include <algorithm>
 #include <type_traits>
 #include <stdexcept>
 #include <vector>
@@ -46,16 +48,17 @@ void fastnoise_source_impl<gr_complex>::generate()
                              noutput_items);
     }
 
+    float* samples = reinterpret_cast<float*>(d_samples.data());
     switch (d_type) {
     case GR_UNIFORM:
-        for (size_t i = 0; i < noutput_items; i++)
-            d_samples[i] = gr_complex(d_ampl * ((d_rng.ran1() * 2.0) - 1.0),
-                                      d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
+        d_rng.fill_uniform(samples, 2 * noutput_items);
+        for (size_t i = 0; i < 2 * noutput_items; i++)
+            samples[i] = d_ampl * ((samples[i] * 2.0f) - 1.0f);
         break;
 
     case GR_GAUSSIAN:
-        for (size_t i = 0; i < noutput_items; i++)
-            d_samples[i] = d_ampl * d_rng.rayleigh_complex();
+        d_rng.fill_gaussian(d_samples.data(), noutput_items);
+        volk_32f_s32f_multiply_32f(samples, samples, d_ampl, 2 * noutput_items);
         break;
     default:
         throw std::runtime_error("invalid type");
@@ -83,6 +86,9 @@ fastnoise_source_impl<T>::fastnoise_source_impl(noise_type_t type,
     }
     d_samples.resize(samples);
     xoroshiro128p_seed(d_state, seed);
+    // derive the index streams from the scalar one, so that they are independent of
+    // the streams d_rng uses to fill the pool
+    xoroshiro128p_seed_lanes(d_lanes, xoroshiro128p_next(d_state));
     this->d_logger->debug("Initializing {:s} pool of size {:d} with seed {:x}",
                           std::is_arithmetic_v<T> ? "arithmetic" : "unknown",
                           samples,
@@ -112,6 +118,9 @@ fastnoise_source_impl<gr_complex>::fastnoise_source_impl(noise_type_t type,
     }
     d_samples.resize(samples);
     xoroshiro128p_seed(d_state, seed);
+    // derive the index streams from the scalar one, so that they are independent of
+    // the streams d_rng uses to fill the pool
+    xoroshiro128p_seed_lanes(d_lanes, xoroshiro128p_next(d_state));
     this->d_logger->debug(
         "Initializing {:s} pool of size {:d} with seed {:x}", "complex", samples, seed);
     generate();
@@ -155,20 +164,27 @@ void fastnoise_source_impl<T>::generate()
         this->d_logger->info("Generating {:d} values. This might take a while.",
                              noutput_items);
     }
+    std::vector<float> values;
     switch (d_type) {
     case GR_UNIFORM:
+        values.resize(noutput_items);
+        d_rng.fill_uniform(values.data(), noutput_items);
         for (size_t i = 0; i < noutput_items; i++)
-            d_samples[i] = (T)(d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
+            d_samples[i] = (T)(d_ampl * ((values[i] * 2.0f) - 1.0f));
         break;
 
     case GR_GAUSSIAN:
+        values.resize(noutput_items);
+        d_rng.fill_gaussian(values.data(), noutput_items);
         for (size_t i = 0; i < noutput_items; i++)
-            d_samples[i] = (T)(d_ampl * d_rng.gasdev());
+            d_samples[i] = (T)(d_ampl * values[i]);
         break;
 
     case GR_LAPLACIAN:
+        values.resize(noutput_items);
+        d_rng.fill_laplacian(values.data(), noutput_items);
         for (size_t i = 0; i < noutput_items; i++)
-            d_samples[i] = (T)(d_ampl * d_rng.laplacian());
+            d_samples[i] = (T)(d_ampl * values[i]);
         break;
 
     case GR_IMPULSE: // FIXME changeable impulse settings
@@ -190,8 +206,21 @@ int fastnoise_source_impl<T>::work(int noutput_items,
 
     T* out = (T*)output_items[0];
 
-    for (int i = 0; i < noutput_items; i++) {
-        out[i] = sample();
+    // draw the pool indices in bulk from the interleaved streams, then gather
+    constexpr int block = 256;
+    uint64_t indices[block];
+    for (int i = 0; i < noutput_items; i += block) {
+        const int n = std::min(block, noutput_items - i);
+        xoroshiro128p_fill(d_lanes, indices, n);
+        if (d_bitmask) {
+            for (int j = 0; j < n; j++) {
+                out[i + j] = d_samples[indices[j] & d_bitmask];
+            }
+        } else {
+            for (int j = 0; j < n; j++) {
+                out[i + j] = d_samples[indices[j] % d_samples.size()];
+            }
+        }
     }
 
     return noutput_items;
@@ -28,6 +28,7 @@ private:
     gr::random d_rng;
     std::vector<T> d_samples;
     uint64_t d_state[2];
+    uint64_t d_lanes[2 * XOROSHIRO128P_LANES]; // pool index streams used by work()
     size_t d_bitmask;
 
 public:
@@ -15,7 +15,9 @@
 
 #include "noise_source_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
 #include <stdexcept>
+#include <type_traits>
 
 namespace gr {
 namespace analog {
@@ -73,6 +75,31 @@ void noise_source_impl<gr_complex>::set_amplitude(float ampl)
 }
 
 
+template <class T>
+void noise_source_impl<T>::fill(float* out, int n)
+{
+    switch (d_type) {
+    case GR_UNIFORM:
+        d_rng.fill_uniform(out, n);
+        for (int i = 0; i < n; i++) {
+            out[i] = d_ampl * (out[i] * 2.0f - 1.0f);
+        }
+        return;
+
+    case GR_GAUSSIAN:
+        d_rng.fill_gaussian(out, n);
+        break;
+
+    case GR_LAPLACIAN:
+        d_rng.fill_laplacian(out, n);
+        break;
+
+    default:
+        throw std::runtime_error("invalid type");
+    }
+    volk_32f_s32f_multiply_32f(out, out, d_ampl, n);
+}
+
 template <class T>
 int noise_source_impl<T>::work(int noutput_items,
                                gr_vector_const_void_star& input_items,
@@ -84,20 +111,16 @@ int noise_source_impl<T>::work(int noutput_items,
 
     switch (d_type) {
     case GR_UNIFORM:
-        for (int i = 0; i < noutput_items; i++) {
-            out[i] = (T)(d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
-        }
-        break;
-
     case GR_GAUSSIAN:
-        for (int i = 0; i < noutput_items; i++) {
-            out[i] = (T)(d_ampl * d_rng.gasdev());
-        }
-        break;
-
     case GR_LAPLACIAN:
-        for (int i = 0; i < noutput_items; i++) {
-            out[i] = (T)(d_ampl * d_rng.laplacian());
+        if constexpr (std::is_same_v<T, float>) {
+            fill(out, noutput_items);
+        } else {
+            d_buffer.resize(noutput_items);
+            fill(d_buffer.data(), noutput_items);
+            for (int i = 0; i < noutput_items; i++) {
+                out[i] = (T)d_buffer[i];
+            }
         }
         break;
 
@@ -125,16 +148,13 @@ int noise_source_impl<gr_complex>::work(int noutput_items,
     switch (d_type) {
 
     case GR_UNIFORM:
-        for (int i = 0; i < noutput_items; i++) {
-            out[i] = gr_complex(d_ampl * ((d_rng.ran1() * 2.0) - 1.0),
-                                d_ampl * ((d_rng.ran1() * 2.0) - 1.0));
-        }
+        // real and imaginary parts are independent, so fill them as 2N floats
+        fill((float*)out, 2 * noutput_items);
         break;
 
     case GR_GAUSSIAN:
-        for (int i = 0; i < noutput_items; i++) {
-            out[i] = d_ampl * d_rng.rayleigh_complex();
-        }
+        d_rng.fill_gaussian(out, noutput_items);
+        volk_32f_s32f_multiply_32f((float*)out, (float*)out, d_ampl, 2 * noutput_items);
         break;
 
     default:
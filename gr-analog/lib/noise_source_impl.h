@@ -14,6 +14,7 @@
 
 #include <gnuradio/analog/noise_source.h>
 #include <gnuradio/random.h>
+#include <vector>
 
 namespace gr {
 namespace analog {
@@ -24,6 +25,10 @@ class noise_source_impl : public noise_source<T>
     noise_type_t d_type;
     float d_ampl;
     gr::random d_rng;
+    std::vector<float> d_buffer; // bulk variates for non-float output types
+
+    // fill out with n scaled variates of the current (bulk-capable) type
+    void fill(float* out, int n);
 
 public:
     noise_source_impl(noise_type_t type, float ampl, uint64_t seed = 0);
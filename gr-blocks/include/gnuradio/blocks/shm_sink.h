@@ -0,0 +1,54 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_BLOCKS_SHM_SINK_H
+#define INCLUDED_BLOCKS_SHM_SINK_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+#include <string>
+
+namespace gr {
+namespace blocks {
+
+/*!
+ * \brief Hand a stream to another process through shared memory.
+ * \ingroup misc_blk
+ *
+ * \details
+ * The block upstream writes its items straight into a ring in the
+ * shared-memory segment \p name, from which a shm_source of the same
+ * name in another process passes them on without copying. The space of
+ * the items is only reused after the shm_source has read them, so a
+ * slow or stopped consumer holds back this flowgraph. Stream tags are
+ * passed along with the items.
+ *
+ * The side started first creates the segment, the last one to stop
+ * removes it.
+ */
+class BLOCKS_API shm_sink : virtual public sync_block
+{
+public:
+    // gr::blocks::shm_sink::sptr
+    typedef std::shared_ptr<shm_sink> sptr;
+
+    /*!
+     * Build a shared-memory sink block.
+     *
+     * \param itemsize size of the stream items in bytes.
+     * \param name name of the shared-memory segment.
+     */
+    static sptr make(size_t itemsize, const std::string& name);
+};
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_SHM_SINK_H */
@@ -0,0 +1,51 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_BLOCKS_SHM_SOURCE_H
+#define INCLUDED_BLOCKS_SHM_SOURCE_H
+
+#include <gnuradio/blocks/api.h>
+#include <gnuradio/sync_block.h>
+#include <string>
+
+namespace gr {
+namespace blocks {
+
+/*!
+ * \brief Receive a stream from another process through shared memory.
+ * \ingroup misc_blk
+ *
+ * \details
+ * Produces the items a shm_sink of the same \p name writes into the
+ * shared-memory segment, in place: the blocks downstream read them
+ * from the ring the other process wrote. Stream tags arrive with their
+ * items. When restarted, the source resumes with the first item the
+ * blocks downstream had not read. It is done when the flowgraph of
+ * the shm_sink ran out of items.
+ */
+class BLOCKS_API shm_source : virtual public sync_block
+{
+public:
+    // gr::blocks::shm_source::sptr
+    typedef std::shared_ptr<shm_source> sptr;
+
+    /*!
+     * Build a shared-memory source block.
+     *
+     * \param itemsize size of the stream items in bytes.
+     * \param name name of the shared-memory segment.
+     */
+    static sptr make(size_t itemsize, const std::string& name);
+};
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_SHM_SOURCE_H */
@@ -76,6 +76,43 @@ public:
 
     //! Get the maximum items that will be produced per waiting period
     virtual unsigned int maximum_items_per_chunk() const = 0;
+
+    /*!
+     * \brief Only wait once the block runs ahead of the sample rate by
+     * more than \p seconds.
+     *
+     * The block then waits until it is back on schedule, so that it
+     * wakes up about once per burst instead of once per call to work.
+     * The average rate is the same; 0 (the default) waits whenever the
+     * block is ahead.
+     */
+    virtual void set_burst_duration(double seconds) = 0;
+
+    //! Get the time the block may run ahead of the sample rate
+    virtual double burst_duration() const = 0;
+
+    /*!
+     * \brief Busy-wait for the last \p seconds before each deadline
+     * instead of sleeping.
+     *
+     * Waking up from a sleep takes some tens of microseconds, and up
+     * to the timer slack of the thread; spinning over that time keeps
+     * the wake-ups on time at the cost of CPU time. 0 (the default)
+     * always sleeps.
+     */
+    virtual void set_spin_duration(double seconds) = 0;
+
+    //! Get the time spent busy-waiting before each deadline
+    virtual double spin_duration() const = 0;
+
+    /*!
+     * \brief Smoothed time in seconds by which waits overshoot their
+     * deadline.
+     *
+     * Deadlines are absolute, so a late wake-up shortens the next wait
+     * instead of slowing down the stream; this is the correction applied.
+     */
+    virtual double pacing_error() const = 0;
 };
 
 } /* namespace blocks */
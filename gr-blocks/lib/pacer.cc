@@ -0,0 +1,60 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pacer.h"
+#include <thread>
+
+#ifdef __linux__
+#include <cerrno>
+#include <ctime>
+#endif
+
+namespace gr {
+namespace blocks {
+
+void pacer::sleep_until(clock::time_point deadline)
+{
+#ifdef __linux__
+    // steady_clock counts CLOCK_MONOTONIC on Linux
+    const auto since_epoch =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch());
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(since_epoch.count() / 1000000000);
+    ts.tv_nsec = static_cast<long>(since_epoch.count() % 1000000000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+pacer::clock::duration pacer::wait_until(clock::time_point deadline) const
+{
+    auto now = clock::now();
+    if (now >= deadline) {
+        return now - deadline;
+    }
+
+    if (deadline - now > d_spin) {
+        sleep_until(deadline - d_spin);
+        now = clock::now();
+    }
+    while (now < deadline) {
+        now = clock::now();
+    }
+    return now - deadline;
+}
+
+} /* namespace blocks */
+} /* namespace gr */
@@ -0,0 +1,53 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_GR_BLOCKS_PACER_H
+#define INCLUDED_GR_BLOCKS_PACER_H
+
+#include <chrono>
+
+namespace gr {
+namespace blocks {
+
+/*!
+ * \brief Waits for absolute deadlines on the steady clock.
+ *
+ * \details
+ * The pacer sleeps until shortly before the deadline and busy-waits
+ * for the rest, so that the wake-up is not left to the granularity of
+ * the OS scheduler. On Linux, the sleep is an absolute
+ * clock_nanosleep on CLOCK_MONOTONIC, so that time spent before the
+ * thread actually goes to sleep is not added to the wait.
+ */
+class pacer
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    //! Busy-wait for the last \p spin before a deadline, 0 to only sleep
+    void set_spin(clock::duration spin) { d_spin = spin; }
+    clock::duration spin() const { return d_spin; }
+
+    /*!
+     * Wait until \p deadline.
+     * \returns the time by which the wake-up missed the deadline
+     */
+    clock::duration wait_until(clock::time_point deadline) const;
+
+private:
+    clock::duration d_spin = clock::duration::zero();
+
+    static void sleep_until(clock::time_point deadline);
+};
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_GR_BLOCKS_PACER_H */
@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_sink_impl.h"
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer_reader.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace gr {
+namespace blocks {
+
+shm_sink::sptr shm_sink::make(size_t itemsize, const std::string& name)
+{
+    return gnuradio::make_block_sptr<shm_sink_impl>(itemsize, name);
+}
+
+shm_sink_impl::shm_sink_impl(size_t itemsize, const std::string& name)
+    : sync_block("shm_sink",
+                 io_signature::make(1, 1, itemsize, buffer_shm::type),
+                 io_signature::make(0, 0, 0)),
+      d_name(name),
+      d_published(0)
+{
+    if (name.empty())
+        throw std::invalid_argument("shm_sink: the segment needs a name");
+    set_tag_propagation_policy(TPP_DONT);
+}
+
+shm_sink_impl::~shm_sink_impl() {}
+
+std::string shm_sink_impl::shm_name() const { return d_name; }
+
+bool shm_sink_impl::start()
+{
+    // The block upstream writes into the buffer of this block
+    d_buffer = std::dynamic_pointer_cast<buffer_shm>(detail()->input(0)->buffer());
+    if (!d_buffer)
+        throw std::runtime_error("shm_sink: input is not a shared-memory buffer");
+
+    d_buffer->attach_producer();
+    d_published = d_buffer->published();
+    return true;
+}
+
+bool shm_sink_impl::stop()
+{
+    if (d_buffer) {
+        // Only a flowgraph that ran out of items ends the stream
+        buffer_reader_sptr reader = detail()->input(0);
+        d_buffer->detach_producer(reader->done() && reader->items_available() == 0);
+        d_buffer.reset();
+    }
+    return true;
+}
+
+int shm_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star& input_items,
+                        gr_vector_void_star& output_items)
+{
+    buffer_reader_sptr reader = detail()->input(0);
+    const uint64_t offset = d_buffer->offset();
+    const uint64_t start = offset + nitems_read(0);
+    const uint64_t end = start + reader->items_available();
+
+    // The items are in the ring already, only their number and tags
+    // are handed over; all that arrived, not only the noutput_items
+    // consumed here.
+    if (end > d_published) {
+        const uint64_t first = std::max(start, d_published);
+        d_tags.clear();
+        get_tags_in_range(d_tags, 0, first - offset, end - offset);
+        for (tag_t& tag : d_tags)
+            tag.offset += offset;
+        const size_t dropped = d_buffer->push_tags(d_tags);
+        if (dropped > 0) {
+            d_logger->warn("dropped {:d} tags the consumer did not take", dropped);
+        }
+        d_buffer->publish(end);
+        d_published = end;
+    }
+
+    // Consume what the consumer released. Return early when more items
+    // come in meanwhile, so that they are published too. Once the block
+    // upstream is done nothing overwrites the ring anymore, and the
+    // items the consumer keeps as history need not be waited for.
+    while (true) {
+        const uint32_t seq = d_buffer->sequence();
+        const uint64_t released = d_buffer->released();
+        if (released > start)
+            return (int)std::min<uint64_t>(released - start, noutput_items);
+        if (start + reader->items_available() > d_published)
+            return 0;
+        if (reader->done())
+            return noutput_items;
+        d_buffer->wait(seq, 10000);
+    }
+}
+
+} /* namespace blocks */
+} /* namespace gr */
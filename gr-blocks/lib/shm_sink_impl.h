@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_BLOCKS_SHM_SINK_IMPL_H
+#define INCLUDED_BLOCKS_SHM_SINK_IMPL_H
+
+#include <gnuradio/blocks/shm_sink.h>
+#include <gnuradio/buffer_shm.h>
+
+namespace gr {
+namespace blocks {
+
+class shm_sink_impl : public shm_sink, public buffer_shm::owner
+{
+private:
+    const std::string d_name;
+    std::shared_ptr<buffer_shm> d_buffer;
+    uint64_t d_published;
+    std::vector<tag_t> d_tags;
+
+public:
+    shm_sink_impl(size_t itemsize, const std::string& name);
+    ~shm_sink_impl() override;
+
+    std::string shm_name() const override;
+
+    bool start() override;
+    bool stop() override;
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override;
+};
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_SHM_SINK_IMPL_H */
@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_source_impl.h"
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer_reader.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace gr {
+namespace blocks {
+
+shm_source::sptr shm_source::make(size_t itemsize, const std::string& name)
+{
+    return gnuradio::make_block_sptr<shm_source_impl>(itemsize, name);
+}
+
+shm_source_impl::shm_source_impl(size_t itemsize, const std::string& name)
+    : sync_block("shm_source",
+                 io_signature::make(0, 0, 0),
+                 io_signature::make(1, 1, itemsize, buffer_shm::type)),
+      d_name(name)
+{
+    if (name.empty())
+        throw std::invalid_argument("shm_source: the segment needs a name");
+}
+
+shm_source_impl::~shm_source_impl() {}
+
+std::string shm_source_impl::shm_name() const { return d_name; }
+
+bool shm_source_impl::start()
+{
+    d_buffer = std::dynamic_pointer_cast<buffer_shm>(detail()->output(0));
+    if (!d_buffer)
+        throw std::runtime_error("shm_source: output is not a shared-memory buffer");
+
+    d_buffer->attach_consumer();
+    return true;
+}
+
+bool shm_source_impl::stop()
+{
+    if (d_buffer) {
+        release_read_items();
+        d_buffer->detach_consumer();
+        d_buffer.reset();
+    }
+    return true;
+}
+
+/*
+ * Hands the items all blocks downstream are done with back to the
+ * producer, keeping those they still need as history.
+ */
+uint64_t shm_source_impl::release_read_items()
+{
+    buffer_sptr out = detail()->output(0);
+    uint64_t nread = nitems_written(0);
+    uint64_t nreleased = nread;
+    {
+        gr::thread::scoped_lock guard(*out->mutex());
+        for (size_t i = 0; i < out->nreaders(); i++) {
+            const buffer_reader* reader = out->reader(i);
+            const uint64_t history = reader->link()->history() - 1;
+            const uint64_t n = reader->nitems_read();
+            nread = std::min(nread, n);
+            nreleased = std::min(nreleased, n > history ? n - history : 0);
+        }
+    }
+
+    const uint64_t offset = d_buffer->offset();
+    d_buffer->release(offset + nreleased, offset + nread);
+    return offset + nreleased;
+}
+
+int shm_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star& input_items,
+                          gr_vector_void_star& output_items)
+{
+    const uint64_t offset = d_buffer->offset();
+    const uint64_t start = offset + nitems_written(0);
+
+    // Blocks downstream do not wake this block when they read, so the
+    // items they are done with are released on every pass. Only while
+    // they hold items the producer may be waiting for is that done often.
+    uint64_t published;
+    while (true) {
+        const uint32_t seq = d_buffer->sequence();
+        const uint64_t released = release_read_items();
+        published = d_buffer->published();
+        if (published > start)
+            break;
+        if (d_buffer->eof() && d_buffer->published() <= start)
+            return WORK_DONE;
+        d_buffer->wait(seq, released < start ? 1000 : 100000);
+    }
+
+    // The producer wrote the items to where they are produced
+    const int n = (int)std::min<uint64_t>(published - start, noutput_items);
+
+    d_tags.clear();
+    d_buffer->pop_tags(start, start + n, d_tags);
+    for (tag_t& tag : d_tags) {
+        tag.offset -= offset;
+        add_item_tag(0, tag);
+    }
+
+    return n;
+}
+
+} /* namespace blocks */
+} /* namespace gr */
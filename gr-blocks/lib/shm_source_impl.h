@@ -0,0 +1,46 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_BLOCKS_SHM_SOURCE_IMPL_H
+#define INCLUDED_BLOCKS_SHM_SOURCE_IMPL_H
+
+#include <gnuradio/blocks/shm_source.h>
+#include <gnuradio/buffer_shm.h>
+
+namespace gr {
+namespace blocks {
+
+class shm_source_impl : public shm_source, public buffer_shm::owner
+{
+private:
+    const std::string d_name;
+    std::shared_ptr<buffer_shm> d_buffer;
+    std::vector<tag_t> d_tags;
+
+    uint64_t release_read_items();
+
+public:
+    shm_source_impl(size_t itemsize, const std::string& name);
+    ~shm_source_impl() override;
+
+    std::string shm_name() const override;
+
+    bool start() override;
+    bool stop() override;
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override;
+};
+
+} /* namespace blocks */
+} /* namespace gr */
+
+#endif /* INCLUDED_BLOCKS_SHM_SOURCE_IMPL_H */
@@ -57,14 +57,17 @@ int tagged_stream_align_impl::general_work(int noutput_items,
         consume_each(ncp);
         return ncp;
     } else {
-        get_tags_in_range(
-            tags, 0, nitems_read(0), nitems_read(0) + ninput_items[0], d_lengthtag);
-        if (!tags.empty()) {
-            d_have_sync = true;
-            consume_each(tags[0].offset - nitems_read(0));
-        } else {
-            consume_each(ninput_items[0]);
-        }
+        uint64_t sync_offset = nitems_read(0) + ninput_items[0];
+        visit_tags_in_range(0,
+                            nitems_read(0),
+                            nitems_read(0) + ninput_items[0],
+                            d_lengthtag,
+                            [&](const tag_t& tag) {
+                                d_have_sync = true;
+                                sync_offset = tag.offset;
+                                return false;
+                            });
+        consume_each(sync_offset - nitems_read(0));
         return 0;
     }
 }
@@ -19,11 +19,13 @@
 #include <gnuradio/io_signature.h>
 #include <algorithm>
 #include <cstring>
-#include <limits>
-#include <thread>
+#include <stdexcept>
 
 pmt::pmt_t throttle_rx_rate_pmt(pmt::intern("rx_rate"));
 
+// Weight of the latest wake-up in the smoothed pacing error
+constexpr double PACING_ERROR_ALPHA = 0.01;
+
 namespace gr {
 namespace blocks {
 
@@ -56,6 +58,7 @@ bool throttle_impl::start()
 {
     d_total_items = 0;
     d_start = std::chrono::steady_clock::now();
+    d_pacing_error = 0;
     return block::start();
 }
 
@@ -82,6 +85,37 @@ unsigned int throttle_impl::maximum_items_per_chunk() const
     return d_maximum_items_per_chunk;
 }
 
+void throttle_impl::set_burst_duration(double seconds)
+{
+    if (seconds < 0) {
+        throw std::invalid_argument("throttle: burst duration must not be negative");
+    }
+    gr::thread::scoped_lock lock(d_setlock);
+    d_burst_duration = std::chrono::duration<double>(seconds);
+}
+
+double throttle_impl::burst_duration() const { return d_burst_duration.count(); }
+
+void throttle_impl::set_spin_duration(double seconds)
+{
+    if (seconds < 0) {
+        throw std::invalid_argument("throttle: spin duration must not be negative");
+    }
+    gr::thread::scoped_lock lock(d_setlock);
+    d_pacer.set_spin(std::chrono::duration_cast<pacer::clock::duration>(
+        std::chrono::duration<double>(seconds)));
+}
+
+double throttle_impl::spin_duration() const
+{
+    return std::chrono::duration<double>(d_pacer.spin()).count();
+}
+
+double throttle_impl::pacing_error() const
+{
+    return d_pacing_error.load(std::memory_order_relaxed);
+}
+
 int throttle_impl::work(int noutput_items,
                         gr_vector_const_void_star& input_items,
                         gr_vector_void_star& output_items)
@@ -122,24 +156,37 @@ int throttle_impl::work(int noutput_items,
                     items_per_chunk * d_itemsize);
     }
 
-    const auto now = std::chrono::steady_clock::now();
-    decltype(d_start + d_sample_period * 1U) expected_time;
+    const auto now = pacer::clock::now();
+    std::chrono::duration<double> ahead;
+    std::chrono::duration<double> burst;
+    pacer timer;
 
-    // calculate the point in time until which we should wait
+    // calculate how far ahead of the sample rate we are
     // protect against corruption of complex timepoint object when set_sample_rate is
     // called concurrently
     {
         gr::thread::scoped_lock lock(d_setlock);
-        expected_time = d_start + d_sample_period * (d_total_items + items_per_chunk);
+        ahead = d_start - now + d_sample_period * (d_total_items + items_per_chunk);
+        burst = d_burst_duration;
+        timer = d_pacer;
     }
-    if (expected_time > now) {
+    if (ahead > burst) {
         constexpr auto limit_duration =
-            std::chrono::duration<double>(std::numeric_limits<long>::max());
-        if (expected_time - now > limit_duration) {
+            std::chrono::duration<double>(pacer::clock::duration::max()) / 2;
+        if (ahead > limit_duration) {
             d_logger->error("WARNING: Throttle sleep time overflow! You are probably "
                             "using a very low sample rate.");
+            ahead = limit_duration;
         }
-        std::this_thread::sleep_until(expected_time);
+        // Wait until we are back on schedule, the deadline does not depend
+        // on how late we were woken up last time.
+        const auto late = timer.wait_until(
+            now + std::chrono::duration_cast<pacer::clock::duration>(ahead));
+        const double error = d_pacing_error.load(std::memory_order_relaxed);
+        d_pacing_error.store(
+            error +
+                PACING_ERROR_ALPHA * (std::chrono::duration<double>(late).count() - error),
+            std::memory_order_relaxed);
     }
 
     // increase number of processes items
@@ -177,6 +224,66 @@ void throttle_impl::setup_rpc()
                                                     "Sample Rate",
                                                     RPC_PRIVLVL_MIN,
                                                     DISPTIME | DISPOPTSTRIP));
+
+    d_rpc_vars.emplace_back(
+        new rpcbasic_register_get<throttle, double>(alias(),
+                                                    "burst_duration",
+                                                    &throttle::burst_duration,
+                                                    pmt::mp(0.0),
+                                                    pmt::mp(1.0),
+                                                    pmt::mp(0.0),
+                                                    "s",
+                                                    "Burst Duration",
+                                                    RPC_PRIVLVL_MIN,
+                                                    DISPNULL));
+
+    d_rpc_vars.emplace_back(
+        new rpcbasic_register_set<throttle, double>(alias(),
+                                                    "burst_duration",
+                                                    &throttle::set_burst_duration,
+                                                    pmt::mp(0.0),
+                                                    pmt::mp(1.0),
+                                                    pmt::mp(0.0),
+                                                    "s",
+                                                    "Burst Duration",
+                                                    RPC_PRIVLVL_MIN,
+                                                    DISPNULL));
+
+    d_rpc_vars.emplace_back(
+        new rpcbasic_register_get<throttle, double>(alias(),
+                                                    "spin_duration",
+                                                    &throttle::spin_duration,
+                                                    pmt::mp(0.0),
+                                                    pmt::mp(1.0),
+                                                    pmt::mp(0.0),
+                                                    "s",
+                                                    "Spin Duration",
+                                                    RPC_PRIVLVL_MIN,
+                                                    DISPNULL));
+
+    d_rpc_vars.emplace_back(
+        new rpcbasic_register_set<throttle, double>(alias(),
+                                                    "spin_duration",
+                                                    &throttle::set_spin_duration,
+                                                    pmt::mp(0.0),
+                                                    pmt::mp(1.0),
+                                                    pmt::mp(0.0),
+                                                    "s",
+                                                    "Spin Duration",
+                                                    RPC_PRIVLVL_MIN,
+                                                    DISPNULL));
+
+    d_rpc_vars.emplace_back(
+        new rpcbasic_register_get<throttle, double>(alias(),
+                                                    "pacing_error",
+                                                    &throttle::pacing_error,
+                                                    pmt::mp(0.0),
+                                                    pmt::mp(1.0e-3),
+                                                    pmt::mp(0.0),
+                                                    "s",
+                                                    "Pacing Error",
+                                                    RPC_PRIVLVL_MIN,
+                                                    DISPTIME | DISPOPTSTRIP));
 #endif /* GR_CTRLPORT */
 }
 
@@ -11,7 +11,9 @@
 #ifndef INCLUDED_GR_THROTTLE_IMPL_H
 #define INCLUDED_GR_THROTTLE_IMPL_H
 
+#include "pacer.h"
 #include <gnuradio/blocks/throttle.h>
+#include <atomic>
 #include <chrono>
 
 namespace gr {
@@ -27,6 +29,10 @@ private:
     const bool d_ignore_tags;
     unsigned int d_maximum_items_per_chunk;
     uint64_t d_total_items = 0;
+    std::chrono::duration<double> d_burst_duration{ 0 };
+    pacer d_pacer;
+    // Written by work(), read by pacing_error() from other threads
+    std::atomic<double> d_pacing_error{ 0 };
 
 public:
     throttle_impl(size_t itemsize,
@@ -46,6 +52,14 @@ public:
     void set_maximum_items_per_chunk(unsigned int maximum_items_per_chunk) override;
     unsigned int maximum_items_per_chunk() const override;
 
+    void set_burst_duration(double seconds) override;
+    double burst_duration() const override;
+
+    void set_spin_duration(double seconds) override;
+    double spin_duration() const override;
+
+    double pacing_error() const override;
+
     int work(int noutput_items,
              gr_vector_const_void_star& input_items,
              gr_vector_void_star& output_items) override;
@@ -31,3 +31,18 @@ static const char* __doc_gr_blocks_throttle_set_sample_rate = R"doc()doc";
 
 
 static const char* __doc_gr_blocks_throttle_sample_rate = R"doc()doc";
+
+
+static const char* __doc_gr_blocks_throttle_set_burst_duration = R"doc()doc";
+
+
+static const char* __doc_gr_blocks_throttle_burst_duration = R"doc()doc";
+
+
+static const char* __doc_gr_blocks_throttle_set_spin_duration = R"doc()doc";
+
+
+static const char* __doc_gr_blocks_throttle_spin_duration = R"doc()doc";
+
+
+static const char* __doc_gr_blocks_throttle_pacing_error = R"doc()doc";
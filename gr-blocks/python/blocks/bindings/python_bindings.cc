@@ -126,6 +126,8 @@ void bind_rotator(py::module&);
 void bind_rotator_cc(py::module&);
 void bind_sample_and_hold(py::module&);
 void bind_selector(py::module&);
+void bind_shm_sink(py::module&);
+void bind_shm_source(py::module&);
 void bind_short_to_char(py::module&);
 void bind_short_to_float(py::module&);
 void bind_skiphead(py::module&);
@@ -300,6 +302,8 @@ PYBIND11_MODULE(blocks_python, m)
     bind_rotator_cc(m);
     bind_sample_and_hold(m);
     bind_selector(m);
+    bind_shm_sink(m);
+    bind_shm_source(m);
     bind_short_to_char(m);
     bind_short_to_float(m);
     bind_skiphead(m);
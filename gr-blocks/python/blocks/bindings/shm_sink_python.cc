@@ -0,0 +1,49 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(shm_sink.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(2f6711a4e4c58f6b83d377f00072609b)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/blocks/shm_sink.h>
+// pydoc.h is automatically generated in the build directory
+#include <shm_sink_pydoc.h>
+
+void bind_shm_sink(py::module& m)
+{
+
+    using shm_sink = ::gr::blocks::shm_sink;
+
+
+    py::class_<shm_sink,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<shm_sink>>(m, "shm_sink", D(shm_sink))
+
+        .def(py::init(&shm_sink::make),
+             py::arg("itemsize"),
+             py::arg("name"),
+             D(shm_sink, make))
+
+
+        ;
+}
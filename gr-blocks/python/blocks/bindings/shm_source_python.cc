@@ -0,0 +1,49 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(shm_source.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(75ed055e0ff7b780546bc52bc08ef3f0)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/blocks/shm_source.h>
+// pydoc.h is automatically generated in the build directory
+#include <shm_source_pydoc.h>
+
+void bind_shm_source(py::module& m)
+{
+
+    using shm_source = ::gr::blocks::shm_source;
+
+
+    py::class_<shm_source,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<shm_source>>(m, "shm_source", D(shm_source))
+
+        .def(py::init(&shm_source::make),
+             py::arg("itemsize"),
+             py::arg("name"),
+             D(shm_source, make))
+
+
+        ;
+}
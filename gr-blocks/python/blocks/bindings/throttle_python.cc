@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(throttle.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(9259d01362558f938bdbfec179b6e164)                     */
+/* BINDTOOL_HEADER_FILE_HASH(76de149a4f63fe8f0262c8c9ff4c0be0)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -55,5 +55,26 @@ void bind_throttle(py::module& m)
 
         .def("sample_rate", &throttle::sample_rate, D(throttle, sample_rate))
 
+
+        .def("set_burst_duration",
+             &throttle::set_burst_duration,
+             py::arg("seconds"),
+             D(throttle, set_burst_duration))
+
+
+        .def("burst_duration", &throttle::burst_duration, D(throttle, burst_duration))
+
+
+        .def("set_spin_duration",
+             &throttle::set_spin_duration,
+             py::arg("seconds"),
+             D(throttle, set_spin_duration))
+
+
+        .def("spin_duration", &throttle::spin_duration, D(throttle, spin_duration))
+
+
+        .def("pacing_error", &throttle::pacing_error, D(throttle, pacing_error))
+
         ;
 }
@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+#
+# Copyright 2023 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+#
+
+
+import multiprocessing
+import os
+import time
+
+import pmt
+from gnuradio import gr, gr_unittest, blocks
+
+
+def make_tag(key, value, offset):
+    tag = gr.tag_t()
+    tag.offset = offset
+    tag.key = pmt.intern(key)
+    tag.value = pmt.to_pmt(value)
+    return tag
+
+
+def produce(name, nitems):
+    # Runs in a process of its own
+    tb = gr.top_block()
+    data = [float(i % 1000) for i in range(nitems)]
+    tags = [make_tag("k", i, i) for i in range(5, nitems, 9973)]
+    src = blocks.vector_source_f(data, False, 1, tags)
+    tb.connect(src, blocks.shm_sink(gr.sizeof_float, name))
+    tb.run()
+
+
+class test_shm(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.name = "gr-qa-shm-{}".format(os.getpid())
+        self.producer = gr.top_block()
+        self.consumer = gr.top_block()
+
+    def tearDown(self):
+        self.producer = None
+        self.consumer = None
+
+    def test_001_stream(self):
+        # The ring is much shorter than the stream, so it wraps many times
+        data = [float(i % 1000) for i in range(200000)]
+        tags = [make_tag("k", i, i) for i in range(5, 200000, 9973)]
+
+        src = blocks.vector_source_f(data, False, 1, tags)
+        sink = blocks.shm_sink(gr.sizeof_float, self.name)
+        self.producer.connect(src, sink)
+
+        source = blocks.shm_source(gr.sizeof_float, self.name)
+        dst = blocks.vector_sink_f()
+        self.consumer.connect(source, dst)
+
+        self.consumer.start()
+        self.producer.run()
+        self.consumer.wait()
+
+        self.assertFloatTuplesAlmostEqual(data, dst.data())
+        result = dst.tags()
+        self.assertEqual(len(tags), len(result))
+        for expected, tag in zip(tags, result):
+            self.assertEqual(expected.offset, tag.offset)
+            self.assertEqual(pmt.to_python(tag.value), tag.offset)
+
+    def test_002_vectors(self):
+        vlen = 3
+        data = [complex(i, -i) for i in range(3000 * vlen)]
+
+        src = blocks.vector_source_c(data, False, vlen)
+        sink = blocks.shm_sink(gr.sizeof_gr_complex * vlen, self.name)
+        self.producer.connect(src, sink)
+
+        source = blocks.shm_source(gr.sizeof_gr_complex * vlen, self.name)
+        dst = blocks.vector_sink_c(vlen)
+        self.consumer.connect(source, dst)
+
+        self.consumer.start()
+        self.producer.run()
+        self.consumer.wait()
+
+        self.assertComplexTuplesAlmostEqual(data, dst.data())
+
+    def test_003_processes(self):
+        nitems = 200000
+        data = [float(i % 1000) for i in range(nitems)]
+
+        source = blocks.shm_source(gr.sizeof_float, self.name)
+        dst = blocks.vector_sink_f()
+        self.consumer.connect(source, dst)
+
+        # spawn, since forking a process with flowgraph threads is unsafe
+        ctx = multiprocessing.get_context("spawn")
+        proc = ctx.Process(target=produce, args=(self.name, nitems))
+        proc.start()
+        self.consumer.start()
+        proc.join(60)
+        if proc.exitcode != 0:
+            self.consumer.stop()
+        self.consumer.wait()
+        self.assertEqual(proc.exitcode, 0)
+
+        self.assertFloatTuplesAlmostEqual(data, dst.data())
+        result = dst.tags()
+        self.assertEqual(len(range(5, nitems, 9973)), len(result))
+        for tag in result:
+            self.assertEqual(pmt.to_python(tag.value), tag.offset)
+
+    def test_004_consumer_restart(self):
+        # A new consumer resumes at the first item the last one did not read
+        nitems = 50000
+        nfirst = 20000
+        data = [float(i % 1000) for i in range(nitems)]
+        tags = [make_tag("k", i, i) for i in range(5, nitems, 9973)]
+
+        src = blocks.vector_source_f(data, False, 1, tags)
+        sink = blocks.shm_sink(gr.sizeof_float, self.name)
+        self.producer.connect(src, sink)
+
+        source = blocks.shm_source(gr.sizeof_float, self.name)
+        head = blocks.head(gr.sizeof_float, nfirst)
+        first = blocks.vector_sink_f()
+        self.consumer.connect(source, head, first)
+
+        self.consumer.start()
+        self.producer.start()
+        self.consumer.wait()
+        self.consumer = None
+
+        consumer = gr.top_block()
+        source = blocks.shm_source(gr.sizeof_float, self.name)
+        rest = blocks.vector_sink_f()
+        consumer.connect(source, rest)
+        consumer.start()
+        self.producer.wait()
+        consumer.wait()
+
+        self.assertFloatTuplesAlmostEqual(data[:nfirst], first.data())
+        self.assertFloatTuplesAlmostEqual(data[nfirst:], rest.data())
+        expected = [t.offset - nfirst for t in tags if t.offset >= nfirst]
+        self.assertEqual(expected, [t.offset for t in rest.tags()])
+
+    def test_005_backpressure(self):
+        # A slow consumer holds back the producer without losing items
+        data = [float(i % 1000) for i in range(200000)]
+
+        src = blocks.vector_source_f(data, False)
+        sink = blocks.shm_sink(gr.sizeof_float, self.name)
+        self.producer.connect(src, sink)
+
+        source = blocks.shm_source(gr.sizeof_float, self.name)
+        thr = blocks.throttle(gr.sizeof_float, 10000)
+        dst = blocks.vector_sink_f()
+        self.consumer.connect(source, thr, dst)
+
+        self.consumer.start()
+        self.producer.start()
+        time.sleep(0.3)
+        self.assertLess(src.nitems_written(0), len(data))
+        self.assertLess(sink.nitems_read(0), len(data))
+
+        thr.set_sample_rate(1e9)
+        self.producer.wait()
+        self.consumer.wait()
+
+        self.assertFloatTuplesAlmostEqual(data, dst.data())
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_shm)
@@ -92,6 +92,34 @@ class test_throttle(gr_unittest.TestCase):
 
         self.assertGreaterEqual(current_len, chunksize)
 
+    def test_burst_pacing(self):
+        rate = 2e6
+        nitems = int(rate / 2)
+        src = blocks.null_source(gr.sizeof_float)
+        head = blocks.head(gr.sizeof_float, nitems)
+        thr = blocks.throttle(gr.sizeof_float, rate)
+        thr.set_burst_duration(1e-3)
+        thr.set_spin_duration(2e-4)
+        dst = blocks.null_sink(gr.sizeof_float)
+        self.tb.connect(src, head, thr, dst)
+
+        self.assertAlmostEqual(thr.burst_duration(), 1e-3)
+        self.assertAlmostEqual(thr.spin_duration(), 2e-4)
+
+        start_time = time.perf_counter()
+        self.tb.run()
+        end_time = time.perf_counter()
+
+        total_time = end_time - start_time
+        self.assertGreater(total_time, 0.5 - 1e-3)
+        self.assertLess(total_time, 1.0)
+        self.assertGreaterEqual(thr.pacing_error(), 0)
+
+        with self.assertRaises(ValueError):
+            thr.set_burst_duration(-1)
+        with self.assertRaises(ValueError):
+            thr.set_spin_duration(-1)
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_throttle)
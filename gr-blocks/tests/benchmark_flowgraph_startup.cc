@@ -0,0 +1,95 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/*
+ * Times building, starting and stopping generated flowgraphs of N
+ * copy blocks, either as a bank fed by one source (like the outputs of
+ * a channelizer) or as one long chain.
+ *
+ * Usage: benchmark_flowgraph_startup [max N]
+ */
+
+/* ensure that tweakme.h is included before the bundled spdlog/fmt header, see
+ * https://github.com/gabime/spdlog/issues/2922 */
+#include <spdlog/tweakme.h>
+
+#include <gnuradio/blocks/copy.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/blocks/null_source.h>
+#include <gnuradio/top_block.h>
+#include <spdlog/fmt/fmt.h>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+using seconds = std::chrono::duration<double>;
+
+void make_bank(gr::top_block_sptr tb, size_t n)
+{
+    auto src = gr::blocks::null_source::make(sizeof(float));
+    for (size_t i = 0; i < n; i++) {
+        auto copy = gr::blocks::copy::make(sizeof(float));
+        tb->connect(src, 0, copy, 0);
+        tb->connect(copy, 0, gr::blocks::null_sink::make(sizeof(float)), 0);
+    }
+}
+
+void make_chain(gr::top_block_sptr tb, size_t n)
+{
+    gr::basic_block_sptr last = gr::blocks::null_source::make(sizeof(float));
+    for (size_t i = 0; i < n; i++) {
+        auto copy = gr::blocks::copy::make(sizeof(float));
+        tb->connect(last, 0, copy, 0);
+        last = copy;
+    }
+    tb->connect(last, 0, gr::blocks::null_sink::make(sizeof(float)), 0);
+}
+
+void time_startup(const std::string& name,
+                  const std::function<void(gr::top_block_sptr, size_t)>& make,
+                  size_t n)
+{
+    using clock = std::chrono::steady_clock;
+
+    const auto before = clock::now();
+    auto tb = gr::make_top_block(name);
+    make(tb, n);
+    const auto built = clock::now();
+    tb->start();
+    const auto started = clock::now();
+    tb->stop();
+    tb->wait();
+    const auto stopped = clock::now();
+
+    fmt::print(FMT_STRING("{:<6} {:>6} {:>12.4f} {:>12.4f} {:>12.4f}\n"),
+               name,
+               n,
+               seconds(built - before).count(),
+               seconds(started - built).count(),
+               seconds(stopped - started).count());
+}
+
+int main(int argc, char** argv)
+{
+    const size_t max_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+
+    fmt::print(FMT_STRING("{:<6} {:>6} {:>12} {:>12} {:>12}\n"),
+               "graph",
+               "N",
+               "connect (s)",
+               "start (s)",
+               "stop (s)");
+    for (size_t n = 10; n <= max_n; n *= 10) {
+        time_startup("bank", make_bank, n);
+        time_startup("chain", make_chain, n);
+    }
+}
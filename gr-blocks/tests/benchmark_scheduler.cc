@@ -0,0 +1,427 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/*
+ * Runs canonical flowgraph topologies built from stock blocks and
+ * prints, as a JSON array, their throughput, per-hop latency, CPU use
+ * and context switches, to compare scheduler and buffer changes:
+ *
+ *   chain        null_source -> head -> N x copy -> null_sink
+ *   fan          null_source -> head -> N parallel copies -> add -> null_sink
+ *   tags         tags_strobe (a tag every 16 items) -> head -> N x copy -> null_sink
+ *   decimate     null_source -> head -> N x integrate (decimation 2) -> null_sink
+ *   sync_1       null_source -> head -> N x multiply_const -> null_sink
+ *   decim_interp_1
+ *                null_source -> head -> N x (stream_to_vector 2 -> vector_to_stream 2)
+ *                -> null_sink
+ *   ping_pong    two blocks sending a message back and forth
+ *
+ * The blocks of sync_1 and decim_interp_1 produce one item per work
+ * call, to time the scheduler overhead per call; they, and ping_pong,
+ * run a thousandth of the items. Latency is measured from after head
+ * to before the sink on every 1024th item, and divided by the number
+ * of blocks in between.
+ *
+ * Usage: benchmark_scheduler [N items] [N blocks]
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/* ensure that tweakme.h is included before the bundled spdlog/fmt header, see
+ * https://github.com/gabime/spdlog/issues/2922 */
+#include <spdlog/tweakme.h>
+
+#include <gnuradio/blocks/add_blk.h>
+#include <gnuradio/blocks/copy.h>
+#include <gnuradio/blocks/head.h>
+#include <gnuradio/blocks/integrate.h>
+#include <gnuradio/blocks/multiply_const.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/blocks/null_source.h>
+#include <gnuradio/blocks/stream_to_vector.h>
+#include <gnuradio/blocks/tags_strobe.h>
+#include <gnuradio/blocks/vector_to_stream.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/sync_block.h>
+#include <gnuradio/top_block.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+
+using seconds = std::chrono::duration<double>;
+
+static int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Times at which every `every`th item passed a latency_stamp
+struct latency_log {
+    static constexpr uint64_t every = 1024;
+    std::unique_ptr<std::atomic<int64_t>[]> stamps;
+    uint64_t nstamps;
+
+    latency_log(uint64_t nitems)
+        : stamps(new std::atomic<int64_t>[nitems / every + 1]),
+          nstamps(nitems / every + 1)
+    {
+    }
+};
+
+class latency_stamp : public gr::sync_block
+{
+    std::shared_ptr<latency_log> d_log;
+
+public:
+    latency_stamp(std::shared_ptr<latency_log> log)
+        : gr::sync_block("latency_stamp",
+                         gr::io_signature::make(1, 1, sizeof(float)),
+                         gr::io_signature::make(1, 1, sizeof(float))),
+          d_log(log)
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override
+    {
+        const uint64_t start = nitems_read(0);
+        const uint64_t every = latency_log::every;
+        const int64_t now = now_ns();
+        for (uint64_t i = (start + every - 1) / every * every; i < start + noutput_items;
+             i += every) {
+            if (i / every < d_log->nstamps) {
+                d_log->stamps[i / every].store(now, std::memory_order_release);
+            }
+        }
+        std::memcpy(output_items[0], input_items[0], noutput_items * sizeof(float));
+        return noutput_items;
+    }
+};
+
+class latency_probe : public gr::sync_block
+{
+    std::shared_ptr<latency_log> d_log;
+
+public:
+    double d_sum_ns = 0;
+    uint64_t d_count = 0;
+
+    latency_probe(std::shared_ptr<latency_log> log)
+        : gr::sync_block("latency_probe",
+                         gr::io_signature::make(1, 1, sizeof(float)),
+                         gr::io_signature::make(1, 1, sizeof(float))),
+          d_log(log)
+    {
+    }
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items) override
+    {
+        const uint64_t start = nitems_read(0);
+        const uint64_t every = latency_log::every;
+        const int64_t now = now_ns();
+        for (uint64_t i = (start + every - 1) / every * every; i < start + noutput_items;
+             i += every) {
+            if (i / every < d_log->nstamps) {
+                d_sum_ns += now - d_log->stamps[i / every].load(std::memory_order_acquire);
+                d_count++;
+            }
+        }
+        std::memcpy(output_items[0], input_items[0], noutput_items * sizeof(float));
+        return noutput_items;
+    }
+};
+
+// Sends every message it gets back; the serving side starts and stops
+// after d_rounds replies
+class ping_pong : public gr::block
+{
+    const bool d_serve;
+    const uint64_t d_rounds;
+    uint64_t d_count = 0;
+    std::promise<void> d_done;
+
+public:
+    ping_pong(bool serve, uint64_t rounds)
+        : gr::block("ping_pong", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+          d_serve(serve),
+          d_rounds(rounds)
+    {
+        message_port_register_in(pmt::mp("in"));
+        message_port_register_out(pmt::mp("out"));
+        set_msg_handler(pmt::mp("in"), [this](const pmt::pmt_t& msg) {
+            if (d_serve && ++d_count == d_rounds) {
+                d_done.set_value();
+            } else {
+                message_port_pub(pmt::mp("out"), msg);
+            }
+        });
+    }
+
+    bool start() override
+    {
+        if (d_serve) {
+            message_port_pub(pmt::mp("out"), pmt::from_uint64(0));
+        }
+        return true;
+    }
+
+    std::future<void> done() { return d_done.get_future(); }
+};
+
+struct usage {
+    double cpu_s = 0;
+    long context_switches = 0;
+
+    static usage now()
+    {
+        usage u;
+#ifdef HAVE_SYS_RESOURCE_H
+        struct rusage r;
+        getrusage(RUSAGE_SELF, &r);
+        u.cpu_s = r.ru_utime.tv_sec + r.ru_utime.tv_usec * 1e-6 + r.ru_stime.tv_sec +
+                  r.ru_stime.tv_usec * 1e-6;
+        u.context_switches = r.ru_nvcsw + r.ru_nivcsw;
+#endif
+        return u;
+    }
+};
+
+struct result {
+    std::string topology;
+    size_t nblocks;
+    uint64_t nitems;
+    double seconds;
+    double latency_per_hop_us; // NAN if not measured
+    usage used;
+};
+
+static bool s_first_result = true;
+
+static void print_result(const result& r)
+{
+    fmt::print(FMT_STRING("{}  {{\"topology\": \"{}\", \"blocks\": {}, \"items\": {}, "
+                          "\"seconds\": {:.6f}, \"items_per_second\": {:.6e}, "
+                          "\"latency_per_hop_us\": {}, \"cpu_percent\": {:.1f}, "
+                          "\"context_switches\": {}}}"),
+               s_first_result ? "" : ",\n",
+               r.topology,
+               r.nblocks,
+               r.nitems,
+               r.seconds,
+               r.nitems / r.seconds,
+               std::isnan(r.latency_per_hop_us)
+                   ? std::string("null")
+                   : fmt::format(FMT_STRING("{:.3f}"), r.latency_per_hop_us),
+               100 * r.used.cpu_s / r.seconds,
+               r.used.context_switches);
+    s_first_result = false;
+}
+
+// Runs tb to completion; hops is the number of blocks between the
+// latency stamp and probe, if any
+static void run(const std::string& topology,
+                gr::top_block_sptr tb,
+                size_t nblocks,
+                uint64_t nitems,
+                std::shared_ptr<latency_probe> probe = nullptr,
+                size_t hops = 0)
+{
+    const usage before = usage::now();
+    const auto start = std::chrono::steady_clock::now();
+    tb->run();
+    const seconds dur = std::chrono::steady_clock::now() - start;
+    const usage after = usage::now();
+
+    result r{ topology, nblocks, nitems, dur.count(), NAN, {} };
+    if (probe && probe->d_count > 0 && hops > 0) {
+        r.latency_per_hop_us = probe->d_sum_ns / probe->d_count / hops / 1e3;
+    }
+    r.used.cpu_s = after.cpu_s - before.cpu_s;
+    r.used.context_switches = after.context_switches - before.context_switches;
+    print_result(r);
+}
+
+// Connects src -> head -> stamp, returns the stamp
+static gr::basic_block_sptr start_stream(gr::top_block_sptr tb,
+                                         gr::basic_block_sptr src,
+                                         uint64_t nitems,
+                                         std::shared_ptr<latency_log> log)
+{
+    auto head = gr::blocks::head::make(sizeof(float), nitems);
+    auto stamp = gnuradio::make_block_sptr<latency_stamp>(log);
+    tb->connect(src, 0, head, 0);
+    tb->connect(head, 0, stamp, 0);
+    return stamp;
+}
+
+// Connects last -> probe -> null_sink, returns the probe
+static std::shared_ptr<latency_probe> end_stream(gr::top_block_sptr tb,
+                                                 gr::basic_block_sptr last,
+                                                 std::shared_ptr<latency_log> log)
+{
+    auto probe = gnuradio::make_block_sptr<latency_probe>(log);
+    tb->connect(last, 0, probe, 0);
+    tb->connect(probe, 0, gr::blocks::null_sink::make(sizeof(float)), 0);
+    return probe;
+}
+
+// Stages of a chain: each connects its blocks after last and returns
+// the last of them
+using add_stage =
+    std::function<gr::basic_block_sptr(gr::top_block_sptr, gr::basic_block_sptr)>;
+
+static gr::basic_block_sptr add_copy(gr::top_block_sptr tb, gr::basic_block_sptr last)
+{
+    auto copy = gr::blocks::copy::make(sizeof(float));
+    tb->connect(last, 0, copy, 0);
+    return copy;
+}
+
+static gr::basic_block_sptr add_sync_1(gr::top_block_sptr tb, gr::basic_block_sptr last)
+{
+    auto mult = gr::blocks::multiply_const_ff::make(1.0f);
+    mult->set_max_noutput_items(1);
+    tb->connect(last, 0, mult, 0);
+    return mult;
+}
+
+static gr::basic_block_sptr add_decim_interp_1(gr::top_block_sptr tb,
+                                               gr::basic_block_sptr last)
+{
+    auto s2v = gr::blocks::stream_to_vector::make(sizeof(float), 2);
+    auto v2s = gr::blocks::vector_to_stream::make(sizeof(float), 2);
+    s2v->set_max_noutput_items(1);
+    v2s->set_max_noutput_items(2);
+    tb->connect(last, 0, s2v, 0);
+    tb->connect(s2v, 0, v2s, 0);
+    return v2s;
+}
+
+static void bench_chain(const std::string& topology,
+                        gr::basic_block_sptr src,
+                        uint64_t nitems,
+                        size_t nstages,
+                        const add_stage& add = add_copy,
+                        size_t blocks_per_stage = 1)
+{
+    auto tb = gr::make_top_block(topology);
+    auto log = std::make_shared<latency_log>(nitems);
+    gr::basic_block_sptr last = start_stream(tb, src, nitems, log);
+    for (size_t i = 0; i < nstages; i++) {
+        last = add(tb, last);
+    }
+    auto probe = end_stream(tb, last, log);
+    const size_t nblocks = nstages * blocks_per_stage;
+    run(topology, tb, nblocks, nitems, probe, nblocks + 1);
+}
+
+static void bench_fan(uint64_t nitems, size_t nblocks)
+{
+    auto tb = gr::make_top_block("fan");
+    auto log = std::make_shared<latency_log>(nitems);
+    auto stamp =
+        start_stream(tb, gr::blocks::null_source::make(sizeof(float)), nitems, log);
+    auto add = gr::blocks::add_ff::make();
+    for (size_t i = 0; i < nblocks; i++) {
+        auto copy = gr::blocks::copy::make(sizeof(float));
+        tb->connect(stamp, 0, copy, 0);
+        tb->connect(copy, 0, add, i);
+    }
+    auto probe = end_stream(tb, add, log);
+    run("fan", tb, nblocks, nitems, probe, 3);
+}
+
+static void bench_decimate(uint64_t nitems, size_t nblocks)
+{
+    auto tb = gr::make_top_block("decimate");
+    gr::basic_block_sptr last = gr::blocks::null_source::make(sizeof(float));
+    auto head = gr::blocks::head::make(sizeof(float), nitems);
+    tb->connect(last, 0, head, 0);
+    last = head;
+    for (size_t i = 0; i < nblocks; i++) {
+        auto integrate = gr::blocks::integrate_ff::make(2);
+        tb->connect(last, 0, integrate, 0);
+        last = integrate;
+    }
+    tb->connect(last, 0, gr::blocks::null_sink::make(sizeof(float)), 0);
+    run("decimate", tb, nblocks, nitems);
+}
+
+static void bench_ping_pong(uint64_t rounds)
+{
+    auto tb = gr::make_top_block("ping_pong");
+    auto ping = gnuradio::make_block_sptr<ping_pong>(true, rounds);
+    auto pong = gnuradio::make_block_sptr<ping_pong>(false, rounds);
+    tb->msg_connect(ping, "out", pong, "in");
+    tb->msg_connect(pong, "out", ping, "in");
+    auto done = ping->done();
+
+    const usage before = usage::now();
+    const auto start = std::chrono::steady_clock::now();
+    tb->start();
+    done.wait();
+    const seconds dur = std::chrono::steady_clock::now() - start;
+    const usage after = usage::now();
+    tb->stop();
+    tb->wait();
+
+    // A round trip is two hops
+    result r{ "ping_pong", 2, rounds, dur.count(), dur.count() / rounds / 2 * 1e6, {} };
+    r.used.cpu_s = after.cpu_s - before.cpu_s;
+    r.used.context_switches = after.context_switches - before.context_switches;
+    print_result(r);
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t nitems = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    const size_t nblocks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+
+    fmt::print("[\n");
+    bench_chain("chain", gr::blocks::null_source::make(sizeof(float)), nitems, nblocks);
+    bench_fan(nitems, nblocks);
+    bench_chain(
+        "tags",
+        gr::blocks::tags_strobe::make(sizeof(float), pmt::PMT_T, 16, pmt::mp("strobe")),
+        nitems,
+        nblocks);
+    bench_decimate(nitems, nblocks);
+
+    const uint64_t nfew = std::max<uint64_t>(nitems / 1000, 1);
+    bench_chain(
+        "sync_1", gr::blocks::null_source::make(sizeof(float)), nfew, nblocks, add_sync_1);
+    bench_chain("decim_interp_1",
+                gr::blocks::null_source::make(sizeof(float)),
+                nfew,
+                nblocks,
+                add_decim_interp_1,
+                2);
+    bench_ping_pong(nfew);
+    fmt::print("\n]\n");
+}
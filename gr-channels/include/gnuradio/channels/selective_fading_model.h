@@ -63,6 +63,17 @@ public:
     virtual void set_fDTs(float fDTs) = 0;
     virtual void set_K(float K) = 0;
     virtual void set_step(float step) = 0;
+
+    /*!
+     * \brief Number of samples between fader coefficient updates.
+     *
+     * With a period of 1 (the default), every fader and tap is recomputed for every
+     * output sample. A period of P evaluates the faders only every P samples and
+     * linearly interpolates the filter taps in between. This trades a small model
+     * error for a large speedup as long as fDTs * P stays well below 1.
+     */
+    virtual unsigned int update_period() = 0;
+    virtual void set_update_period(unsigned int period) = 0;
 };
 
 } /* namespace channels */
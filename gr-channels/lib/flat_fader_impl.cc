@@ -89,6 +89,34 @@ void flat_fader_impl::next_samples(std::vector<gr_complex>& Hvec, int n_samples)
     }
 }
 
+gr_complex flat_fader_impl::advance(int n_samples)
+{
+    gr_complex H(0, 0);
+    for (int n = 1; n < d_N + 1; n++) {
+        float alpha_n = (2 * GR_M_PI * n - GR_M_PI + d_theta) / (4 * d_N);
+        float dphase = n_samples * 2 * GR_M_PI * d_fDTs * _GRFASTCOS(alpha_n);
+        d_psi[n] = fmod(d_psi[n] + dphase, 2 * GR_M_PI);
+        d_phi[n] = fmod(d_phi[n] + dphase, 2 * GR_M_PI);
+        float s_i = scale_sin * _GRFASTCOS(d_psi[n]);
+        float s_q = scale_sin * _GRFASTSIN(d_phi[n]);
+        H += gr_complex(s_i, s_q);
+    }
+
+    if (d_LOS) {
+        d_psi[0] = fmod(d_psi[0] + n_samples * 2 * GR_M_PI * d_fDTs *
+                                       _GRFASTCOS(d_theta_los),
+                        2 * GR_M_PI);
+        float los_i = scale_los * _GRFASTCOS(d_psi[0]);
+        float los_q = scale_los * _GRFASTSIN(d_psi[0]);
+        H = H * scale_nlos + gr_complex(los_i, los_q);
+    }
+
+    for (int i = 0; i < n_samples; i++) {
+        update_theta();
+    }
+    return H;
+}
+
 gr_complex flat_fader_impl::next_sample()
 {
     std::vector<gr_complex> v(1);
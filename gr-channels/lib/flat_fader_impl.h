@@ -61,6 +61,11 @@ public:
     gr_complex next_sample();
     void next_samples(std::vector<gr_complex>& HVec, int n_samples);
 
+    // Advance the fader by n_samples samples in a single step and return the gain at
+    // the new position. The sinusoids are evaluated once, with the Doppler angles of
+    // the current random walk position; advance(0) returns the current gain.
+    gr_complex advance(int n_samples);
+
 }; /* class flat_fader_impl */
 } /* namespace channels */
 } /* namespace gr */
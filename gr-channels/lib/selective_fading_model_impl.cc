@@ -14,6 +14,8 @@
 #include <gnuradio/fxpt.h>
 #include <gnuradio/io_signature.h>
 #include <gnuradio/math.h>
+#include <volk/volk.h>
+#include <algorithm>
 
 // FASTSINCOS:  0 = slow native,  1 = gr::fxpt impl,  2 = sincostable.h
 #define FASTSINCOS 2
@@ -49,7 +51,10 @@ selective_fading_model_impl::selective_fading_model_impl(unsigned int N,
                  io_signature::make(1, 1, sizeof(gr_complex))),
       d_delays(delays),
       d_mags(mags),
-      d_sintable(1024)
+      d_sintable(1024),
+      d_update_period(1),
+      d_segment_pos(0),
+      d_anchor_valid(false)
 {
     if (mags.size() != delays.size())
         throw std::runtime_error("magnitude and delay vectors must be the same length!");
@@ -65,56 +70,141 @@ selective_fading_model_impl::selective_fading_model_impl(unsigned int N,
     }
     set_history(ntaps);
     d_taps.resize(ntaps, gr_complex(0, 0));
+
+    // the delays don't change, so neither do the sinc weights of the faders
+    d_tap_weights.resize(d_faders.size() * ntaps);
+    for (size_t j = 0; j < d_faders.size(); j++) {
+        for (int k = 0; k < ntaps; k++) {
+            float dist = k - d_delays[j];
+            d_tap_weights[j * ntaps + ntaps - k - 1] =
+                d_sintable.sinc(GR_M_PI * dist) * d_mags[j];
+        }
+    }
+    d_taps_start.resize(ntaps);
+    d_taps_delta.resize(ntaps);
+    d_taps_end.resize(ntaps);
 }
 
 selective_fading_model_impl::~selective_fading_model_impl() {}
 
-int selective_fading_model_impl::work(int noutput_items,
-                                      gr_vector_const_void_star& input_items,
-                                      gr_vector_void_star& output_items)
+void selective_fading_model_impl::set_update_period(unsigned int period)
 {
-    const gr_complex* in = (const gr_complex*)input_items[0];
-    gr_complex* out = (gr_complex*)output_items[0];
+    if (period < 1) {
+        throw std::invalid_argument("update period must be >= 1");
+    }
+    gr::thread::scoped_lock l(d_setlock);
+    d_update_period = period;
+    d_anchor_valid = false;
+}
 
+void selective_fading_model_impl::compute_taps(const gr_complex* gains,
+                                               volk::vector<gr_complex>& taps) const
+{
+    const size_t ntaps = taps.size();
+    std::fill(taps.begin(), taps.end(), gr_complex(0, 0));
+    for (size_t j = 0; j < d_faders.size(); j++) {
+        const float* weights = &d_tap_weights[j * ntaps];
+        for (size_t k = 0; k < ntaps; k++) {
+            taps[k] += gains[j] * weights[k];
+        }
+    }
+}
+
+int selective_fading_model_impl::work_exact(int noutput_items,
+                                            const gr_complex* in,
+                                            gr_complex* out)
+{
     // pregenerate fading components
     std::vector<std::vector<gr_complex>> fading_taps(d_faders.size());
     for (size_t j = 0; j < d_faders.size(); j++) {
         d_faders[j].next_samples(fading_taps[j], noutput_items);
     }
 
-    // loop over each output sample
+    std::vector<gr_complex> gains(d_faders.size());
     for (int i = 0; i < noutput_items; i++) {
-
-        // clear the current values in each tap
-        for (size_t j = 0; j < d_taps.size(); j++) {
-            d_taps[j] = gr_complex(0, 0);
+        for (size_t j = 0; j < d_faders.size(); j++) {
+            gains[j] = fading_taps[j][i];
         }
+        compute_taps(gains.data(), d_taps_start);
+        volk_32fc_x2_dot_prod_32fc(&out[i], &in[i], d_taps_start.data(), d_taps.size());
+    }
+    std::reverse_copy(d_taps_start.begin(), d_taps_start.end(), d_taps.begin());
 
-        // add each flat fading component to the taps
+    // the next interpolated segment has to start from the current fader state
+    d_anchor_valid = false;
+    return noutput_items;
+}
+
+/*
+ * The taps are evaluated every d_update_period samples only. In between, the taps
+ * are start + f * delta with f = pos / d_update_period, so that each output is the
+ * sum of two fixed-tap dot products: in * start + f * (in * delta).
+ */
+int selective_fading_model_impl::work_interpolated(int noutput_items,
+                                                   const gr_complex* in,
+                                                   gr_complex* out)
+{
+    const size_t ntaps = d_taps.size();
+    std::vector<gr_complex> gains(d_faders.size());
+
+    if (!d_anchor_valid) {
         for (size_t j = 0; j < d_faders.size(); j++) {
-            gr_complex ff_H(fading_taps[j][i]);
-            // gr_complex ff_H(d_faders[j].next_sample());
-            for (size_t k = 0; k < d_taps.size(); k++) {
-                float dist = k - d_delays[j];
-                float interpmag = d_sintable.sinc(GR_M_PI * dist);
-                d_taps[k] += ff_H * interpmag * d_mags[j];
-            }
+            gains[j] = d_faders[j].advance(0);
         }
+        compute_taps(gains.data(), d_taps_end);
+        d_segment_pos = d_update_period;
+        d_anchor_valid = true;
+    }
 
-        // apply the taps and generate output
-        gr_complex sum(0, 0);
-        for (size_t j = 0; j < d_taps.size(); j++) {
-            sum += in[i + j] * d_taps[d_taps.size() - j - 1];
+    const float inv_period = 1.0f / d_update_period;
+    int i = 0;
+    while (i < noutput_items) {
+        if (d_segment_pos == d_update_period) {
+            // start a new segment at the end of the last one
+            d_taps_start.swap(d_taps_end);
+            for (size_t j = 0; j < d_faders.size(); j++) {
+                gains[j] = d_faders[j].advance(d_update_period);
+            }
+            compute_taps(gains.data(), d_taps_end);
+            for (size_t k = 0; k < ntaps; k++) {
+                d_taps_delta[k] = d_taps_end[k] - d_taps_start[k];
+            }
+            d_segment_pos = 0;
         }
 
-        // assign output
-        out[i] = sum;
+        const int n = std::min<int>(noutput_items - i, d_update_period - d_segment_pos);
+        for (int s = 0; s < n; s++) {
+            gr_complex base, slope;
+            volk_32fc_x2_dot_prod_32fc(&base, &in[i + s], d_taps_start.data(), ntaps);
+            volk_32fc_x2_dot_prod_32fc(&slope, &in[i + s], d_taps_delta.data(), ntaps);
+            out[i + s] = base + slope * ((d_segment_pos + s) * inv_period);
+        }
+        d_segment_pos += n;
+        i += n;
     }
 
-    // return all outputs
+    for (size_t k = 0; k < ntaps; k++) {
+        d_taps[ntaps - k - 1] =
+            d_taps_start[k] + d_taps_delta[k] * (d_segment_pos * inv_period);
+    }
     return noutput_items;
 }
 
+int selective_fading_model_impl::work(int noutput_items,
+                                      gr_vector_const_void_star& input_items,
+                                      gr_vector_void_star& output_items)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    const gr_complex* in = (const gr_complex*)input_items[0];
+    gr_complex* out = (gr_complex*)output_items[0];
+
+    if (d_update_period == 1) {
+        return work_exact(noutput_items, in, out);
+    }
+    return work_interpolated(noutput_items, in, out);
+}
+
 void selective_fading_model_impl::setup_rpc()
 {
 #ifdef GR_CTRLPORT
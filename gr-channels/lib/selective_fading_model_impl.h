@@ -17,6 +17,7 @@
 
 #include "sincostable.h"
 #include <gnuradio/fxpt.h>
+#include <volk/volk_alloc.hh>
 
 namespace gr {
 namespace channels {
@@ -29,6 +30,24 @@ private:
     std::vector<float> d_mags;
     sincostable d_sintable;
 
+    // sinc interpolation weight of each fader on each tap, scaled by its magnitude;
+    // fader j occupies [j * ntaps, (j + 1) * ntaps), taps in reversed order
+    std::vector<float> d_tap_weights;
+
+    unsigned int d_update_period;
+    unsigned int d_segment_pos; // samples into the current interpolation segment
+    bool d_anchor_valid;
+
+    // reversed taps at the start of the current segment and their change over it
+    volk::vector<gr_complex> d_taps_start;
+    volk::vector<gr_complex> d_taps_delta;
+    volk::vector<gr_complex> d_taps_end;
+
+    // fills taps (reversed) from the given fader gains
+    void compute_taps(const gr_complex* gains, volk::vector<gr_complex>& taps) const;
+    int work_exact(int noutput_items, const gr_complex* in, gr_complex* out);
+    int work_interpolated(int noutput_items, const gr_complex* in, gr_complex* out);
+
 public:
     selective_fading_model_impl(unsigned int N,
                                 float fDTs,
@@ -56,6 +75,7 @@ public:
 
     void set_fDTs(float fDTs) override
     {
+        gr::thread::scoped_lock l(d_setlock);
         for (auto& fader : d_faders) {
             fader.d_fDTs = fDTs;
             fader.d_step = powf(0.00125 * fDTs, 1.1);
@@ -63,6 +83,7 @@ public:
     }
     void set_K(float K) override
     {
+        gr::thread::scoped_lock l(d_setlock);
         for (auto& fader : d_faders) {
             fader.d_K = K;
             fader.scale_los = sqrtf(fader.d_K) / sqrtf(fader.d_K + 1);
@@ -71,10 +92,14 @@ public:
     }
     void set_step(float step) override
     {
+        gr::thread::scoped_lock l(d_setlock);
         for (auto& fader : d_faders) {
             fader.d_step = step;
         }
     }
+
+    unsigned int update_period() override { return d_update_period; }
+    void set_update_period(unsigned int period) override;
 };
 
 } /* namespace channels */
@@ -45,3 +45,10 @@ static const char* __doc_gr_channels_selective_fading_model_set_K = R"doc()doc";
 
 
 static const char* __doc_gr_channels_selective_fading_model_set_step = R"doc()doc";
+
+
+static const char* __doc_gr_channels_selective_fading_model_update_period = R"doc()doc";
+
+
+static const char* __doc_gr_channels_selective_fading_model_set_update_period =
+    R"doc()doc";
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(selective_fading_model.h) */
-/* BINDTOOL_HEADER_FILE_HASH(a70748fab2290742010437e061b6c7db)                     */
+/* BINDTOOL_HEADER_FILE_HASH(04c169ad298743cbf683b508ff53b8d3)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -78,5 +78,16 @@ void bind_selective_fading_model(py::module& m)
              py::arg("step"),
              D(selective_fading_model, set_step))
 
+
+        .def("update_period",
+             &selective_fading_model::update_period,
+             D(selective_fading_model, update_period))
+
+
+        .def("set_update_period",
+             &selective_fading_model::set_update_period,
+             py::arg("period"),
+             D(selective_fading_model, set_update_period))
+
         ;
 }
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+#
+# Copyright 2023 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+#
+
+
+from gnuradio import gr, gr_unittest, blocks, channels
+import random
+
+
+class test_selective_fading_model(gr_unittest.TestCase):
+
+    def setUp(self):
+        random.seed(42)
+        self.src_data = [complex(random.gauss(0, 1), random.gauss(0, 1))
+                         for _ in range(20000)]
+
+    def run_model(self, period):
+        tb = gr.top_block()
+        src = blocks.vector_source_c(self.src_data)
+        op = channels.selective_fading_model(8, 0.001, False, 4.0, 0,
+                                             (0.0, 0.1, 1.3),
+                                             (1.0, 0.99, 0.97), 8)
+        if period is not None:
+            op.set_update_period(period)
+        snk = blocks.vector_sink_c()
+        tb.connect(src, op, snk)
+        tb.run()
+        return snk.data()
+
+    def test_001_default_period(self):
+        op = channels.selective_fading_model(8, 0.001, False, 4.0, 0,
+                                             (0.0,), (1.0,), 1)
+        self.assertEqual(op.update_period(), 1)
+        op.set_update_period(16)
+        self.assertEqual(op.update_period(), 16)
+        self.assertRaises(ValueError, op.set_update_period, 0)
+
+    def test_002_period_1_is_exact(self):
+        # switching back to a period of 1 takes the exact path again
+        exact = self.run_model(None)
+        tb = gr.top_block()
+        src = blocks.vector_source_c(self.src_data)
+        op = channels.selective_fading_model(8, 0.001, False, 4.0, 0,
+                                             (0.0, 0.1, 1.3),
+                                             (1.0, 0.99, 0.97), 8)
+        op.set_update_period(8)
+        op.set_update_period(1)
+        snk = blocks.vector_sink_c()
+        tb.connect(src, op, snk)
+        tb.run()
+        self.assertEqual(len(exact), len(self.src_data))
+        self.assertEqual(exact, snk.data())
+
+    def test_003_interpolated_nmse(self):
+        exact = self.run_model(1)
+        power = sum(abs(y)**2 for y in exact)
+        for period in (4, 16):
+            approx = self.run_model(period)
+            self.assertEqual(len(approx), len(exact))
+            error = sum(abs(a - e)**2 for a, e in zip(approx, exact))
+            self.assertLess(error / power, 1e-3)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_selective_fading_model)
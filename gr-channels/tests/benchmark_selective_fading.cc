@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/*
+ * Compares the interpolated tap update modes of selective_fading_model against the
+ * exact per-sample path: run time, and normalized mean squared error of the output
+ * for the same input and seed.
+ */
+
+/* ensure that tweakme.h is included before the bundled spdlog/fmt header, see
+ * https://github.com/gabime/spdlog/issues/2922 */
+#include <spdlog/tweakme.h>
+
+#include <gnuradio/channels/selective_fading_model.h>
+#include <gnuradio/random.h>
+#include <spdlog/fmt/fmt.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+constexpr int block_size = 8192;
+constexpr int nblocks = 64;
+constexpr int ntaps = 8;
+constexpr float fDTs = 0.001;
+
+namespace {
+auto make_model(unsigned int period)
+{
+    auto model = gr::channels::selective_fading_model::make(
+        8, fDTs, false, 4.0, 0, { 0.0, 0.1, 1.3 }, { 1.0, 0.99, 0.97 }, ntaps);
+    model->set_update_period(period);
+    return model;
+}
+
+// runs all blocks through model and returns the elapsed time in seconds
+double run(gr::channels::selective_fading_model::sptr model,
+           const std::vector<gr_complex>& input,
+           std::vector<gr_complex>& output)
+{
+    using namespace std::chrono;
+    gr_vector_const_void_star in(1);
+    gr_vector_void_star out(1);
+    auto before = steady_clock::now();
+    for (int b = 0; b < nblocks; b++) {
+        in[0] = &input[b * block_size];
+        out[0] = &output[b * block_size];
+        model->work(block_size, in, out);
+    }
+    auto after = steady_clock::now();
+    return duration_cast<duration<double>>(after - before).count();
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // the model reads ntaps - 1 items of history in front of each block
+    std::vector<gr_complex> input(nblocks * block_size + ntaps - 1);
+    gr::random rng(42);
+    rng.fill_gaussian(input.data(), input.size());
+
+    std::vector<gr_complex> reference(nblocks * block_size);
+    const double t_exact = run(make_model(1), input, reference);
+    double power = 0;
+    for (const auto& y : reference) {
+        power += std::norm(y);
+    }
+
+    fmt::print("{:>8} {:>12} {:>12} {:>10} {:>10}\n",
+               "period",
+               "time [s]",
+               "rate [S/s]",
+               "speedup",
+               "NMSE [dB]");
+    fmt::print("{:>8} {:>12.4e} {:>12.4e} {:>10.2f} {:>10}\n",
+               1,
+               t_exact,
+               reference.size() / t_exact,
+               1.0,
+               "-");
+
+    std::vector<gr_complex> output(reference.size());
+    for (unsigned int period : { 2, 4, 8, 16, 32, 64, 128 }) {
+        const double t = run(make_model(period), input, output);
+        double error = 0;
+        for (size_t i = 0; i < output.size(); i++) {
+            error += std::norm(output[i] - reference[i]);
+        }
+        fmt::print("{:>8} {:>12.4e} {:>12.4e} {:>10.2f} {:>10.2f}\n",
+                   period,
+                   t,
+                   output.size() / t,
+                   t_exact / t,
+                   10 * std::log10(error / power));
+    }
+}
@@ -77,6 +77,17 @@ public:
     unsigned int decision_maker_v(std::vector<gr_complex> sample);
     //! Also calculates the phase error.
     unsigned int decision_maker_pe(const gr_complex* sample, float* phase_error);
+
+    /*! \brief Hard decisions for a buffer of samples.
+     *
+     * \details Equivalent to calling #decision_maker for each of the \p nsymbols
+     * groups of dimensionality() samples in \p samples, writing the results to
+     * \p symbols. Constellations that slice by nearest point override this to
+     * skip the per-sample virtual call.
+     */
+    virtual void decision_maker_batch(const gr_complex* samples,
+                                      unsigned int* symbols,
+                                      unsigned int nsymbols);
     //! Calculates distance.
     // unsigned int decision_maker_e(const gr_complex *sample, float *error);
 
@@ -207,6 +218,16 @@ public:
      */
     std::vector<float> soft_decision_maker(gr_complex sample);
 
+    /*! \brief Soft decisions for a buffer of samples.
+     *
+     * \details Writes the soft decisions of each of the \p nsamples samples
+     * one after the other to \p soft_bits, as #soft_decision_maker would return
+     * them. Uses the LUT if one is defined. Does not allocate.
+     */
+    void soft_decision_maker_batch(const gr_complex* samples,
+                                   float* soft_bits,
+                                   unsigned int nsamples);
+
 
 protected:
     std::vector<gr_complex> d_constellation;
@@ -220,16 +241,30 @@ protected:
     float d_scalefactor, d_maxamp;
     float d_re_min, d_re_max, d_im_min, d_im_max;
 
-    std::vector<std::vector<float>> d_soft_dec_lut;
+    //! Soft decision LUT, d_lut_width values per cell, row by row.
+    std::vector<float> d_soft_dec_lut;
+    unsigned int d_lut_width;
     int d_lut_precision;
     float d_lut_scale;
     float d_npwr;
     float d_padding;
     bool d_use_external_lut;
 
+    //! Spatial index for get_closest_point() (dimensionality 1 only): a
+    //! d_grid_size x d_grid_size grid over +/- d_grid_extent on each axis,
+    //! listing for each cell the points which can be nearest to a sample in it.
+    unsigned int d_grid_size;
+    float d_grid_extent;
+    float d_grid_scale;
+    std::vector<unsigned int> d_grid_offsets;
+    std::vector<unsigned int> d_grid_points;
+
     float get_distance(unsigned int index, const gr_complex* sample);
     unsigned int get_closest_point(const gr_complex* sample);
     void calc_arity();
+    void build_decision_grid();
+    void compute_soft_dec(gr_complex sample, float npwr, float* soft_bits);
+    unsigned int soft_dec_lut_index(gr_complex sample);
 
     void max_min_axes();
 };
@@ -243,9 +278,10 @@ protected:
  *  \ingroup digital
  *
  * \details
- * Constellation which calculates the distance to each point in the
- * constellation for decision making. Inefficient for large
- * constellations.
+ * Constellation which makes decisions by the shortest Euclidean
+ * distance. One-dimensional constellations of 16 points or more only
+ * compare the sample against the few points a precomputed grid lists
+ * for its neighbourhood; others search all points.
  */
 class DIGITAL_API constellation_calcdist : public constellation
 {
@@ -273,6 +309,9 @@ public:
                      normalization_t normalization = AMPLITUDE_NORMALIZATION);
 
     unsigned int decision_maker(const gr_complex* sample) override;
+    void decision_maker_batch(const gr_complex* samples,
+                              unsigned int* symbols,
+                              unsigned int nsymbols) override;
     // void calc_metric(gr_complex *sample, float *metric, trellis_metric_type_t type);
     // void calc_euclidean_metric(gr_complex *sample, float *metric);
     // void calc_hard_symbol_metric(gr_complex *sample, float *metric);
@@ -18,8 +18,10 @@
 #include <gnuradio/math.h>
 
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
+#include <cmath>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -43,11 +45,15 @@ constellation::constellation(std::vector<gr_complex> constell,
       d_re_max(1e20),
       d_im_min(1e20),
       d_im_max(1e20),
+      d_lut_width(0),
       d_lut_precision(0),
       d_lut_scale(0),
       d_npwr(npwr),
       d_padding(2.0),
-      d_use_external_lut(false)
+      d_use_external_lut(false),
+      d_grid_size(0),
+      d_grid_extent(0),
+      d_grid_scale(0)
 {
     unsigned int constsize = d_constellation.size();
     normalize(normalization);
@@ -72,11 +78,15 @@ constellation::constellation()
       d_re_max(1e20),
       d_im_min(1e20),
       d_im_max(1e20),
+      d_lut_width(0),
       d_lut_precision(0.0),
       d_lut_scale(0.0),
       d_npwr(1.0),
       d_padding(2.0),
-      d_use_external_lut(false)
+      d_use_external_lut(false),
+      d_grid_size(0),
+      d_grid_extent(0),
+      d_grid_scale(0)
 {
     calc_arity();
 }
@@ -120,6 +130,10 @@ void constellation::normalize(normalization_t normalization)
         throw std::runtime_error("Invalid constellation normalization type.");
     }
     max_min_axes();
+    // The grid is built by calc_arity() on construction; rebuild it if the points
+    // are rescaled later on.
+    if (!d_grid_offsets.empty())
+        build_decision_grid();
 }
 
 //! Returns the constellation points for a symbol value
@@ -148,6 +162,30 @@ float constellation::get_distance(unsigned int index, const gr_complex* sample)
 
 unsigned int constellation::get_closest_point(const gr_complex* sample)
 {
+    if (d_grid_size) {
+        const float fx = (sample->real() + d_grid_extent) * d_grid_scale;
+        const float fy = (sample->imag() + d_grid_extent) * d_grid_scale;
+        // also false for NaN; such samples take the exhaustive search below
+        if (fx >= 0 && fx < d_grid_size && fy >= 0 && fy < d_grid_size) {
+            const unsigned int cell = static_cast<unsigned int>(fy) * d_grid_size +
+                                      static_cast<unsigned int>(fx);
+            // Candidates are in ascending order, so ties resolve to the same
+            // point as in the exhaustive search.
+            const unsigned int* p = &d_grid_points[d_grid_offsets[cell]];
+            const unsigned int* end = &d_grid_points[0] + d_grid_offsets[cell + 1];
+            unsigned int min_index = *p;
+            float min_euclid_dist = get_distance(*p, sample);
+            for (++p; p < end; ++p) {
+                float euclid_dist = get_distance(*p, sample);
+                if (euclid_dist < min_euclid_dist) {
+                    min_euclid_dist = euclid_dist;
+                    min_index = *p;
+                }
+            }
+            return min_index;
+        }
+    }
+
     float min_euclid_dist = get_distance(0, sample);
     unsigned int min_index = 0;
     for (unsigned int j = 1; j < d_arity; j++) {
@@ -160,6 +198,71 @@ unsigned int constellation::get_closest_point(const gr_complex* sample)
     return min_index;
 }
 
+void constellation::build_decision_grid()
+{
+    d_grid_size = 0;
+    d_grid_offsets.clear();
+    d_grid_points.clear();
+
+    // Small constellations are searched faster than indexed.
+    if (d_dimensionality != 1 || d_arity < 16 || !(d_maxamp > 0))
+        return;
+
+    // About four cells per point, covering the same area as the soft decision LUT.
+    const unsigned int size = std::min(
+        2 * static_cast<unsigned int>(std::ceil(std::sqrt(double(d_arity)))), 64u);
+    const double extent = d_padding * d_maxamp;
+    const double cell = 2.0 * extent / size;
+
+    d_grid_offsets.reserve(size * size + 1);
+    d_grid_offsets.push_back(0);
+    std::vector<double> min_dist(d_arity);
+    for (unsigned int cy = 0; cy < size; cy++) {
+        const double y0 = -extent + cy * cell;
+        const double y1 = y0 + cell;
+        for (unsigned int cx = 0; cx < size; cx++) {
+            const double x0 = -extent + cx * cell;
+            const double x1 = x0 + cell;
+
+            // Every sample in the cell is within max_dist of the point whose farthest
+            // corner is nearest, so points further than that from the whole cell
+            // can never be the closest.
+            double bound = DBL_MAX;
+            for (unsigned int p = 0; p < d_arity; p++) {
+                const double re = d_constellation[p].real();
+                const double im = d_constellation[p].imag();
+                const double fx = std::max(std::abs(re - x0), std::abs(re - x1));
+                const double fy = std::max(std::abs(im - y0), std::abs(im - y1));
+                bound = std::min(bound, fx * fx + fy * fy);
+                const double nx = std::max({ x0 - re, 0.0, re - x1 });
+                const double ny = std::max({ y0 - im, 0.0, im - y1 });
+                min_dist[p] = nx * nx + ny * ny;
+            }
+            // margin for the rounding of the single precision distances and cell
+            // index of get_closest_point()
+            bound = bound * (1.0 + 1e-4) + 1e-12;
+            for (unsigned int p = 0; p < d_arity; p++) {
+                if (min_dist[p] <= bound)
+                    d_grid_points.push_back(p);
+            }
+            d_grid_offsets.push_back(d_grid_points.size());
+        }
+    }
+
+    d_grid_size = size;
+    d_grid_extent = extent;
+    d_grid_scale = size / (2.0 * extent);
+}
+
+void constellation::decision_maker_batch(const gr_complex* samples,
+                                         unsigned int* symbols,
+                                         unsigned int nsymbols)
+{
+    for (unsigned int i = 0; i < nsymbols; i++) {
+        symbols[i] = decision_maker(&samples[i * d_dimensionality]);
+    }
+}
+
 unsigned int constellation::decision_maker_pe(const gr_complex* sample,
                                               float* phase_error)
 {
@@ -242,6 +345,7 @@ void constellation::calc_arity()
         throw std::runtime_error(
             "Constellation vector size must be a multiple of the dimensionality.");
     d_arity = d_constellation.size() / d_dimensionality;
+    build_decision_grid();
 }
 
 unsigned int constellation::decision_maker_v(std::vector<gr_complex> sample)
@@ -257,6 +361,8 @@ void constellation::gen_soft_dec_lut(int precision, float npwr)
     // maximum point in the constellation
     d_soft_dec_lut.clear();
     d_lut_scale = powf(2.0f, static_cast<float>(precision));
+    d_lut_width = static_cast<unsigned int>(
+        log(static_cast<double>(d_constellation.size())) / log(2.0));
 
     // we use a single unit border to prevent index overflow issues in the LUT
     float border = 1.0 / d_lut_scale;
@@ -265,62 +371,54 @@ void constellation::gen_soft_dec_lut(int precision, float npwr)
     float maxd = (d_maxamp * d_padding) - border;
     float step = (2.0 * maxd) / (d_lut_scale - 2.0);
 
-    int y = 0;
-    int endstop = d_lut_scale - 2;
+    const int endstop = d_lut_scale - 2;
+    if (endstop <= 0) {
+        d_lut_precision = precision;
+        return;
+    }
+    const int size = endstop + 2;
+    const unsigned int w = d_lut_width;
+    d_soft_dec_lut.resize(static_cast<size_t>(size) * size * w);
+
     // center the grid
     float start = -maxd + step / 2;
-    while (y < endstop) {
-        int x = 0;
-        // This produces a bottom row of padding
-        if (y == 0) {
-            while (x < endstop) {
-                if (x == 0 || x == endstop - 1) {
-                    d_soft_dec_lut.push_back(calc_soft_dec(
-                        gr_complex(start + (x * step), start + (y * step)), npwr));
-                }
-                d_soft_dec_lut.push_back(calc_soft_dec(
-                    gr_complex(start + (x * step), start + (y * step)), npwr));
-                x += 1;
-            }
-            x = 0;
-        }
-        // This produces the center body of the LUT
-        while (x < endstop) {
-            // duplicate values at the edge of the LUT to prevent index overflow
-            if (x == 0 || x == endstop - 1) {
-                d_soft_dec_lut.push_back(calc_soft_dec(
-                    gr_complex(start + (x * step), start + (y * step)), npwr));
-            }
-            d_soft_dec_lut.push_back(
-                calc_soft_dec(gr_complex(start + (x * step), start + (y * step)), npwr));
-            x += 1;
-        }
-        x = 0;
-        // This produces the top row of padding
-        if (y == endstop - 1) {
-            while (x < endstop) {
-                if (x == 0 || x == endstop - 1) {
-                    d_soft_dec_lut.push_back(calc_soft_dec(
-                        gr_complex(start + (x * step), start + (y * step)), npwr));
-                }
-                d_soft_dec_lut.push_back(calc_soft_dec(
-                    gr_complex(start + (x * step), start + (y * step)), npwr));
-                x += 1;
-            }
+    // This produces the center body of the LUT, rows and columns 1 .. endstop
+    for (int y = 0; y < endstop; y++) {
+        float* row = &d_soft_dec_lut[(static_cast<size_t>(y + 1) * size + 1) * w];
+        for (int x = 0; x < endstop; x++) {
+            compute_soft_dec(
+                gr_complex(start + (x * step), start + (y * step)), npwr, &row[x * w]);
         }
-        y += 1;
+        // duplicate values at the edge of the LUT to prevent index overflow
+        std::copy_n(row, w, row - w);
+        std::copy_n(row + (endstop - 1) * w, w, row + endstop * w);
     }
+    // This produces the bottom and top rows of padding
+    const size_t row_len = static_cast<size_t>(size) * w;
+    std::copy_n(&d_soft_dec_lut[row_len], row_len, &d_soft_dec_lut[0]);
+    std::copy_n(&d_soft_dec_lut[endstop * row_len],
+                row_len,
+                &d_soft_dec_lut[(endstop + 1) * row_len]);
 
     d_lut_precision = precision;
 }
 
 std::vector<float> constellation::calc_soft_dec(gr_complex sample, float npwr)
 {
-    int v;
     int M = static_cast<int>(d_constellation.size());
     int k = static_cast<int>(log(static_cast<double>(M)) / log(2.0));
-    std::vector<float> tmp(2 * k, 0);
     std::vector<float> s(k, 0);
+    compute_soft_dec(sample, npwr, s.data());
+    return s;
+}
+
+void constellation::compute_soft_dec(gr_complex sample, float npwr, float* s)
+{
+    int v;
+    int M = static_cast<int>(d_constellation.size());
+    int k = static_cast<int>(log(static_cast<double>(M)) / log(2.0));
+    // M fits into an int, so there are at most 31 bits per point
+    float tmp[2 * 32] = { 0 };
     float smallestnum = 1e-45;
 
     // check if noise power was set
@@ -391,8 +489,6 @@ std::vector<float> constellation::calc_soft_dec(gr_complex sample, float npwr)
         }
         s[k - 1 - i] = (logf(one) - logf(zero));
     }
-
-    return s;
 }
 
 void constellation::set_soft_dec_lut(const std::vector<std::vector<float>>& soft_dec_lut,
@@ -400,7 +496,15 @@ void constellation::set_soft_dec_lut(const std::vector<std::vector<float>>& soft
 {
     max_min_axes();
     d_use_external_lut = true;
-    d_soft_dec_lut = soft_dec_lut;
+    d_lut_width = soft_dec_lut.empty() ? 0 : soft_dec_lut[0].size();
+    d_soft_dec_lut.clear();
+    d_soft_dec_lut.reserve(soft_dec_lut.size() * d_lut_width);
+    for (const auto& entry : soft_dec_lut) {
+        if (entry.size() != d_lut_width)
+            throw std::runtime_error(
+                "All soft decision LUT entries must be of the same length.");
+        d_soft_dec_lut.insert(d_soft_dec_lut.end(), entry.begin(), entry.end());
+    }
     d_lut_precision = precision;
     d_lut_scale = powf(2.0, static_cast<float>(precision));
 }
@@ -415,47 +519,83 @@ void constellation::set_npwr(float npwr)
 
 bool constellation::has_soft_dec_lut() { return !d_soft_dec_lut.empty(); }
 
-std::vector<std::vector<float>> constellation::soft_dec_lut() { return d_soft_dec_lut; }
+std::vector<std::vector<float>> constellation::soft_dec_lut()
+{
+    std::vector<std::vector<float>> lut;
+    if (d_lut_width == 0)
+        return lut;
+    lut.reserve(d_soft_dec_lut.size() / d_lut_width);
+    for (auto it = d_soft_dec_lut.begin(); it != d_soft_dec_lut.end(); it += d_lut_width)
+        lut.emplace_back(it, it + d_lut_width);
+    return lut;
+}
 
-std::vector<float> constellation::soft_decision_maker(gr_complex sample)
+unsigned int constellation::soft_dec_lut_index(gr_complex sample)
 {
-    if (has_soft_dec_lut()) {
-        // Clip to just below 1 --> at 1, we can overflow the index
-        // that will put us in the next row of the 2D LUT.
-        float maxd = (d_padding * d_maxamp);
+    // Clip to just below 1 --> at 1, we can overflow the index
+    // that will put us in the next row of the 2D LUT.
+    float maxd = (d_padding * d_maxamp);
 
-        float border = 1.0f / d_lut_scale;
-        float limit = maxd - border;
-        float xre = branchless_clip(sample.real(), limit) / maxd;
-        float xim = branchless_clip(sample.imag(), limit) / maxd;
+    float border = 1.0f / d_lut_scale;
+    float limit = maxd - border;
+    float xre = branchless_clip(sample.real(), limit) / maxd;
+    float xim = branchless_clip(sample.imag(), limit) / maxd;
 
-        // We normalize the constellation in the ctor, so we know that
-        // the maximum dimensions go from -1 to +1. We can infer the x
-        // and y scale directly.
-        float scale = (d_lut_scale - 2.0f) / (2.0f);
+    // We normalize the constellation in the ctor, so we know that
+    // the maximum dimensions go from -1 to +1. We can infer the x
+    // and y scale directly.
+    float scale = (d_lut_scale - 2.0f) / (2.0f);
 
-        // Convert the clipped x and y samples to nearest index offset
-        xre = floorf((1.0f + xre) * scale) + 1;
-        xim = floorf((1.0f + xim) * scale) + 1;
+    // Convert the clipped x and y samples to nearest index offset
+    xre = floorf((1.0f + xre) * scale) + 1;
+    xim = floorf((1.0f + xim) * scale) + 1;
 
-        int index = static_cast<int>(d_lut_scale * xim + xre);
+    int index = static_cast<int>(d_lut_scale * xim + xre);
 
-        int max_index = d_lut_scale * d_lut_scale;
+    int max_index = d_lut_scale * d_lut_scale;
 
-        // Make sure we are in bounds of the index
-        while (index >= max_index) {
-            index -= d_lut_scale;
-        }
-        while (index < 0) {
-            index += d_lut_scale;
-        }
+    // Make sure we are in bounds of the index
+    while (index >= max_index) {
+        index -= d_lut_scale;
+    }
+    while (index < 0) {
+        index += d_lut_scale;
+    }
+
+    return index;
+}
 
-        return d_soft_dec_lut[index];
+std::vector<float> constellation::soft_decision_maker(gr_complex sample)
+{
+    if (has_soft_dec_lut()) {
+        const auto entry =
+            d_soft_dec_lut.begin() + soft_dec_lut_index(sample) * d_lut_width;
+        return std::vector<float>(entry, entry + d_lut_width);
     } else {
         return calc_soft_dec(sample);
     }
 }
 
+void constellation::soft_decision_maker_batch(const gr_complex* samples,
+                                              float* soft_bits,
+                                              unsigned int nsamples)
+{
+    if (has_soft_dec_lut()) {
+        const float* lut = d_soft_dec_lut.data();
+        for (unsigned int i = 0; i < nsamples; i++) {
+            std::copy_n(&lut[soft_dec_lut_index(samples[i]) * d_lut_width],
+                        d_lut_width,
+                        &soft_bits[i * d_lut_width]);
+        }
+    } else {
+        const unsigned int k = static_cast<unsigned int>(
+            log(static_cast<double>(d_constellation.size())) / log(2.0));
+        for (unsigned int i = 0; i < nsamples; i++) {
+            compute_soft_dec(samples[i], -1, &soft_bits[i * k]);
+        }
+    }
+}
+
 void constellation::max_min_axes()
 {
     // Find min/max of constellation for both real and imag axes.
@@ -511,12 +651,20 @@ constellation_calcdist::constellation_calcdist(std::vector<gr_complex> constell,
 }
 
 // Chooses points base on shortest distance.
-// Inefficient.
 unsigned int constellation_calcdist::decision_maker(const gr_complex* sample)
 {
     return get_closest_point(sample);
 }
 
+void constellation_calcdist::decision_maker_batch(const gr_complex* samples,
+                                                  unsigned int* symbols,
+                                                  unsigned int nsymbols)
+{
+    for (unsigned int i = 0; i < nsymbols; i++) {
+        symbols[i] = get_closest_point(&samples[i * d_dimensionality]);
+    }
+}
+
 
 /********************************************************************/
 
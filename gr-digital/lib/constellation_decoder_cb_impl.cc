@@ -74,8 +74,10 @@ int constellation_decoder_cb_impl::general_work(int noutput_items,
 
     gr::thread::scoped_lock l(d_mutex);
 
+    d_symbols.resize(noutput_items);
+    d_constellation->decision_maker_batch(in, d_symbols.data(), noutput_items);
     for (int i = 0; i < noutput_items; i++) {
-        out[i] = d_constellation->decision_maker(&(in[i * d_dim]));
+        out[i] = d_symbols[i];
     }
 
     consume_each(noutput_items * d_dim);
@@ -13,6 +13,7 @@
 
 #include <gnuradio/digital/constellation_decoder_cb.h>
 #include <gnuradio/thread/thread.h>
+#include <vector>
 
 namespace gr {
 namespace digital {
@@ -22,6 +23,7 @@ class constellation_decoder_cb_impl : public constellation_decoder_cb
 private:
     constellation_sptr d_constellation;
     unsigned int d_dim;
+    std::vector<unsigned int> d_symbols;
     gr::thread::mutex d_mutex;
 
 public:
@@ -87,17 +87,10 @@ int constellation_soft_decoder_cf_impl::work(int noutput_items,
     gr_complex const* in = (const gr_complex*)input_items[0];
     float* out = (float*)output_items[0];
 
-    std::vector<float> bits;
-
     gr::thread::scoped_lock l(d_mutex);
 
     // FIXME: figure out how to manage d_dim
-    for (unsigned int i = 0; i < noutput_items / d_bps; i++) {
-        bits = d_constellation->soft_decision_maker(in[i]);
-        for (size_t j = 0; j < bits.size(); j++) {
-            out[d_bps * i + j] = bits[j];
-        }
-    }
+    d_constellation->soft_decision_maker_batch(in, out, noutput_items / d_bps);
 
     return noutput_items;
 }
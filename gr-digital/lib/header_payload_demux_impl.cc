@@ -372,18 +372,17 @@ int header_payload_demux_impl::find_trigger_signal(int skip_items,
         }
     }
     if (d_uses_trigger_tag) {
-        std::vector<tag_t> tags;
-        get_tags_in_range(tags,
-                          PORT_INPUTDATA,
-                          base_offset + skip_items,
-                          base_offset + max_rel_offset,
-                          d_trigger_tag_key);
-        if (!tags.empty()) {
-            const int tag_rel_offset = tags[0].offset - base_offset;
-            if (tag_rel_offset < rel_offset) {
-                rel_offset = tag_rel_offset;
-            }
-        }
+        visit_tags_in_range(PORT_INPUTDATA,
+                            base_offset + skip_items,
+                            base_offset + max_rel_offset,
+                            d_trigger_tag_key,
+                            [&](const tag_t& tag) {
+                                const int tag_rel_offset = tag.offset - base_offset;
+                                if (tag_rel_offset < rel_offset) {
+                                    rel_offset = tag_rel_offset;
+                                }
+                                return false;
+                            });
     }
     return rel_offset;
 } /* find_trigger_signal() */
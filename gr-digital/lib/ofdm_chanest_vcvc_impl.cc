@@ -14,6 +14,8 @@
 
 #include "ofdm_chanest_vcvc_impl.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <cmath>
 
 namespace gr {
 namespace digital {
@@ -55,7 +57,10 @@ ofdm_chanest_vcvc_impl::ofdm_chanest_vcvc_impl(
       d_new_symbol_diffs(0, 0),
       d_first_active_carrier(0),
       d_last_active_carrier(sync_symbol2.size() - 1),
-      d_interpolate(false)
+      d_interpolate(false),
+      d_ref_sym_inv(d_fft_len),
+      d_chan_taps(d_fft_len),
+      d_use_fft(false)
 {
     // Set index of first and last active carrier
     for (int i = 0; i < d_fft_len; i++) {
@@ -119,6 +124,32 @@ ofdm_chanest_vcvc_impl::ofdm_chanest_vcvc_impl(
         }
     }
 
+    for (int i = 0; i < d_fft_len; i++) {
+        if (d_ref_sym[i] != gr_complex(0, 0)) {
+            d_ref_sym_inv[i] = gr_complex(1, 0) / d_ref_sym[i];
+        }
+    }
+
+    // Correlating each candidate offset costs O(fft_len); the FFT correlation covers
+    // all of them in O(fft_len * log(fft_len)).
+    const int n_offsets = (d_max_pos_carr_offset - d_max_neg_carr_offset) / 2 + 1;
+    if (n_offsets > std::log2(d_fft_len)) {
+        d_use_fft = true;
+        d_fft = std::make_unique<fft::fft_complex_fwd>(d_fft_len);
+        d_ifft = std::make_unique<fft::fft_complex_rev>(d_fft_len);
+        gr_complex* buf = d_fft->get_inbuf();
+        for (int i = 0; i < d_fft_len; i++) {
+            buf[i] = d_corr_v.empty() ? gr_complex(d_known_symbol_diffs[i], 0)
+                                      : d_corr_v[i];
+        }
+        d_fft->execute();
+        d_corr_spectrum.resize(d_fft_len);
+        const gr_complex* spectrum = d_fft->get_outbuf();
+        for (int i = 0; i < d_fft_len; i++) {
+            d_corr_spectrum[i] = std::conj(spectrum[i]);
+        }
+    }
+
     set_output_multiple(d_n_data_syms);
     set_relative_rate((uint64_t)d_n_data_syms, (uint64_t)(d_n_data_syms + d_n_sync_syms));
     set_tag_propagation_policy(TPP_DONT);
@@ -133,46 +164,92 @@ void ofdm_chanest_vcvc_impl::forecast(int noutput_items,
         (noutput_items / d_n_data_syms) * (d_n_data_syms + d_n_sync_syms);
 }
 
-int ofdm_chanest_vcvc_impl::get_carr_offset(const gr_complex* sync_sym1,
-                                            const gr_complex* sync_sym2)
+float ofdm_chanest_vcvc_impl::carr_offset_metric(int g,
+                                                 const gr_complex* sync_sym1,
+                                                 const gr_complex* sync_sym2) const
 {
-    int carr_offset = 0;
     if (!d_corr_v.empty()) {
         // Use Schmidl & Cox method
-        float Bg_max = 0;
-        // g here is 2g in the paper
-        for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
-            gr_complex tmp = gr_complex(0, 0);
-            for (int k = 0; k < d_fft_len; k++) {
-                if (d_corr_v[k] != gr_complex(0, 0)) {
-                    tmp += std::conj(sync_sym1[k + g]) * std::conj(d_corr_v[k]) *
-                           sync_sym2[k + g];
-                }
-            }
-            if (std::abs(tmp) > Bg_max) {
-                Bg_max = std::abs(tmp);
-                carr_offset = g;
+        gr_complex tmp = gr_complex(0, 0);
+        for (int k = 0; k < d_fft_len; k++) {
+            if (d_corr_v[k] != gr_complex(0, 0)) {
+                tmp += std::conj(sync_sym1[k + g]) * std::conj(d_corr_v[k]) *
+                       sync_sym2[k + g];
             }
         }
+        return std::abs(tmp);
     } else {
         // Correlate
-        std::fill(d_new_symbol_diffs.begin(), d_new_symbol_diffs.end(), 0);
+        float sum = 0;
+        for (int j = 0; j < d_fft_len; j++) {
+            if (d_known_symbol_diffs[j]) {
+                sum += (d_known_symbol_diffs[j] * d_new_symbol_diffs[j + g]);
+            }
+        }
+        return sum;
+    }
+}
+
+int ofdm_chanest_vcvc_impl::get_carr_offset(const gr_complex* sync_sym1,
+                                            const gr_complex* sync_sym2)
+{
+    if (d_corr_v.empty()) {
         for (int i = 0; i < d_fft_len - 2; i++) {
             d_new_symbol_diffs[i] = std::norm(sync_sym1[i] - sync_sym1[i + 2]);
         }
+    }
 
-        float sum;
-        float max = 0;
+    int carr_offset = 0;
+    float max = 0;
+    // g here is 2g in the Schmidl & Cox paper
+    if (!d_use_fft) {
         for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
-            sum = 0;
-            for (int j = 0; j < d_fft_len; j++) {
-                if (d_known_symbol_diffs[j]) {
-                    sum += (d_known_symbol_diffs[j] * d_new_symbol_diffs[j + g]);
-                }
-                if (sum > max) {
-                    max = sum;
-                    carr_offset = g;
-                }
+            const float metric = carr_offset_metric(g, sync_sym1, sync_sym2);
+            if (metric > max) {
+                max = metric;
+                carr_offset = g;
+            }
+        }
+        return carr_offset;
+    }
+
+    // Circular cross-correlation with the known sequence. As the active carriers
+    // stay within the symbol for all allowed offsets, it does not wrap around.
+    gr_complex* buf = d_fft->get_inbuf();
+    if (!d_corr_v.empty()) {
+        volk_32fc_x2_multiply_conjugate_32fc(buf, sync_sym2, sync_sym1, d_fft_len);
+    } else {
+        for (int i = 0; i < d_fft_len; i++) {
+            buf[i] = gr_complex(d_new_symbol_diffs[i], 0);
+        }
+    }
+    d_fft->execute();
+    volk_32fc_x2_multiply_32fc(
+        d_ifft->get_inbuf(), d_fft->get_outbuf(), d_corr_spectrum.data(), d_fft_len);
+    d_ifft->execute();
+    const gr_complex* corr = d_ifft->get_outbuf();
+
+    auto fft_metric = [&](int g) {
+        const gr_complex c = corr[g < 0 ? g + d_fft_len : g];
+        return d_corr_v.empty() ? c.real() : std::abs(c);
+    };
+    float peak = 0;
+    for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
+        peak = std::max(peak, fft_metric(g));
+    }
+    if (peak <= 0) {
+        return carr_offset;
+    }
+
+    // Offsets within the rounding error of the peak are correlated directly, so the
+    // choice between (nearly) equal candidates is the same as without the FFT.
+    const float threshold = peak * (1.0f - 1e-3f);
+    for (int g = d_max_neg_carr_offset; g <= d_max_pos_carr_offset; g += 2) {
+        if (fft_metric(g) >= threshold) {
+            const float metric = carr_offset_metric(g, sync_sym1, sync_sym2);
+            if (metric > max) {
+                max = metric;
+                carr_offset = g;
             }
         }
     }
@@ -187,18 +264,14 @@ void ofdm_chanest_vcvc_impl::get_chan_taps(const gr_complex* sync_sym1,
 {
     const gr_complex* sym = ((d_n_sync_syms == 2) ? sync_sym2 : sync_sym1);
     std::fill(taps.begin(), taps.end(), gr_complex(0, 0));
-    int loop_start = 0;
-    int loop_end = d_fft_len;
-    if (carr_offset > 0) {
-        loop_start = carr_offset;
-    } else if (carr_offset < 0) {
-        loop_end = d_fft_len + carr_offset;
-    }
-    for (int i = loop_start; i < loop_end; i++) {
-        if ((d_ref_sym[i - carr_offset] != gr_complex(0, 0))) {
-            taps[i - carr_offset] = sym[i] / d_ref_sym[i - carr_offset];
-        }
-    }
+    // taps[i] = sym[i + carr_offset] / d_ref_sym[i] for the carriers within the
+    // symbol; carriers with a zero reference symbol get zero taps
+    const int taps_start = std::max(0, -carr_offset);
+    const int taps_end = std::min(d_fft_len, d_fft_len - carr_offset);
+    volk_32fc_x2_multiply_32fc(&taps[taps_start],
+                               &sym[taps_start + carr_offset],
+                               &d_ref_sym_inv[taps_start],
+                               taps_end - taps_start);
 
     if (d_interpolate) {
         for (int i = d_first_active_carrier + 1; i < d_last_active_carrier; i += 2) {
@@ -228,8 +301,7 @@ int ofdm_chanest_vcvc_impl::general_work(int noutput_items,
 
     // Channel info estimation
     int carr_offset = get_carr_offset(in, in + d_fft_len);
-    std::vector<gr_complex> chan_taps(d_fft_len, 0);
-    get_chan_taps(in, in + d_fft_len, carr_offset, chan_taps);
+    get_chan_taps(in, in + d_fft_len, carr_offset, d_chan_taps);
     add_item_tag(0,
                  nitems_written(0),
                  pmt::string_to_symbol("ofdm_sync_carr_offset"),
@@ -237,12 +309,14 @@ int ofdm_chanest_vcvc_impl::general_work(int noutput_items,
     add_item_tag(0,
                  nitems_written(0),
                  pmt::string_to_symbol("ofdm_sync_chan_taps"),
-                 pmt::init_c32vector(d_fft_len, chan_taps));
+                 pmt::init_c32vector(d_fft_len, d_chan_taps));
 
     // Copy data symbols
     if (output_items.size() == 2) {
         gr_complex* out_chantaps = ((gr_complex*)output_items[1]);
-        memcpy((void*)out_chantaps, (void*)&chan_taps[0], sizeof(gr_complex) * d_fft_len);
+        memcpy((void*)out_chantaps,
+               (void*)&d_chan_taps[0],
+               sizeof(gr_complex) * d_fft_len);
         produce(1, 1);
     }
     memcpy((void*)out,
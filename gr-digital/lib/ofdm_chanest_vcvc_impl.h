@@ -12,6 +12,9 @@
 #define INCLUDED_DIGITAL_OFDM_CHANEST_VCVC_IMPL_H
 
 #include <gnuradio/digital/ofdm_chanest_vcvc.h>
+#include <gnuradio/fft/fft.h>
+#include <volk/volk_alloc.hh>
+#include <memory>
 
 namespace gr {
 namespace digital {
@@ -48,7 +51,22 @@ private:
     int d_max_neg_carr_offset;
     //! Maximum carrier offset (positive value!)
     int d_max_pos_carr_offset;
+    //! 1 / d_ref_sym, 0 where d_ref_sym is 0
+    volk::vector<gr_complex> d_ref_sym_inv;
+    //! Channel estimate of the current frame
+    std::vector<gr_complex> d_chan_taps;
+    //! If true, the coarse freq. offset is found by FFT correlation over all offsets
+    //! at once instead of correlating each offset separately
+    bool d_use_fft;
+    //! Conjugated spectrum of d_corr_v or d_known_symbol_diffs
+    volk::vector<gr_complex> d_corr_spectrum;
+    std::unique_ptr<fft::fft_complex_fwd> d_fft;
+    std::unique_ptr<fft::fft_complex_rev> d_ifft;
 
+    //! Correlation metric of carrier offset \p g, larger is more likely
+    float carr_offset_metric(int g,
+                             const gr_complex* sync_sym1,
+                             const gr_complex* sync_sym2) const;
     //! Calculate the coarse frequency offset in number of carriers
     int get_carr_offset(const gr_complex* sync_sym1, const gr_complex* sync_sym2);
     //! Estimate the channel (phase and amplitude offset per carrier)
@@ -9,6 +9,8 @@
 #
 
 
+import numpy
+
 from gnuradio import gr, gr_unittest, digital, blocks
 
 
@@ -87,6 +89,32 @@ class test_constellation_decoder(gr_unittest.TestCase):
         # print("expected result", expected_result)
         self.assertFloatTuplesAlmostEqual(expected_result, actual_result)
 
+    def test_constellation_decoder_cb_apsk256(self):
+        # 256-APSK like ring constellation, large enough to use the decision grid
+        rings = ((16, 1.0), (32, 2.0), (48, 3.0), (64, 4.0), (96, 5.0))
+        points = [r * numpy.exp(2j * numpy.pi * (k + 0.5 * (i % 2)) / n)
+                  for i, (n, r) in enumerate(rings) for k in range(n)]
+        cnst = digital.constellation_calcdist(points, [], 1, 1)
+        cpoints = numpy.array(cnst.points(), dtype=numpy.complex64)
+
+        rng = numpy.random.default_rng(0)
+        src_data = (rng.uniform(-12, 12, 20000) +
+                    1j * rng.uniform(-12, 12, 20000)).astype(numpy.complex64)
+        # single precision distances, as computed by the constellation
+        diff = src_data[:, None] - cpoints[None, :]
+        dist = diff.real * diff.real + diff.imag * diff.imag
+        expected_result = tuple(numpy.argmin(dist, axis=1))
+
+        src = blocks.vector_source_c(src_data)
+        op = digital.constellation_decoder_cb(cnst.base())
+        dst = blocks.vector_sink_b()
+
+        self.tb.connect(src, op)
+        self.tb.connect(op, dst)
+        self.tb.run()
+
+        self.assertFloatTuplesAlmostEqual(expected_result, dst.data())
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_constellation_decoder)
@@ -214,6 +214,40 @@ class qa_ofdm_chanest_vcvc (gr_unittest.TestCase):
             sink.data(),
             list(numpy.multiply(shift_tuple(data_symbol, carr_offset), channel)))
 
+    def test_007_wideband_carroffset(self):
+        """ Large FFT with a wide offset search range, with one and with two
+        sync symbols """
+        fft_len = 2048
+        carr_offset = -348
+        n_guard = 400
+        active = range(n_guard, fft_len - n_guard)
+        bpsk = (1, -1)
+        sync_symbol1 = [0] * fft_len
+        sync_symbol2 = [0] * fft_len
+        data_symbol = [0] * fft_len
+        for i in active:
+            if i % 2 == 0:
+                sync_symbol1[i] = random.choice(bpsk)
+            sync_symbol2[i] = random.choice(bpsk)
+            data_symbol[i] = random.choice(bpsk)
+        for sync_symbols in ((sync_symbol1, sync_symbol2), (sync_symbol1, ())):
+            tx_data = ()
+            for sym in sync_symbols:
+                if len(sym):
+                    tx_data += shift_tuple(sym, carr_offset)
+            tx_data += shift_tuple(data_symbol, carr_offset)
+            src = blocks.vector_source_c(tx_data, False, fft_len)
+            chanest = digital.ofdm_chanest_vcvc(sync_symbols[0], sync_symbols[1], 1)
+            sink = blocks.vector_sink_c(fft_len)
+            self.tb = gr.top_block()
+            self.tb.connect(src, chanest, sink)
+            self.tb.run()
+            carr_offset_hat = None
+            for tag in sink.tags():
+                if pmt.symbol_to_string(tag.key) == 'ofdm_sync_carr_offset':
+                    carr_offset_hat = pmt.to_long(tag.value)
+            self.assertEqual(carr_offset_hat, carr_offset)
+
     def test_999_all_at_once(self):
         """docstring for test_999_all_at_once"""
         fft_len = 32
@@ -26,7 +26,9 @@ namespace dtv {
  * \details
  * Input: 188-byte MPEG-2 Transport Stream packets. \n
  * Output: Variable length FEC baseband frames (BBFRAME). The output frame
- *         length is based on the FEC rate.
+ *         length is based on the FEC rate, one bit per byte, or 8 bits
+ *         per byte with the first bit in the most significant position
+ *         when packed.
  */
 class DTV_API dvb_bbheader_bb : virtual public gr::block
 {
@@ -44,6 +46,8 @@ public:
      * \param inband DVB-T2 Type B in-band signalling.
      * \param fecblocks DVB-T2 number of FEC block for in-band signalling.
      * \param tsrate DVB-T2 Transport Stream rate for in-band signalling.
+     * \param bitformat unpacked or packed output bits. Packed bits are
+     *        not supported for medium frames.
      */
     static sptr make(dvb_standard_t standard,
                      dvb_framesize_t framesize,
@@ -52,7 +56,8 @@ public:
                      dvbt2_inputmode_t mode,
                      dvbt2_inband_t inband,
                      int fecblocks,
-                     int tsrate);
+                     int tsrate,
+                     dvb_bitformat_t bitformat = BITFORMAT_UNPACKED);
 };
 
 } // namespace dtv
@@ -24,6 +24,9 @@ namespace dtv {
  * \details
  * Input: Variable length FEC baseband frames (BBFRAME). \n
  * Output: Variable length FEC baseband frames with appended BCH (BCHFEC).
+ *
+ * Frames are one bit per byte, or 8 bits per byte with the first bit
+ * in the most significant position when packed.
  */
 class DTV_API dvb_bch_bb : virtual public gr::block
 {
@@ -36,9 +39,13 @@ public:
      * \param standard DVB standard (DVB-S2 or DVB-T2).
      * \param framesize FEC frame size (normal, medium or short).
      * \param rate FEC code rate.
+     * \param bitformat unpacked or packed input and output bits. Packed
+     *        bits are not supported for medium frames.
      */
-    static sptr
-    make(dvb_standard_t standard, dvb_framesize_t framesize, dvb_code_rate_t rate);
+    static sptr make(dvb_standard_t standard,
+                     dvb_framesize_t framesize,
+                     dvb_code_rate_t rate,
+                     dvb_bitformat_t bitformat = BITFORMAT_UNPACKED);
 };
 
 } // namespace dtv
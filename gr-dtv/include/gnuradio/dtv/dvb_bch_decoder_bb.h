@@ -0,0 +1,62 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_DTV_DVB_BCH_DECODER_BB_H
+#define INCLUDED_DTV_DVB_BCH_DECODER_BB_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/dtv/api.h>
+#include <gnuradio/dtv/dvb_config.h>
+
+namespace gr {
+namespace dtv {
+
+/*!
+ * \brief Decodes a BCH ((Bose, Chaudhuri, Hocquenghem) FEC.
+ * \ingroup dtv
+ *
+ * \details
+ * Frames whose BCH parity matches are passed through after a table
+ * driven parity check. Otherwise up to t = 8, 10 or 12 bit errors
+ * are corrected (Berlekamp-Massey and Chien search); frames with more
+ * errors are passed on uncorrected and counted in num_bad_frames().
+ *
+ * Input: FEC baseband frames with appended BCH (BCHFEC). \n
+ * Output: FEC baseband frames (BBFRAME).
+ */
+class DTV_API dvb_bch_decoder_bb : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<dvb_bch_decoder_bb> sptr;
+
+    /*!
+     * \brief Create a baseband frame BCH decoder.
+     *
+     * \param standard DVB standard (DVB-S2 or DVB-T2).
+     * \param framesize FEC frame size (normal, medium or short).
+     * \param rate FEC code rate.
+     */
+    static sptr
+    make(dvb_standard_t standard, dvb_framesize_t framesize, dvb_code_rate_t rate);
+
+    /*!
+     * Returns the number of frames passed on uncorrected because they had
+     * more errors than the code can correct.
+     */
+    virtual int num_bad_frames() const = 0;
+
+    /*!
+     * Returns the total number of frames seen by the decoder.
+     */
+    virtual int num_frames() const = 0;
+};
+
+} // namespace dtv
+} // namespace gr
+
+#endif /* INCLUDED_DTV_DVB_BCH_DECODER_BB_H */
@@ -109,6 +109,11 @@ enum dvb_guardinterval_t {
     GI_19_256,
 };
 
+enum dvb_bitformat_t {
+    BITFORMAT_UNPACKED = 0,
+    BITFORMAT_PACKED,
+};
+
 } // namespace dtv
 } // namespace gr
 
@@ -117,5 +122,6 @@ typedef gr::dtv::dvb_code_rate_t dvb_code_rate_t;
 typedef gr::dtv::dvb_framesize_t dvb_framesize_t;
 typedef gr::dtv::dvb_constellation_t dvb_constellation_t;
 typedef gr::dtv::dvb_guardinterval_t dvb_guardinterval_t;
+typedef gr::dtv::dvb_bitformat_t dvb_bitformat_t;
 
 #endif /* INCLUDED_DTV_DVB_CONFIG_H */
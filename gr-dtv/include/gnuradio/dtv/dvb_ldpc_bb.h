@@ -22,6 +22,9 @@ namespace dtv {
  *
  * Input: Variable length FEC baseband frames with appended BCH (BCHFEC). \n
  * Output: Normal, medium or short FEC baseband frames with appended LPDC (LDPCFEC).
+ *
+ * Frames are one bit per byte, or 8 bits per byte with the first bit
+ * in the most significant position when packed.
  */
 class DTV_API dvb_ldpc_bb : virtual public gr::block
 {
@@ -35,11 +38,16 @@ public:
      * \param framesize FEC frame size (normal, medium or short).
      * \param rate FEC code rate.
      * \param constellation DVB-S2 constellation.
+     * \param bitformat unpacked or packed input and output bits. Packed
+     *        bits need a whole number of bytes per frame, which excludes
+     *        medium frames, 128APSK and the 1/5 and 11/45 VL-SNR SF2
+     *        short frames.
      */
     static sptr make(dvb_standard_t standard,
                      dvb_framesize_t framesize,
                      dvb_code_rate_t rate,
-                     dvb_constellation_t constellation);
+                     dvb_constellation_t constellation,
+                     dvb_bitformat_t bitformat = BITFORMAT_UNPACKED);
 };
 
 } // namespace dtv
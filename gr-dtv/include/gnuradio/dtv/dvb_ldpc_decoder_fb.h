@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_DTV_DVB_LDPC_DECODER_FB_H
+#define INCLUDED_DTV_DVB_LDPC_DECODER_FB_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/dtv/api.h>
+#include <gnuradio/dtv/dvb_config.h>
+
+namespace gr {
+namespace dtv {
+
+/*!
+ * \brief Decodes a LDPC (Low-Density Parity-Check) FEC.
+ * \ingroup dtv
+ *
+ * \details
+ * Layered normalized min-sum decoder for the codes of dvb_ldpc_bb. The
+ * 360 parity checks of each group of the quasi-cyclic parity check
+ * matrix are updated together, and several frames are decoded side by
+ * side. Decoding of a frame stops as soon as all parity checks are
+ * satisfied.
+ *
+ * Input: Normal, medium or short FEC frames (LDPCFEC) as soft bits,
+ * log-likelihood ratios log(P(0) / P(1)), i.e. positive for a 0. \n
+ * Output: FEC baseband frames with appended BCH (BCHFEC), one bit per byte.
+ */
+class DTV_API dvb_ldpc_decoder_fb : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<dvb_ldpc_decoder_fb> sptr;
+
+    /*!
+     * \brief Create a baseband frame LDPC decoder.
+     *
+     * \param standard DVB standard (DVB-S2 or DVB-T2).
+     * \param framesize FEC frame size (normal, medium or short).
+     * \param rate FEC code rate.
+     * \param constellation DVB-S2 constellation.
+     * \param max_iterations Maximum number of decoder iterations.
+     */
+    static sptr make(dvb_standard_t standard,
+                     dvb_framesize_t framesize,
+                     dvb_code_rate_t rate,
+                     dvb_constellation_t constellation,
+                     int max_iterations = 25);
+};
+
+} // namespace dtv
+} // namespace gr
+
+#endif /* INCLUDED_DTV_DVB_LDPC_DECODER_FB_H */
@@ -22,6 +22,9 @@ namespace dtv {
  *
  * Input: Normal or short FEC baseband frames with appended LPDC (LDPCFEC). \n
  * Output: Bit interleaved (with column twist and bit to cell word de-multiplexed) cells.
+ *
+ * Input frames are one bit per byte, or 8 bits per byte with the first
+ * bit in the most significant position when packed.
  */
 class DTV_API dvbt2_interleaver_bb : virtual public gr::block
 {
@@ -34,10 +37,12 @@ public:
      * \param framesize FEC frame size (normal or short).
      * \param rate FEC code rate.
      * \param constellation DVB-T2 constellation.
+     * \param bitformat unpacked or packed input bits.
      */
     static sptr make(dvb_framesize_t framesize,
                      dvb_code_rate_t rate,
-                     dvb_constellation_t constellation);
+                     dvb_constellation_t constellation,
+                     dvb_bitformat_t bitformat = BITFORMAT_UNPACKED);
 };
 
 } // namespace dtv
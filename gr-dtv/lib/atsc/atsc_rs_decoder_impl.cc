@@ -25,10 +25,6 @@ static const int rs_init_fcr = 0;  // first consecutive root
 static const int rs_init_prim = 1; // primitive is 1 (alpha)
 static const int rs_init_nroots = 20;
 
-static const int N = (1 << rs_init_symsize) - 1; // 255
-
-static const int amount_of_pad = N - ATSC_MPEG_RS_ENCODED_LENGTH; // 48
-
 atsc_rs_decoder::sptr atsc_rs_decoder::make()
 {
     return gnuradio::make_block_sptr<atsc_rs_decoder_impl>();
@@ -50,27 +46,6 @@ atsc_rs_decoder_impl::atsc_rs_decoder_impl()
     d_total_packets = 0;
 }
 
-int atsc_rs_decoder_impl::decode(uint8_t* out, const uint8_t* in)
-{
-    unsigned char tmp[N];
-    int ncorrections;
-
-    // assert((int)(amount_of_pad + sizeof(in.data)) == N);
-    assert((int)(amount_of_pad + ATSC_MPEG_RS_ENCODED_LENGTH) == N);
-
-    // add missing prefix zero padding to message
-    memset(tmp, 0, amount_of_pad);
-    memcpy(&tmp[amount_of_pad], in, ATSC_MPEG_RS_ENCODED_LENGTH);
-
-    // correct message...
-    ncorrections = decode_rs_char(d_rs, tmp, 0, 0);
-
-    // copy corrected message to output, skipping prefix zero padding
-    memcpy(out, &tmp[amount_of_pad], ATSC_MPEG_PKT_LENGTH);
-
-    return ncorrections;
-}
-
 atsc_rs_decoder_impl::~atsc_rs_decoder_impl()
 {
     if (d_rs)
@@ -96,13 +71,24 @@ int atsc_rs_decoder_impl::work(int noutput_items,
     auto plin = static_cast<const plinfo*>(input_items[1]);
     auto plout = static_cast<plinfo*>(output_items[1]);
 
+    // Decode all packets in place, error free ones only cost a syndrome check
+    d_codewords.assign(in, in + noutput_items * ATSC_MPEG_RS_ENCODED_LENGTH);
+    d_results.resize(noutput_items);
+    decode_rs_char_batch(d_rs,
+                         d_codewords.data(),
+                         ATSC_MPEG_RS_ENCODED_LENGTH,
+                         noutput_items,
+                         d_results.data());
+
     for (int i = 0; i < noutput_items; i++) {
         assert(plin[i].regular_seg_p());
 
         plout[i] = plin[i]; // copy pipeline info...
 
-        int nerrors_corrected =
-            decode(&out[i * ATSC_MPEG_PKT_LENGTH], &in[i * ATSC_MPEG_RS_ENCODED_LENGTH]);
+        memcpy(&out[i * ATSC_MPEG_PKT_LENGTH],
+               &d_codewords[i * ATSC_MPEG_RS_ENCODED_LENGTH],
+               ATSC_MPEG_PKT_LENGTH);
+        int nerrors_corrected = d_results[i];
         plout[i].set_transport_error(nerrors_corrected == -1);
         if (nerrors_corrected == -1) {
             d_bad_packet_count++;
@@ -17,6 +17,7 @@
 extern "C" {
 #include <gnuradio/fec/rs.h>
 }
+#include <vector>
 
 namespace gr {
 namespace dtv {
@@ -28,6 +29,8 @@ private:
     int d_bad_packet_count;
     int d_total_packets;
     void* d_rs;
+    std::vector<uint8_t> d_codewords;
+    std::vector<int> d_results;
 
 public:
     atsc_rs_decoder_impl();
@@ -39,12 +42,6 @@ public:
     int num_bad_packets() const override;
     int num_packets() const override;
 
-    /*!
-     * Decode RS encoded packet.
-     * \returns a count of corrected symbols, or -1 if the block was uncorrectible.
-     */
-    int decode(uint8_t* out, const uint8_t* in);
-
     int work(int noutput_items,
              gr_vector_const_void_star& input_items,
              gr_vector_void_star& output_items) override;
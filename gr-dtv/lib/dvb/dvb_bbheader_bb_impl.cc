@@ -12,6 +12,7 @@
 
 #include "dvb_bbheader_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <stdexcept>
 
 namespace gr {
 namespace dtv {
@@ -23,10 +24,11 @@ dvb_bbheader_bb::sptr dvb_bbheader_bb::make(dvb_standard_t standard,
                                             dvbt2_inputmode_t mode,
                                             dvbt2_inband_t inband,
                                             int fecblocks,
-                                            int tsrate)
+                                            int tsrate,
+                                            dvb_bitformat_t bitformat)
 {
     return gnuradio::make_block_sptr<dvb_bbheader_bb_impl>(
-        standard, framesize, rate, rolloff, mode, inband, fecblocks, tsrate);
+        standard, framesize, rate, rolloff, mode, inband, fecblocks, tsrate, bitformat);
 }
 
 /*
@@ -39,11 +41,17 @@ dvb_bbheader_bb_impl::dvb_bbheader_bb_impl(dvb_standard_t standard,
                                            dvbt2_inputmode_t mode,
                                            dvbt2_inband_t inband,
                                            int fecblocks,
-                                           int tsrate)
+                                           int tsrate,
+                                           dvb_bitformat_t bitformat)
     : gr::block("dvb_bbheader_bb",
                 gr::io_signature::make(1, 1, sizeof(unsigned char)),
-                gr::io_signature::make(1, 1, sizeof(unsigned char)))
+                gr::io_signature::make(1, 1, sizeof(unsigned char))),
+      packed(bitformat == BITFORMAT_PACKED)
 {
+    if (packed && framesize == FECFRAME_MEDIUM) {
+        throw std::invalid_argument(
+            "dvb_bbheader_bb: packed bits are not supported for medium frames");
+    }
     count = 0;
     crc = 0x0;
     dvbs2x = FALSE;
@@ -285,8 +293,9 @@ dvb_bbheader_bb_impl::dvb_bbheader_bb_impl(dvb_standard_t standard,
     fec_block = 0;
     ts_rate = tsrate;
     extra = (((kbch - 80) / 8) / 187) + 1;
+    frame_items = packed ? kbch / 8 : kbch;
     if (framesize != FECFRAME_MEDIUM) {
-        set_output_multiple(kbch);
+        set_output_multiple(frame_items);
     } else {
         set_output_multiple(kbch * 2);
     }
@@ -300,14 +309,15 @@ dvb_bbheader_bb_impl::~dvb_bbheader_bb_impl() {}
 void dvb_bbheader_bb_impl::forecast(int noutput_items,
                                     gr_vector_int& ninput_items_required)
 {
+    const int noutput_bits = packed ? noutput_items * 8 : noutput_items;
     if (input_mode == INPUTMODE_NORMAL) {
         if (frame_size != FECFRAME_MEDIUM) {
-            ninput_items_required[0] = ((noutput_items - 80) / 8);
+            ninput_items_required[0] = ((noutput_bits - 80) / 8);
         } else {
-            ninput_items_required[0] = ((noutput_items - 160) / 8);
+            ninput_items_required[0] = ((noutput_bits - 160) / 8);
         }
     } else {
-        ninput_items_required[0] = ((noutput_items - 80) / 8) + extra;
+        ninput_items_required[0] = ((noutput_bits - 80) / 8) + extra;
     }
 }
 
@@ -467,13 +477,16 @@ int dvb_bbheader_bb_impl::general_work(int noutput_items,
                                        gr_vector_void_star& output_items)
 {
     const unsigned char* in = (const unsigned char*)input_items[0];
-    unsigned char* out = (unsigned char*)output_items[0];
+    unsigned char* out_items = (unsigned char*)output_items[0];
     int consumed = 0;
-    int offset = 0;
+    int offset;
     int padding;
     unsigned char b;
 
-    for (int i = 0; i < noutput_items; i += kbch) {
+    for (int i = 0; i < noutput_items; i += frame_items) {
+        // Packed frames are built a bit per byte and packed at the end.
+        unsigned char* out = packed ? frame_bits : &out_items[i];
+        offset = 0;
         if (frame_size != FECFRAME_MEDIUM) {
             if (fec_block == 0 && inband_type_b == TRUE) {
                 padding = 104;
@@ -563,6 +576,15 @@ int dvb_bbheader_bb_impl::general_work(int noutput_items,
                 }
             }
         }
+        if (packed) {
+            for (unsigned int j = 0; j < frame_items; j++) {
+                b = 0;
+                for (int n = 0; n < 8; n++) {
+                    b |= frame_bits[j * 8 + n] << (7 - n);
+                }
+                out_items[i + j] = b;
+            }
+        }
     }
 
     // Tell runtime system how many input items we consumed on
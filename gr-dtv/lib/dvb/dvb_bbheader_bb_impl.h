@@ -50,6 +50,9 @@ private:
     bool dvbs2x;
     bool alternate;
     bool nibble;
+    bool packed;
+    unsigned int frame_items;
+    unsigned char frame_bits[FRAME_SIZE_NORMAL]; // frame before packing
     FrameFormat m_format[1];
     unsigned char crc_tab[256];
     void add_bbheader(unsigned char*, int, int, bool);
@@ -65,7 +68,8 @@ public:
                          dvbt2_inputmode_t mode,
                          dvbt2_inband_t inband,
                          int fecblocks,
-                         int tsrate);
+                         int tsrate,
+                         dvb_bitformat_t bitformat);
     ~dvb_bbheader_bb_impl() override;
 
     void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
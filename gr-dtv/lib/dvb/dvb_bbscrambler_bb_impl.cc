@@ -12,15 +12,18 @@
 
 #include "dvb_bbscrambler_bb_impl.h"
 #include <gnuradio/io_signature.h>
+#include <stdexcept>
 
 namespace gr {
 namespace dtv {
 
 dvb_bbscrambler_bb::sptr dvb_bbscrambler_bb::make(dvb_standard_t standard,
                                                   dvb_framesize_t framesize,
-                                                  dvb_code_rate_t rate)
+                                                  dvb_code_rate_t rate,
+                                                  dvb_bitformat_t bitformat)
 {
-    return gnuradio::make_block_sptr<dvb_bbscrambler_bb_impl>(standard, framesize, rate);
+    return gnuradio::make_block_sptr<dvb_bbscrambler_bb_impl>(
+        standard, framesize, rate, bitformat);
 }
 
 /*
@@ -28,11 +31,17 @@ dvb_bbscrambler_bb::sptr dvb_bbscrambler_bb::make(dvb_standard_t standard,
  */
 dvb_bbscrambler_bb_impl::dvb_bbscrambler_bb_impl(dvb_standard_t standard,
                                                  dvb_framesize_t framesize,
-                                                 dvb_code_rate_t rate)
+                                                 dvb_code_rate_t rate,
+                                                 dvb_bitformat_t bitformat)
     : gr::sync_block("dvb_bbscrambler_bb",
                      gr::io_signature::make(1, 1, sizeof(unsigned char)),
-                     gr::io_signature::make(1, 1, sizeof(unsigned char)))
+                     gr::io_signature::make(1, 1, sizeof(unsigned char))),
+      packed(bitformat == BITFORMAT_PACKED)
 {
+    if (packed && framesize == FECFRAME_MEDIUM) {
+        throw std::invalid_argument(
+            "dvb_bbscrambler_bb: packed bits are not supported for medium frames");
+    }
     if (framesize == FECFRAME_NORMAL) {
         switch (rate) {
         case C1_4:
@@ -235,7 +244,7 @@ dvb_bbscrambler_bb_impl::dvb_bbscrambler_bb_impl(dvb_standard_t standard,
 
     init_bb_randomiser();
     frame_size = framesize;
-    set_output_multiple(kbch);
+    set_output_multiple(packed ? kbch / 8 : kbch);
 }
 
 /*
@@ -256,6 +265,13 @@ void dvb_bbscrambler_bb_impl::init_bb_randomiser(void)
     }
     bb_randomize32 = (uint32_t*)&bb_randomise[0];
     bb_randomize64 = (uint64_t*)&bb_randomise[0];
+    for (int i = 0; i < FRAME_SIZE_NORMAL / 8; i++) {
+        unsigned char b = 0;
+        for (int n = 0; n < 8; n++) {
+            b |= bb_randomise[i * 8 + n] << (7 - n);
+        }
+        bb_randomise_packed[i] = b;
+    }
 }
 
 int dvb_bbscrambler_bb_impl::work(int noutput_items,
@@ -267,7 +283,15 @@ int dvb_bbscrambler_bb_impl::work(int noutput_items,
     const uint32_t* inm = (const uint32_t*)input_items[0];
     uint32_t* outm = (uint32_t*)output_items[0];
 
-    if (frame_size != FECFRAME_MEDIUM) {
+    if (packed) {
+        const unsigned char* inp = (const unsigned char*)input_items[0];
+        unsigned char* outp = (unsigned char*)output_items[0];
+        for (int i = 0; i < noutput_items; i += kbch / 8) {
+            for (int j = 0; j < kbch / 8; ++j) {
+                *outp++ = *inp++ ^ bb_randomise_packed[j];
+            }
+        }
+    } else if (frame_size != FECFRAME_MEDIUM) {
         for (int i = 0; i < noutput_items; i += kbch) {
             for (int j = 0; j < kbch / 8; ++j) {
                 *out++ = *in++ ^ bb_randomize64[j];
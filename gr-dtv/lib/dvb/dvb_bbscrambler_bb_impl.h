@@ -20,7 +20,9 @@ class dvb_bbscrambler_bb_impl : public dvb_bbscrambler_bb
 private:
     int kbch;
     int frame_size;
+    bool packed;
     __GR_ATTR_ALIGNED(8) unsigned char bb_randomise[FRAME_SIZE_NORMAL];
+    unsigned char bb_randomise_packed[FRAME_SIZE_NORMAL / 8];
     uint32_t* bb_randomize32;
     uint64_t* bb_randomize64;
     void init_bb_randomiser(void);
@@ -28,7 +30,8 @@ private:
 public:
     dvb_bbscrambler_bb_impl(dvb_standard_t standard,
                             dvb_framesize_t framesize,
-                            dvb_code_rate_t rate);
+                            dvb_code_rate_t rate,
+                            dvb_bitformat_t bitformat);
     ~dvb_bbscrambler_bb_impl() override;
 
     int work(int noutput_items,
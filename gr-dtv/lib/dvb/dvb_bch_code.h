@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2015,2016 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_DTV_DVB_BCH_CODE_H
+#define INCLUDED_DTV_DVB_BCH_CODE_H
+
+#include "dvb_defines.h"
+#include <gnuradio/dtv/dvb_config.h>
+#include <bitset>
+#include <cstdint>
+
+#define MAX_BCH_PARITY_BITS 192
+
+namespace gr {
+namespace dtv {
+
+/*!
+ * \brief Parameters and generator polynomial of the DVB-S2, DVB-S2X and
+ * DVB-T2 BCH codes, shared by the BCH encoder and decoder.
+ *
+ * crc_table (crc_medium_table for medium frames) divides by the
+ * generator polynomial 8 (4) bits at a time; polynome holds its
+ * coefficients except the leading one. word_crc_table is crc_table with
+ * the remainder moved to the top of three 64-bit words, most significant
+ * word first, for dividing packed bytes.
+ */
+class dvb_bch_code
+{
+public:
+    unsigned int kbch;
+    unsigned int nbch;
+    unsigned int bch_code;
+    unsigned int frame_size;
+
+    std::bitset<MAX_BCH_PARITY_BITS> crc_table[256];
+    std::bitset<MAX_BCH_PARITY_BITS> crc_medium_table[16];
+    unsigned int num_parity_bits;
+    std::bitset<MAX_BCH_PARITY_BITS> polynome;
+    uint64_t word_crc_table[256][3];
+
+    dvb_bch_code(dvb_standard_t standard,
+                 dvb_framesize_t framesize,
+                 dvb_code_rate_t rate);
+
+    /*!
+     * Remainder of the kbch packed information bits (8 per byte, most
+     * significant first) divided by the generator polynomial, written
+     * as num_parity_bits / 8 bytes, highest order coefficient first.
+     * Not usable for medium frames, whose kbch is not a multiple of 8.
+     */
+    void packed_parity(const unsigned char* in, unsigned char* parity) const;
+
+private:
+    void calculate_crc_table();
+    void calculate_medium_crc_table();
+    void calculate_word_crc_table();
+    int poly_mult(const int*, int, const int*, int, int*);
+    void bch_poly_build_tables(void);
+};
+
+} // namespace dtv
+} // namespace gr
+
+#endif /* INCLUDED_DTV_DVB_BCH_CODE_H */
@@ -0,0 +1,246 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "dvb_bch_decoder_bb_impl.h"
+#include <gnuradio/io_signature.h>
+#include <cstring>
+
+namespace gr {
+namespace dtv {
+
+dvb_bch_decoder_bb::sptr dvb_bch_decoder_bb::make(dvb_standard_t standard,
+                                                  dvb_framesize_t framesize,
+                                                  dvb_code_rate_t rate)
+{
+    return gnuradio::make_block_sptr<dvb_bch_decoder_bb_impl>(standard, framesize, rate);
+}
+
+/*
+ * The private constructor
+ */
+dvb_bch_decoder_bb_impl::dvb_bch_decoder_bb_impl(dvb_standard_t standard,
+                                                 dvb_framesize_t framesize,
+                                                 dvb_code_rate_t rate)
+    : gr::block("dvb_bch_decoder_bb",
+                gr::io_signature::make(1, 1, sizeof(unsigned char)),
+                gr::io_signature::make(1, 1, sizeof(unsigned char))),
+      dvb_bch_code(standard, framesize, rate),
+      d_bad_frame_count(0),
+      d_total_frames(0)
+{
+    unsigned int m, primitive;
+
+    // The first factor of each generator polynomial is the primitive
+    // polynomial of the Galois field the code is defined over.
+    switch (bch_code) {
+    case BCH_CODE_N8:
+        t = 8;
+        break;
+    case BCH_CODE_N10:
+        t = 10;
+        break;
+    default:
+        t = 12;
+        break;
+    }
+    if (frame_size == FECFRAME_NORMAL) {
+        m = 16;
+        primitive = 0x1002d; // 1 + x^2 + x^3 + x^5 + x^16
+    } else if (frame_size == FECFRAME_MEDIUM) {
+        m = 15;
+        primitive = 0x802d; // 1 + x^2 + x^3 + x^5 + x^15
+    } else {
+        m = 14;
+        primitive = 0x402b; // 1 + x + x^3 + x^5 + x^14
+    }
+
+    gf_n = (1 << m) - 1;
+    gf_exp.resize(2 * gf_n);
+    gf_log.resize(gf_n + 1);
+    unsigned int x = 1;
+    for (unsigned int i = 0; i < gf_n; i++) {
+        gf_exp[i] = gf_exp[i + gf_n] = x;
+        gf_log[x] = i;
+        x <<= 1;
+        if (x & (1 << m)) {
+            x ^= primitive;
+        }
+    }
+
+    set_output_multiple(kbch);
+}
+
+/*
+ * Our virtual destructor.
+ */
+dvb_bch_decoder_bb_impl::~dvb_bch_decoder_bb_impl() {}
+
+void dvb_bch_decoder_bb_impl::forecast(int noutput_items,
+                                       gr_vector_int& ninput_items_required)
+{
+    ninput_items_required[0] = (noutput_items / kbch) * nbch;
+}
+
+/*
+ * Remainder of the received code word divided by the generator
+ * polynomial: the parity of the received information bits, calculated
+ * as in the encoder, plus the received parity. Bit n is the
+ * coefficient of x^n.
+ */
+std::bitset<MAX_BCH_PARITY_BITS>
+dvb_bch_decoder_bb_impl::remainder(const unsigned char* in)
+{
+    std::bitset<MAX_BCH_PARITY_BITS> parity_bits;
+    const unsigned int width = frame_size != FECFRAME_MEDIUM ? 8 : 4;
+    const std::bitset<MAX_BCH_PARITY_BITS>* table =
+        frame_size != FECFRAME_MEDIUM ? crc_table : crc_medium_table;
+
+    for (unsigned int j = 0; j < kbch / width; j++) {
+        unsigned char b = 0;
+        for (unsigned int e = 0; e < width; e++) {
+            b |= *in++ << (width - 1 - e);
+        }
+
+        unsigned char msb = 0;
+        for (unsigned int n = 1; n <= width; n++) {
+            msb |= parity_bits[num_parity_bits - n] << (width - n);
+        }
+        parity_bits = (parity_bits << width) ^ table[msb ^ b];
+    }
+
+    for (unsigned int n = 0; n < num_parity_bits; n++) {
+        parity_bits[num_parity_bits - 1 - n] =
+            parity_bits[num_parity_bits - 1 - n] ^ (*in++ & 1);
+    }
+    return parity_bits;
+}
+
+/*
+ * Corrects the information bits in out from the remainder of a
+ * received code word. The first bit of the frame is the coefficient
+ * of x^(nbch - 1). Returns false if the errors are not correctable.
+ */
+bool dvb_bch_decoder_bb_impl::correct(const std::bitset<MAX_BCH_PARITY_BITS>& rem,
+                                      unsigned char* out)
+{
+    // Syndromes S_i = r(alpha^i) = rem(alpha^i), i = 1 .. 2t
+    int syndrome[2 * 12 + 1] = { 0 };
+    for (unsigned int n = 0; n < num_parity_bits; n++) {
+        if (rem[n]) {
+            for (unsigned int i = 1; i <= 2 * t; i++) {
+                syndrome[i] ^= gf_exp[(i * n) % gf_n];
+            }
+        }
+    }
+
+    // Berlekamp-Massey, error locator polynomial in lambda
+    int lambda[2 * 12 + 2] = { 1 };
+    int prev[2 * 12 + 2] = { 1 };
+    int temp[2 * 12 + 2];
+    unsigned int degree = 0, shift = 1;
+    int prev_discrepancy = 1;
+    for (unsigned int k = 0; k < 2 * t; k++) {
+        int discrepancy = syndrome[k + 1];
+        for (unsigned int i = 1; i <= degree; i++) {
+            if (lambda[i] && syndrome[k + 1 - i]) {
+                discrepancy ^=
+                    gf_exp[gf_log[lambda[i]] + gf_log[syndrome[k + 1 - i]]];
+            }
+        }
+        if (discrepancy == 0) {
+            shift++;
+            continue;
+        }
+        const int scale = gf_log[discrepancy] + gf_n - gf_log[prev_discrepancy];
+        memcpy(temp, lambda, sizeof(lambda));
+        for (unsigned int i = 0; i + shift < 2 * t + 2; i++) {
+            if (prev[i]) {
+                lambda[i + shift] ^= gf_exp[(gf_log[prev[i]] + scale) % gf_n];
+            }
+        }
+        if (2 * degree <= k) {
+            degree = k + 1 - degree;
+            memcpy(prev, temp, sizeof(prev));
+            prev_discrepancy = discrepancy;
+            shift = 1;
+        } else {
+            shift++;
+        }
+    }
+    if (degree > t) {
+        return false;
+    }
+
+    // Chien search over the code word positions, term i holds
+    // lambda_i * alpha^(-i * power) in log form.
+    int term[12 + 1];
+    for (unsigned int i = 1; i <= degree; i++) {
+        term[i] = lambda[i] ? (int)gf_log[lambda[i]] : -1;
+    }
+    unsigned int found = 0;
+    unsigned int errors[12];
+    for (unsigned int power = 0; power < nbch && found < degree; power++) {
+        int sum = 1;
+        for (unsigned int i = 1; i <= degree; i++) {
+            if (term[i] >= 0) {
+                sum ^= gf_exp[term[i]];
+                term[i] = (term[i] + gf_n - i) % gf_n;
+            }
+        }
+        if (sum == 0) {
+            errors[found++] = nbch - 1 - power;
+        }
+    }
+    if (found != degree) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < found; i++) {
+        if (errors[i] < kbch) {
+            out[errors[i]] ^= 1;
+        }
+    }
+    return true;
+}
+
+int dvb_bch_decoder_bb_impl::general_work(int noutput_items,
+                                          gr_vector_int& ninput_items,
+                                          gr_vector_const_void_star& input_items,
+                                          gr_vector_void_star& output_items)
+{
+    const unsigned char* in = (const unsigned char*)input_items[0];
+    unsigned char* out = (unsigned char*)output_items[0];
+    int consumed = 0;
+
+    for (int i = 0; i < noutput_items; i += kbch) {
+        memcpy(out, in, sizeof(unsigned char) * kbch);
+        const std::bitset<MAX_BCH_PARITY_BITS> rem = remainder(in);
+        if (rem.any() && !correct(rem, out)) {
+            d_bad_frame_count++;
+            d_logger->debug("Uncorrectable frame {:d}", d_total_frames);
+        }
+        d_total_frames++;
+        in += nbch;
+        out += kbch;
+        consumed += nbch;
+    }
+
+    // Tell runtime system how many input items we consumed on
+    // each input stream.
+    consume_each(consumed);
+
+    // Tell runtime system how many output items we produced.
+    return noutput_items;
+}
+
+} /* namespace dtv */
+} /* namespace gr */
@@ -0,0 +1,53 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_DTV_DVB_BCH_DECODER_BB_IMPL_H
+#define INCLUDED_DTV_DVB_BCH_DECODER_BB_IMPL_H
+
+#include "dvb_bch_code.h"
+#include "dvb_defines.h"
+#include <gnuradio/dtv/dvb_bch_decoder_bb.h>
+#include <vector>
+
+namespace gr {
+namespace dtv {
+
+class dvb_bch_decoder_bb_impl : public dvb_bch_decoder_bb, private dvb_bch_code
+{
+private:
+    unsigned int t;          // correctable errors
+    unsigned int gf_n;       // 2^m - 1
+    std::vector<int> gf_exp; // alpha^i, i = 0 .. 2 * gf_n - 1
+    std::vector<int> gf_log; // log_alpha(x), gf_log[0] unused
+    int d_bad_frame_count;
+    int d_total_frames;
+
+    std::bitset<MAX_BCH_PARITY_BITS> remainder(const unsigned char* in);
+    bool correct(const std::bitset<MAX_BCH_PARITY_BITS>& rem, unsigned char* out);
+
+public:
+    dvb_bch_decoder_bb_impl(dvb_standard_t standard,
+                            dvb_framesize_t framesize,
+                            dvb_code_rate_t rate);
+    ~dvb_bch_decoder_bb_impl() override;
+
+    int num_bad_frames() const override { return d_bad_frame_count; }
+    int num_frames() const override { return d_total_frames; }
+
+    void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
+
+    int general_work(int noutput_items,
+                     gr_vector_int& ninput_items,
+                     gr_vector_const_void_star& input_items,
+                     gr_vector_void_star& output_items) override;
+};
+
+} // namespace dtv
+} // namespace gr
+
+#endif /* INCLUDED_DTV_DVB_BCH_DECODER_BB_IMPL_H */
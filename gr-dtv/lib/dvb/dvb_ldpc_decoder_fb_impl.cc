@@ -0,0 +1,321 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "dvb_ldpc_decoder_fb_impl.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace dtv {
+
+namespace {
+// Frames decoded side by side.
+constexpr unsigned int MAX_BATCH = 4;
+// Input LLR quantization, in steps per unit.
+constexpr float LLR_SCALE = 8.0f;
+constexpr int MSG_MAX = 127;
+// A-posteriori value of the known zero bits added by shortening.
+constexpr int16_t LLR_KNOWN = 16000;
+
+inline int16_t sat16(int v)
+{
+    return (int16_t)std::min(std::max(v, -32767), 32767);
+}
+
+inline int8_t sat8(int v) { return (int8_t)std::min(std::max(v, -MSG_MAX), MSG_MAX); }
+} // namespace
+
+dvb_ldpc_decoder_fb::sptr dvb_ldpc_decoder_fb::make(dvb_standard_t standard,
+                                                    dvb_framesize_t framesize,
+                                                    dvb_code_rate_t rate,
+                                                    dvb_constellation_t constellation,
+                                                    int max_iterations)
+{
+    return gnuradio::make_block_sptr<dvb_ldpc_decoder_fb_impl>(
+        standard, framesize, rate, constellation, max_iterations);
+}
+
+/*
+ * The private constructor
+ */
+dvb_ldpc_decoder_fb_impl::dvb_ldpc_decoder_fb_impl(dvb_standard_t standard,
+                                                   dvb_framesize_t framesize,
+                                                   dvb_code_rate_t rate,
+                                                   dvb_constellation_t constellation,
+                                                   int max_iterations)
+    : gr::block("dvb_ldpc_decoder_fb",
+                gr::io_signature::make(1, 1, sizeof(float)),
+                gr::io_signature::make(1, 1, sizeof(unsigned char))),
+      dvb_ldpc_code(standard, framesize, rate, constellation),
+      max_iterations(max_iterations)
+{
+    if (max_iterations < 1) {
+        throw std::invalid_argument("dvb_ldpc_decoder_fb: max_iterations must be > 0");
+    }
+    pbits = (frame_size_real + Xp) - nbch;
+    if (pbits != 360 * q_val || (nbch + Xs) % 360 != 0) {
+        throw std::runtime_error(
+            "dvb_ldpc_decoder_fb: code is not quasi-cyclic with 360 columns per group");
+    }
+    info_groups = (nbch + Xs) / 360;
+
+    /*
+     * Parity bit c = r + q * j is check j of layer r. Info bit n of
+     * group g takes part in check ((e / q + n) % 360) of layer e % q for
+     * every table entry e of row g, so the info edges of layer r can be
+     * read from the first 360 bits of the row, that is from ldpc_lut[r].
+     * Parity bits are stored the same way, column group info_groups + r
+     * holding the checks of layer r.
+     */
+    max_layer_degree = 0;
+    layer_offsets.push_back(0);
+    for (unsigned int r = 0; r < q_val; r++) {
+        for (unsigned int i = 1; i < ldpc_lut[r][0]; i++) {
+            const unsigned int im = ldpc_lut[r][i];
+            edges.push_back({ im / 360, im % 360, false });
+        }
+        edges.push_back({ info_groups + r, 0, false });
+        if (r > 0) {
+            edges.push_back({ info_groups + r - 1, 0, false });
+        } else {
+            edges.push_back({ info_groups + q_val - 1, 359, true });
+        }
+        layer_offsets.push_back(edges.size());
+        max_layer_degree = std::max(max_layer_degree,
+                                    layer_offsets[r + 1] - layer_offsets[r]);
+    }
+
+    llr.resize((size_t)(info_groups + q_val) * 360 * MAX_BATCH);
+    msg.resize(edges.size() * 360 * MAX_BATCH);
+    q.resize((size_t)max_layer_degree * 360 * MAX_BATCH);
+    min1.resize(360 * MAX_BATCH);
+    min2.resize(360 * MAX_BATCH);
+    sign.resize(360 * MAX_BATCH);
+    failed.resize(MAX_BATCH);
+
+    set_output_multiple(nbch);
+}
+
+/*
+ * Our virtual destructor.
+ */
+dvb_ldpc_decoder_fb_impl::~dvb_ldpc_decoder_fb_impl() {}
+
+void dvb_ldpc_decoder_fb_impl::forecast(int noutput_items,
+                                        gr_vector_int& ninput_items_required)
+{
+    ninput_items_required[0] = (noutput_items / nbch) * frame_size;
+}
+
+inline int16_t&
+dvb_ldpc_decoder_fb_impl::bit(unsigned int index, unsigned int f, unsigned int batch)
+{
+    return llr[(size_t)index * batch + f];
+}
+
+void dvb_ldpc_decoder_fb_impl::load_frame(const float* in,
+                                          unsigned int f,
+                                          unsigned int batch)
+{
+    for (int i = 0; i < Xs; i++) {
+        bit(i, f, batch) = LLR_KNOWN;
+    }
+    for (unsigned int i = 0; i < nbch; i++) {
+        bit(Xs + i, f, batch) = sat8((int)(in[i] * LLR_SCALE));
+    }
+    const float* p = &in[nbch];
+    int punctured = 0;
+    for (unsigned int c = 0; c < pbits; c++) {
+        const unsigned int index = (info_groups + c % q_val) * 360 + c / q_val;
+        if (P != 0 && punctured < Xp && c % P == 0) {
+            bit(index, f, batch) = 0;
+            punctured++;
+        } else {
+            bit(index, f, batch) = sat8((int)(*p++ * LLR_SCALE));
+        }
+    }
+}
+
+void dvb_ldpc_decoder_fb_impl::store_frame(unsigned char* out,
+                                           unsigned int f,
+                                           unsigned int batch)
+{
+    for (unsigned int i = 0; i < nbch; i++) {
+        out[i] = bit(Xs + i, f, batch) < 0;
+    }
+}
+
+void dvb_ldpc_decoder_fb_impl::check_frames(unsigned int batch)
+{
+    const unsigned int n = 360 * batch;
+    uint8_t* parity = sign.data();
+
+    std::fill(failed.begin(), failed.end(), 0);
+    for (unsigned int r = 0; r < q_val; r++) {
+        std::fill(parity, parity + n, 0);
+        for (unsigned int e = layer_offsets[r]; e < layer_offsets[r + 1]; e++) {
+            const qc_edge& edge = edges[e];
+            const int16_t* base = &llr[(size_t)edge.group * n];
+            const int16_t* rotated = base + edge.offset * batch;
+            const unsigned int split = (360 - edge.offset) * batch;
+            const unsigned int first = edge.open_first ? batch : 0;
+            for (unsigned int k = first; k < split; k++) {
+                parity[k] ^= rotated[k] < 0;
+            }
+            uint8_t* wrapped = parity + split;
+            for (unsigned int k = 0; k < n - split; k++) {
+                wrapped[k] ^= base[k] < 0;
+            }
+        }
+        for (unsigned int k = 0; k < n; k++) {
+            failed[k % batch] |= parity[k];
+        }
+    }
+}
+
+/*
+ * Normalized min-sum update of the 360 checks of one layer, for all
+ * frames of the batch. Each loop runs over 360 * batch consecutive
+ * values, rotated into check order in two contiguous pieces.
+ */
+void dvb_ldpc_decoder_fb_impl::update_layer(unsigned int layer, unsigned int batch)
+{
+    const unsigned int n = 360 * batch;
+    const unsigned int first_edge = layer_offsets[layer];
+    const unsigned int degree = layer_offsets[layer + 1] - first_edge;
+    int8_t* m1 = min1.data();
+    int8_t* m2 = min2.data();
+    uint8_t* s = sign.data();
+
+    std::fill(m1, m1 + n, MSG_MAX);
+    std::fill(m2, m2 + n, MSG_MAX);
+    std::fill(s, s + n, 0);
+
+    for (unsigned int d = 0; d < degree; d++) {
+        const qc_edge& edge = edges[first_edge + d];
+        const int16_t* base = &llr[(size_t)edge.group * n];
+        const int8_t* r = &msg[(size_t)(first_edge + d) * n];
+        int8_t* qd = &q[(size_t)d * n];
+        const int16_t* rotated = base + edge.offset * batch;
+        const unsigned int split = (360 - edge.offset) * batch;
+        const unsigned int first = edge.open_first ? batch : 0;
+
+        for (unsigned int k = 0; k < first; k++) {
+            qd[k] = MSG_MAX;
+        }
+        for (unsigned int k = first; k < split; k++) {
+            qd[k] = sat8(rotated[k] - r[k]);
+        }
+        int8_t* q_wrapped = qd + split;
+        const int8_t* r_wrapped = r + split;
+        for (unsigned int k = 0; k < n - split; k++) {
+            q_wrapped[k] = sat8(base[k] - r_wrapped[k]);
+        }
+        for (unsigned int k = 0; k < n; k++) {
+            const int8_t mag = (int8_t)std::abs(qd[k]);
+            s[k] ^= qd[k] < 0;
+            m2[k] = std::min(m2[k], std::max(m1[k], mag));
+            m1[k] = std::min(m1[k], mag);
+        }
+    }
+
+    for (unsigned int d = 0; d < degree; d++) {
+        const qc_edge& edge = edges[first_edge + d];
+        int16_t* base = &llr[(size_t)edge.group * n];
+        int8_t* r = &msg[(size_t)(first_edge + d) * n];
+        const int8_t* qd = &q[(size_t)d * n];
+        const unsigned int split = (360 - edge.offset) * batch;
+        const unsigned int first = edge.open_first ? batch : 0;
+
+        // Delta update, a group may appear more than once per layer.
+        auto update = [&](int16_t* l, unsigned int begin, unsigned int end) {
+            const int8_t* qk = qd + begin;
+            const int8_t* m1k = m1 + begin;
+            const int8_t* m2k = m2 + begin;
+            const uint8_t* sk = s + begin;
+            int8_t* rk = r + begin;
+            for (unsigned int k = 0; k < end - begin; k++) {
+                const int8_t mag = (int8_t)std::abs(qk[k]);
+                const int scaled = ((mag == m1k[k] ? m2k[k] : m1k[k]) * 12) >> 4;
+                const int8_t r_new = (sk[k] ^ (qk[k] < 0)) ? -scaled : scaled;
+                l[k] = sat16(l[k] + r_new - rk[k]);
+                rk[k] = r_new;
+            }
+        };
+        update(base + edge.offset * batch + first, first, split);
+        update(base, split, n);
+    }
+}
+
+void dvb_ldpc_decoder_fb_impl::decode_batch(const float* in,
+                                            unsigned char* out,
+                                            unsigned int batch)
+{
+    unsigned char done[MAX_BATCH] = {};
+    unsigned int remaining = batch;
+
+    for (unsigned int f = 0; f < batch; f++) {
+        load_frame(&in[f * frame_size], f, batch);
+    }
+    std::fill(msg.begin(), msg.begin() + edges.size() * 360 * batch, 0);
+
+    for (int iteration = 0;; iteration++) {
+        check_frames(batch);
+        for (unsigned int f = 0; f < batch; f++) {
+            if (!done[f] && !failed[f]) {
+                store_frame(&out[f * nbch], f, batch);
+                done[f] = 1;
+                remaining--;
+            }
+        }
+        if (remaining == 0 || iteration == max_iterations) {
+            break;
+        }
+        for (unsigned int r = 0; r < q_val; r++) {
+            update_layer(r, batch);
+        }
+    }
+
+    for (unsigned int f = 0; f < batch; f++) {
+        if (!done[f]) {
+            store_frame(&out[f * nbch], f, batch);
+        }
+    }
+}
+
+int dvb_ldpc_decoder_fb_impl::general_work(int noutput_items,
+                                           gr_vector_int& ninput_items,
+                                           gr_vector_const_void_star& input_items,
+                                           gr_vector_void_star& output_items)
+{
+    const float* in = (const float*)input_items[0];
+    unsigned char* out = (unsigned char*)output_items[0];
+    const unsigned int frames = noutput_items / nbch;
+
+    for (unsigned int i = 0; i < frames; i += MAX_BATCH) {
+        const unsigned int batch = std::min(MAX_BATCH, frames - i);
+        decode_batch(&in[i * frame_size], &out[i * nbch], batch);
+    }
+
+    // Tell runtime system how many input items we consumed on
+    // each input stream.
+    consume_each(frames * frame_size);
+
+    // Tell runtime system how many output items we produced.
+    return frames * nbch;
+}
+
+} /* namespace dtv */
+} /* namespace gr */
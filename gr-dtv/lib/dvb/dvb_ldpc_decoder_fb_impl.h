@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_DTV_DVB_LDPC_DECODER_FB_IMPL_H
+#define INCLUDED_DTV_DVB_LDPC_DECODER_FB_IMPL_H
+
+#include "dvb_defines.h"
+#include "dvb_ldpc_code.h"
+
+#include <gnuradio/dtv/dvb_ldpc_decoder_fb.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace dtv {
+
+class dvb_ldpc_decoder_fb_impl : public dvb_ldpc_decoder_fb, private dvb_ldpc_code
+{
+private:
+    /*
+     * One 360 x 360 block of the parity check matrix, permuted to
+     * quasi-cyclic form: check j of a layer is connected to bit
+     * (j + offset) % 360 of column group 'group'.
+     */
+    struct qc_edge {
+        unsigned int group;
+        unsigned int offset;
+        bool open_first; // check 0 of the layer has no bit on this edge
+    };
+
+    int max_iterations;
+    unsigned int pbits;
+    unsigned int info_groups;
+    std::vector<unsigned int> layer_offsets; // edges of layer r start at layer_offsets[r]
+    std::vector<qc_edge> edges;
+    unsigned int max_layer_degree;
+
+    // Working memory: bit j of column group g of frame f is at
+    // (g * 360 + j) * batch + f, check j of a layer at j * batch + f.
+    std::vector<int16_t> llr;       // a-posteriori values
+    std::vector<int8_t> msg;        // check to bit messages, 360 * batch per edge
+    std::vector<int8_t> q;          // bit to check messages of the current layer
+    std::vector<int8_t> min1, min2; // two smallest magnitudes per check
+    std::vector<uint8_t> sign;      // sign parity per check
+    std::vector<uint8_t> failed;    // per frame: some check is not satisfied
+
+    int16_t& bit(unsigned int index, unsigned int f, unsigned int batch);
+    void load_frame(const float* in, unsigned int f, unsigned int batch);
+    void store_frame(unsigned char* out, unsigned int f, unsigned int batch);
+    void check_frames(unsigned int batch);
+    void update_layer(unsigned int layer, unsigned int batch);
+    void decode_batch(const float* in, unsigned char* out, unsigned int batch);
+
+public:
+    dvb_ldpc_decoder_fb_impl(dvb_standard_t standard,
+                             dvb_framesize_t framesize,
+                             dvb_code_rate_t rate,
+                             dvb_constellation_t constellation,
+                             int max_iterations);
+    ~dvb_ldpc_decoder_fb_impl() override;
+
+    void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
+
+    int general_work(int noutput_items,
+                     gr_vector_int& ninput_items,
+                     gr_vector_const_void_star& input_items,
+                     gr_vector_void_star& output_items) override;
+};
+
+} // namespace dtv
+} // namespace gr
+
+#endif /* INCLUDED_DTV_DVB_LDPC_DECODER_FB_IMPL_H */
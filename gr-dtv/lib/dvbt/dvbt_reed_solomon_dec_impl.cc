@@ -17,9 +17,8 @@ namespace gr {
 namespace dtv {
 
 static const int rs_init_symsize = 8;
-static const int rs_init_fcr = 0;                // first consecutive root
-static const int rs_init_prim = 1;               // primitive is 1 (alpha)
-static const int N = (1 << rs_init_symsize) - 1; // 255
+static const int rs_init_fcr = 0;  // first consecutive root
+static const int rs_init_prim = 1; // primitive is 1 (alpha)
 
 dvbt_reed_solomon_dec::sptr dvbt_reed_solomon_dec::make(
     int p, int m, int gfpoly, int n, int k, int t, int s, int blocks)
@@ -62,24 +61,6 @@ void dvbt_reed_solomon_dec_impl::forecast(int noutput_items,
     ninput_items_required[0] = noutput_items;
 }
 
-int dvbt_reed_solomon_dec_impl::decode(unsigned char& out, const unsigned char& in)
-{
-    unsigned char tmp[N];
-    int ncorrections;
-
-    // add missing prefix zero padding to message
-    memset(tmp, 0, d_s);
-    memcpy(&tmp[d_s], &in, (d_n - d_s));
-
-    // correct message...
-    ncorrections = decode_rs_char(d_rs, tmp, 0, 0);
-
-    // copy corrected message to output, skipping prefix zero padding
-    memcpy(&out, &tmp[d_s], (d_k - d_s));
-
-    return ncorrections;
-}
-
 int dvbt_reed_solomon_dec_impl::general_work(int noutput_items,
                                              gr_vector_int& ninput_items,
                                              gr_vector_const_void_star& input_items,
@@ -87,11 +68,20 @@ int dvbt_reed_solomon_dec_impl::general_work(int noutput_items,
 {
     const unsigned char* in = (const unsigned char*)input_items[0];
     unsigned char* out = (unsigned char*)output_items[0];
-    int j = 0;
-    int k = 0;
+    const int len = d_n - d_s;
+    const int count = d_blocks * noutput_items;
+
+    // The shortened codewords are decoded in place, the prefix zero
+    // padding is implied. Error free codewords only cost a syndrome check.
+    d_codewords.assign(in, in + count * len);
+    d_results.resize(count);
+    decode_rs_char_batch(d_rs, d_codewords.data(), len, count, d_results.data());
+
+    for (int i = 0; i < count; i++) {
+        int nerrors_corrected = d_results[i];
 
-    for (int i = 0; i < (d_blocks * noutput_items); i++) {
-        int nerrors_corrected = decode(out[k], in[j]);
+        // copy corrected message to output
+        memcpy(&out[i * (d_k - d_s)], &d_codewords[i * len], (d_k - d_s));
 
         if (nerrors_corrected == -1) {
             d_bad_packet_count++;
@@ -102,8 +92,6 @@ int dvbt_reed_solomon_dec_impl::general_work(int noutput_items,
         }
 
         d_total_packets++;
-        j += (d_n - d_s);
-        k += (d_k - d_s);
     }
 
     // Tell runtime system how many input items we consumed on
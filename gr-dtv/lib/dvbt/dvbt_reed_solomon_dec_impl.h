@@ -14,6 +14,7 @@
 extern "C" {
 #include <gnuradio/fec/rs.h>
 }
+#include <vector>
 
 namespace gr {
 namespace dtv {
@@ -31,7 +32,8 @@ private:
     int d_total_packets;
 
     void* d_rs; /* Reed-Solomon characteristics structure */
-    int decode(unsigned char& out, const unsigned char& in);
+    std::vector<unsigned char> d_codewords;
+    std::vector<int> d_results;
 
 public:
     dvbt_reed_solomon_dec_impl(
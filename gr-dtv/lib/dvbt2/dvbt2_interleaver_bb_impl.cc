@@ -18,10 +18,11 @@ namespace dtv {
 
 dvbt2_interleaver_bb::sptr dvbt2_interleaver_bb::make(dvb_framesize_t framesize,
                                                       dvb_code_rate_t rate,
-                                                      dvb_constellation_t constellation)
+                                                      dvb_constellation_t constellation,
+                                                      dvb_bitformat_t bitformat)
 {
     return gnuradio::make_block_sptr<dvbt2_interleaver_bb_impl>(
-        framesize, rate, constellation);
+        framesize, rate, constellation, bitformat);
 }
 
 /*
@@ -29,10 +30,12 @@ dvbt2_interleaver_bb::sptr dvbt2_interleaver_bb::make(dvb_framesize_t framesize,
  */
 dvbt2_interleaver_bb_impl::dvbt2_interleaver_bb_impl(dvb_framesize_t framesize,
                                                      dvb_code_rate_t rate,
-                                                     dvb_constellation_t constellation)
+                                                     dvb_constellation_t constellation,
+                                                     dvb_bitformat_t bitformat)
     : gr::block("dvbt2_interleaver_bb",
                 gr::io_signature::make(1, 1, sizeof(unsigned char)),
-                gr::io_signature::make(1, 1, sizeof(unsigned char)))
+                gr::io_signature::make(1, 1, sizeof(unsigned char))),
+      packed_input(bitformat == BITFORMAT_PACKED)
 {
     signal_constellation = constellation;
     code_rate = rate;
@@ -347,7 +350,11 @@ dvbt2_interleaver_bb_impl::~dvbt2_interleaver_bb_impl() {}
 void dvbt2_interleaver_bb_impl::forecast(int noutput_items,
                                          gr_vector_int& ninput_items_required)
 {
-    ninput_items_required[0] = noutput_items * mod;
+    if (packed_input) {
+        ninput_items_required[0] = noutput_items * mod / 8;
+    } else {
+        ninput_items_required[0] = noutput_items * mod;
+    }
 }
 
 int dvbt2_interleaver_bb_impl::general_work(int noutput_items,
@@ -360,6 +367,20 @@ int dvbt2_interleaver_bb_impl::general_work(int noutput_items,
     int consumed = 0;
     int produced = 0;
     int rows, offset, index, packed;
+
+    if (packed_input) {
+        // The interleaver reads its input in permuted order, so unpack
+        // the frames of this call up front.
+        const int bits = (noutput_items / packed_items) * frame_size;
+        unpacked.resize(bits);
+        for (int i = 0; i < bits / 8; i++) {
+            const unsigned char b = in[i];
+            for (int n = 0; n < 8; n++) {
+                unpacked[i * 8 + n] = (b >> (7 - n)) & 1;
+            }
+        }
+        in = unpacked.data();
+    }
     unsigned int pack;
     const int* mux;
 
@@ -500,7 +521,7 @@ int dvbt2_interleaver_bb_impl::general_work(int noutput_items,
 
     // Tell runtime system how many input items we consumed on
     // each input stream.
-    consume_each(consumed);
+    consume_each(packed_input ? consumed / 8 : consumed);
 
     // Tell runtime system how many output items we produced.
     return noutput_items;
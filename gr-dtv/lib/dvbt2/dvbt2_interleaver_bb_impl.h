@@ -12,6 +12,7 @@
 #include "../dvb/dvb_defines.h"
 
 #include <gnuradio/dtv/dvbt2_interleaver_bb.h>
+#include <vector>
 
 namespace gr {
 namespace dtv {
@@ -26,6 +27,8 @@ private:
     int q_val;
     int mod;
     int packed_items;
+    bool packed_input;
+    std::vector<unsigned char> unpacked; // input frames of a call, one bit per byte
     unsigned char tempu[FRAME_SIZE_NORMAL];
     int lookup_table[FRAME_SIZE_NORMAL];
 
@@ -62,7 +65,8 @@ private:
 public:
     dvbt2_interleaver_bb_impl(dvb_framesize_t framesize,
                               dvb_code_rate_t rate,
-                              dvb_constellation_t constellation);
+                              dvb_constellation_t constellation,
+                              dvb_bitformat_t bitformat);
     ~dvbt2_interleaver_bb_impl() override;
 
     void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
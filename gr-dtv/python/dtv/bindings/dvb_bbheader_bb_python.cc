@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvb_bbheader_bb.h)                                         */
-/* BINDTOOL_HEADER_FILE_HASH(4cb7125c2672510bcdd0c4728fc080f0)                     */
+/* BINDTOOL_HEADER_FILE_HASH(e12ca44a1c4d7ee2b80b437dc645a602)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -47,6 +47,7 @@ void bind_dvb_bbheader_bb(py::module& m)
              py::arg("inband"),
              py::arg("fecblocks"),
              py::arg("tsrate"),
+             py::arg("bitformat") = ::gr::dtv::BITFORMAT_UNPACKED,
              D(dvb_bbheader_bb, make))
 
 
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvb_bbscrambler_bb.h)                                      */
-/* BINDTOOL_HEADER_FILE_HASH(784bda037d258851bd77e5ca4d797e16)                     */
+/* BINDTOOL_HEADER_FILE_HASH(74286cfc7db6355157c5ade35cddd795)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -44,6 +44,7 @@ void bind_dvb_bbscrambler_bb(py::module& m)
              py::arg("standard"),
              py::arg("framesize"),
              py::arg("rate"),
+             py::arg("bitformat") = ::gr::dtv::BITFORMAT_UNPACKED,
              D(dvb_bbscrambler_bb, make))
 
 
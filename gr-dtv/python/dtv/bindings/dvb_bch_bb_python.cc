@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvb_bch_bb.h)                                              */
-/* BINDTOOL_HEADER_FILE_HASH(fee883de5a12b6465fcdf77b20a77736)                     */
+/* BINDTOOL_HEADER_FILE_HASH(f88c8c2ff76d6df977e6040dc4dafd86)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,6 +40,7 @@ void bind_dvb_bch_bb(py::module& m)
              py::arg("standard"),
              py::arg("framesize"),
              py::arg("rate"),
+             py::arg("bitformat") = ::gr::dtv::BITFORMAT_UNPACKED,
              D(dvb_bch_bb, make))
 
 
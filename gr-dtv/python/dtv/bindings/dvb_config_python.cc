@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvb_config.h)                                              */
-/* BINDTOOL_HEADER_FILE_HASH(a51e9bda5f13b96d3d09d0347395379e)                     */
+/* BINDTOOL_HEADER_FILE_HASH(897f0eb7a771faeb88221813468385f0)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -124,6 +124,10 @@ void bind_dvb_config(py::module& m)
         .value("GI_19_128", ::gr::dtv::GI_19_128) // 5
         .value("GI_19_256", ::gr::dtv::GI_19_256) // 6
         .export_values();
+    py::enum_<::gr::dtv::dvb_bitformat_t>(m, "dvb_bitformat_t")
+        .value("BITFORMAT_UNPACKED", ::gr::dtv::BITFORMAT_UNPACKED) // 0
+        .value("BITFORMAT_PACKED", ::gr::dtv::BITFORMAT_PACKED)     // 1
+        .export_values();
 
     // This will allow enum values to be passed int values
     py::implicitly_convertible<int, gr::dtv::dvb_standard_t>();
@@ -131,4 +135,5 @@ void bind_dvb_config(py::module& m)
     py::implicitly_convertible<int, gr::dtv::dvb_framesize_t>();
     py::implicitly_convertible<int, gr::dtv::dvb_constellation_t>();
     py::implicitly_convertible<int, gr::dtv::dvb_guardinterval_t>();
+    py::implicitly_convertible<int, gr::dtv::dvb_bitformat_t>();
 }
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvb_ldpc_bb.h)                                             */
-/* BINDTOOL_HEADER_FILE_HASH(fa0d5ad2fdc5bd4b427bf728736ef87c)                     */
+/* BINDTOOL_HEADER_FILE_HASH(a97f611f1dd00e8e476249a29fe6700a)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -41,6 +41,7 @@ void bind_dvb_ldpc_bb(py::module& m)
              py::arg("framesize"),
              py::arg("rate"),
              py::arg("constellation"),
+             py::arg("bitformat") = ::gr::dtv::BITFORMAT_UNPACKED,
              D(dvb_ldpc_bb, make))
 
 
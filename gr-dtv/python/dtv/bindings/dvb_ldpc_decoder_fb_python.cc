@@ -0,0 +1,51 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(dvb_ldpc_decoder_fb.h)                                      */
+/* BINDTOOL_HEADER_FILE_HASH(f139a47647054224eeb2ee8b87aca7d3)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/dtv/dvb_ldpc_decoder_fb.h>
+// pydoc.h is automatically generated in the build directory
+#include <dvb_ldpc_decoder_fb_pydoc.h>
+
+void bind_dvb_ldpc_decoder_fb(py::module& m)
+{
+
+    using dvb_ldpc_decoder_fb = ::gr::dtv::dvb_ldpc_decoder_fb;
+
+
+    py::class_<dvb_ldpc_decoder_fb,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<dvb_ldpc_decoder_fb>>(m, "dvb_ldpc_decoder_fb", D(dvb_ldpc_decoder_fb))
+
+        .def(py::init(&dvb_ldpc_decoder_fb::make),
+             py::arg("standard"),
+             py::arg("framesize"),
+             py::arg("rate"),
+             py::arg("constellation"),
+             py::arg("max_iterations") = 25,
+             D(dvb_ldpc_decoder_fb, make))
+
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(1)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(dvbt2_interleaver_bb.h)                                    */
-/* BINDTOOL_HEADER_FILE_HASH(01828a0a57077456ac6725972c8113a5)                     */
+/* BINDTOOL_HEADER_FILE_HASH(8595e187cc8080cf8b3e1a50a9ba7382)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -43,6 +43,7 @@ void bind_dvbt2_interleaver_bb(py::module& m)
              py::arg("framesize"),
              py::arg("rate"),
              py::arg("constellation"),
+             py::arg("bitformat") = ::gr::dtv::BITFORMAT_UNPACKED,
              D(dvbt2_interleaver_bb, make))
 
 
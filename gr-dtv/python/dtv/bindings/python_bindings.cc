@@ -40,8 +40,10 @@ void bind_catv_trellis_enc_bb(py::module&);
 void bind_dvb_bbheader_bb(py::module&);
 void bind_dvb_bbscrambler_bb(py::module&);
 void bind_dvb_bch_bb(py::module&);
+void bind_dvb_bch_decoder_bb(py::module&);
 void bind_dvb_config(py::module&);
 void bind_dvb_ldpc_bb(py::module&);
+void bind_dvb_ldpc_decoder_fb(py::module&);
 void bind_dvbs2_config(py::module&);
 void bind_dvbs2_interleaver_bb(py::module&);
 void bind_dvbs2_modulator_bc(py::module&);
@@ -118,8 +120,10 @@ PYBIND11_MODULE(dtv_python, m)
     bind_dvb_bbheader_bb(m);
     bind_dvb_bbscrambler_bb(m);
     bind_dvb_bch_bb(m);
+    bind_dvb_bch_decoder_bb(m);
     bind_dvb_config(m);
     bind_dvb_ldpc_bb(m);
+    bind_dvb_ldpc_decoder_fb(m);
     bind_dvbs2_config(m);
     bind_dvbs2_interleaver_bb(m);
     bind_dvbs2_modulator_bc(m);
@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+#
+# Copyright 2023 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+#
+
+
+from gnuradio import gr, gr_unittest, blocks, dtv
+
+import numpy as np
+
+
+class test_dvb_bitformat(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def run_chain(self, data, *blks):
+        tb = gr.top_block()
+        src = blocks.vector_source_b(data.tolist())
+        dst = blocks.vector_sink_b()
+        tb.connect(src, *blks)
+        tb.connect(blks[-1], dst)
+        tb.run()
+        return np.array(dst.data(), dtype=np.uint8)
+
+    def compare_fec(self, standard, framesize, rate, kbch, frames,
+                    constellation=dtv.MOD_OTHER):
+        rng = np.random.default_rng(7)
+        bits = rng.integers(0, 2, kbch * frames, dtype=np.uint8)
+
+        unpacked = self.run_chain(
+            bits,
+            dtv.dvb_bbscrambler_bb(standard, framesize, rate),
+            dtv.dvb_bch_bb(standard, framesize, rate),
+            dtv.dvb_ldpc_bb(standard, framesize, rate, constellation))
+        packed = self.run_chain(
+            np.packbits(bits),
+            dtv.dvb_bbscrambler_bb(standard, framesize, rate,
+                                   dtv.BITFORMAT_PACKED),
+            dtv.dvb_bch_bb(standard, framesize, rate, dtv.BITFORMAT_PACKED),
+            dtv.dvb_ldpc_bb(standard, framesize, rate, constellation,
+                            dtv.BITFORMAT_PACKED))
+
+        self.assertEqual(len(unpacked) % 8, 0)
+        self.assertTrue(np.array_equal(packed, np.packbits(unpacked)))
+
+    def test_001_t2_normal(self):
+        self.compare_fec(dtv.STANDARD_DVBT2, dtv.FECFRAME_NORMAL, dtv.C2_3,
+                         43040, 3)
+
+    def test_002_s2_short(self):
+        self.compare_fec(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT, dtv.C1_2,
+                         7032, 3)
+
+    def test_003_s2x_punctured(self):
+        # VL-SNR frames are punctured
+        self.compare_fec(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT, dtv.C1_5_VLSNR,
+                         3072, 2)
+        self.compare_fec(dtv.STANDARD_DVBS2, dtv.FECFRAME_NORMAL,
+                         dtv.C2_9_VLSNR, 14208, 2)
+
+    def test_004_interleaver(self):
+        rng = np.random.default_rng(9)
+        bits = rng.integers(0, 2, 16200 * 3, dtype=np.uint8)
+        for constellation in (dtv.MOD_QPSK, dtv.MOD_16QAM, dtv.MOD_64QAM,
+                              dtv.MOD_256QAM):
+            unpacked = self.run_chain(
+                bits,
+                dtv.dvbt2_interleaver_bb(dtv.FECFRAME_SHORT, dtv.C1_3,
+                                         constellation))
+            packed = self.run_chain(
+                np.packbits(bits),
+                dtv.dvbt2_interleaver_bb(dtv.FECFRAME_SHORT, dtv.C1_3,
+                                         constellation, dtv.BITFORMAT_PACKED))
+            self.assertTrue(np.array_equal(packed, unpacked))
+
+    def test_005_unsupported(self):
+        with self.assertRaises(ValueError):
+            dtv.dvb_bch_bb(dtv.STANDARD_DVBS2, dtv.FECFRAME_MEDIUM,
+                           dtv.C1_3_MEDIUM, dtv.BITFORMAT_PACKED)
+        with self.assertRaises(ValueError):
+            dtv.dvb_ldpc_bb(dtv.STANDARD_DVBS2, dtv.FECFRAME_NORMAL, dtv.C7_9,
+                            dtv.MOD_128APSK, dtv.BITFORMAT_PACKED)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_dvb_bitformat)
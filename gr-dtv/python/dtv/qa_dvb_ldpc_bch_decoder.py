@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+#
+# Copyright 2023 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+#
+
+
+from gnuradio import gr, gr_unittest, blocks, dtv
+
+import numpy as np
+
+
+class test_dvb_ldpc_bch_decoder(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def encode(self, standard, framesize, rate, constellation, bits):
+        src = blocks.vector_source_b(bits.tolist())
+        bch = dtv.dvb_bch_bb(standard, framesize, rate)
+        ldpc = dtv.dvb_ldpc_bb(standard, framesize, rate, constellation)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src, bch, ldpc, dst)
+        self.tb.run()
+        return np.array(dst.data(), dtype=np.uint8)
+
+    def decode(self, standard, framesize, rate, constellation, llr, flips=0):
+        tb = gr.top_block()
+        src = blocks.vector_source_f(llr.tolist())
+        ldpc = dtv.dvb_ldpc_decoder_fb(standard, framesize, rate, constellation)
+        ldpc_dst = blocks.vector_sink_b()
+        tb.connect(src, ldpc, ldpc_dst)
+        tb.run()
+        codewords = np.array(ldpc_dst.data(), dtype=np.uint8)
+
+        # Leave some errors for the BCH decoder
+        bch_in = codewords.copy()
+        bch_in[:flips * 97:97] ^= 1
+
+        tb = gr.top_block()
+        src = blocks.vector_source_b(bch_in.tolist())
+        bch = dtv.dvb_bch_decoder_bb(standard, framesize, rate)
+        dst = blocks.vector_sink_b()
+        tb.connect(src, bch, dst)
+        tb.run()
+        return np.array(dst.data(), dtype=np.uint8)
+
+    def loopback(self, standard, framesize, rate, kbch, frames, sigma,
+                 constellation=dtv.MOD_OTHER, flips=0):
+        rng = np.random.default_rng(42)
+        bits = rng.integers(0, 2, kbch * frames, dtype=np.uint8)
+        coded = self.encode(standard, framesize, rate, constellation, bits)
+
+        # BPSK over AWGN, log-likelihood ratios positive for a 0
+        llr = (1.0 - 2.0 * coded) + sigma * rng.standard_normal(len(coded))
+        llr *= 2.0 / max(sigma, 0.5)**2
+        self.assertGreater(np.count_nonzero((llr < 0) != coded), 0)
+
+        decoded = self.decode(standard, framesize, rate, constellation,
+                              llr.astype(np.float32), flips)
+        self.assertEqual(len(decoded), len(bits))
+        self.assertTrue(np.array_equal(decoded, bits))
+
+    def test_001_t2_normal(self):
+        # 2/3, well above the threshold of about 3 dB
+        self.loopback(dtv.STANDARD_DVBT2, dtv.FECFRAME_NORMAL, dtv.C2_3,
+                      43040, 5, 0.55)
+
+    def test_002_s2_short_batch(self):
+        # several frames per batch, one more than fits in a batch
+        self.loopback(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT, dtv.C1_2,
+                      7032, 5, 0.7)
+
+    def test_003_s2x_punctured_shortened(self):
+        # 1/3 VL-SNR short frames are both shortened and punctured
+        self.loopback(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT, dtv.C1_3_VLSNR,
+                      5232, 2, 0.4)
+
+    def test_004_s2x_medium_128apsk(self):
+        self.loopback(dtv.STANDARD_DVBS2, dtv.FECFRAME_MEDIUM, dtv.C1_3_MEDIUM,
+                      10620, 2, 0.4)
+        self.tb = gr.top_block()
+        self.loopback(dtv.STANDARD_DVBS2, dtv.FECFRAME_NORMAL, dtv.C7_9,
+                      50208, 1, 0.3, constellation=dtv.MOD_128APSK)
+
+    def test_005_bch_correction(self):
+        # t = 12 for normal frames at 2/3
+        self.loopback(dtv.STANDARD_DVBT2, dtv.FECFRAME_NORMAL, dtv.C2_3,
+                      43040, 2, 0.3, flips=12)
+
+    def test_006_bch_uncorrectable(self):
+        # 40 errors in the first of two short frames, far beyond t = 12
+        rng = np.random.default_rng(42)
+        bits = rng.integers(0, 2, 7032 * 2, dtype=np.uint8)
+        src = blocks.vector_source_b(bits.tolist())
+        bch = dtv.dvb_bch_bb(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT, dtv.C1_2)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src, bch, dst)
+        self.tb.run()
+        coded = np.array(dst.data(), dtype=np.uint8)
+        coded[:40 * 97:97] ^= 1
+
+        tb = gr.top_block()
+        src = blocks.vector_source_b(coded.tolist())
+        dec = dtv.dvb_bch_decoder_bb(dtv.STANDARD_DVBS2, dtv.FECFRAME_SHORT,
+                                     dtv.C1_2)
+        dst = blocks.vector_sink_b()
+        tb.connect(src, dec, dst)
+        tb.run()
+        decoded = np.array(dst.data(), dtype=np.uint8)
+
+        self.assertEqual(dec.num_frames(), 2)
+        self.assertEqual(dec.num_bad_frames(), 1)
+        # the bad frame is passed on as received, the good one corrected
+        self.assertTrue(np.array_equal(decoded[:7032], coded[:7032]))
+        self.assertTrue(np.array_equal(decoded[7032:], bits[7032:]))
+
+
+if __name__ == '__main__':
+    gr_unittest.run(test_dvb_ldpc_bch_decoder)
@@ -15,6 +15,7 @@
 #include <gnuradio/fec/api.h>
 #include <gnuradio/fec/generic_decoder.h>
 #include <memory>
+#include <vector>
 
 namespace gr {
 namespace fec {
@@ -67,6 +68,24 @@ public:
                      size_t input_item_size,
                      size_t output_item_size);
 
+    /*!
+     * Create a FEC decoder block that decodes frames in parallel.
+     *
+     * The frames of each call to general_work are split among the
+     * decoder objects, each of which runs on its own thread of a
+     * pool kept for the lifetime of the block. The output is written
+     * in order, as by a single decoder. All objects must be
+     * configured identically and must not carry state from one frame
+     * to the next (no history).
+     *
+     * \param my_decoders FECAPI decoder objects, one per thread.
+     * \param input_item_size The size of the input items.
+     * \param output_item_size The size of the output items.
+     */
+    static sptr make(const std::vector<generic_decoder::sptr>& my_decoders,
+                     size_t input_item_size,
+                     size_t output_item_size);
+
     int general_work(int noutput_items,
                      gr_vector_int& ninput_items,
                      gr_vector_const_void_star& input_items,
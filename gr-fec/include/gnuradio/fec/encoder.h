@@ -15,6 +15,7 @@
 #include <gnuradio/fec/api.h>
 #include <gnuradio/fec/generic_encoder.h>
 #include <memory>
+#include <vector>
 
 namespace gr {
 namespace fec {
@@ -48,6 +49,20 @@ public:
                      size_t input_item_size,
                      size_t output_item_size);
 
+    /*!
+     * Build a FEC encoder block that encodes frames in parallel, the
+     * frames of each call to general_work being split among the
+     * encoder objects, one per thread of a pool kept for the lifetime
+     * of the block. All objects must be configured identically.
+     *
+     * \param my_encoders FECAPI encoder objects, one per thread.
+     * \param input_item_size size of a block of data for the encoder.
+     * \param output_item_size size of a block of data the encoder will produce.
+     */
+    static sptr make(const std::vector<generic_encoder::sptr>& my_encoders,
+                     size_t input_item_size,
+                     size_t output_item_size);
+
     int general_work(int noutput_items,
                      gr_vector_int& ninput_items,
                      gr_vector_const_void_star& input_items,
@@ -107,6 +107,17 @@ public:
      */
     virtual const char* get_output_conversion();
 
+    /*!
+     * Returns true if the encoder carries state from one frame into
+     * the next, such as a convolutional encoder in streaming mode.
+     * Such an encoder must see every frame in order, so it cannot
+     * be used to encode in parallel.
+     *
+     * The child class MAY implement this function. If not
+     * reimplemented, it returns false.
+     */
+    virtual bool carries_state();
+
     /*!
      * Updates the size of the frame to encode.
      *
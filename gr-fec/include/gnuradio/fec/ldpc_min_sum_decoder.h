@@ -0,0 +1,106 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_FEC_LDPC_MIN_SUM_DECODER_H
+#define INCLUDED_FEC_LDPC_MIN_SUM_DECODER_H
+
+#include <gnuradio/fec/api.h>
+#include <gnuradio/fec/fec_mtrx.h>
+#include <gnuradio/fec/generic_decoder.h>
+#include <string>
+
+namespace gr {
+namespace fec {
+namespace code {
+
+/*!
+ * \brief LDPC layered min-sum decoding class
+ * \ingroup error_coding_blk
+ *
+ * \details
+ * A soft decision decoder for low density parity check (LDPC)
+ * codes using the layered (row-serial) min-sum algorithm. The
+ * check nodes are processed one after the other and every check
+ * node update immediately refreshes the a-posteriori values of
+ * its variables, which roughly halves the number of iterations
+ * compared to flooding belief propagation. The check node update
+ * only keeps the two smallest incoming magnitudes and the parity
+ * of the signs, scaled (normalized min-sum) or reduced (offset
+ * min-sum) to make up for the overestimation of the min-sum
+ * approximation.
+ *
+ * Messages are kept in 8 or 16 bit saturating fixed point. The
+ * codewords of a frame are decoded side by side, one codeword per
+ * lane, so that every check node update is a loop over the lanes
+ * that the compiler turns into vector instructions. Decoding stops
+ * as soon as the hard decisions of all codewords in flight satisfy
+ * every parity check.
+ *
+ * As with the other LDPC decoders, the input is one soft value
+ * per code bit, positive values meaning a '1'.
+ */
+class FEC_API ldpc_min_sum_decoder : virtual public generic_decoder
+{
+public:
+    /*!
+     * \brief Build a min-sum decoding FEC API object.
+     * \param mtrx_obj The LDPC parity check matrix to use for
+     *        decoding. This should be the same matrix used for
+     *        encoding. Provide either a ldpc_H_matrix or
+     *        a ldpc_G_matrix object.
+     * \param max_iter Maximum number of iterations, each of
+     *        which visits every check node once.
+     * \param correction For normalized min-sum, the factor
+     *        (0 < correction <= 1) applied to the check node
+     *        magnitudes; for offset min-sum, the offset
+     *        subtracted from them, in units of the input.
+     * \param offset Use offset instead of normalized min-sum.
+     * \param message_bits Width of the fixed point messages, 8
+     *        or 16. 8 bit messages double the number of lanes
+     *        per vector instruction at a small loss in coding
+     *        gain.
+     */
+    static generic_decoder::sptr make(const fec_mtrx_sptr mtrx_obj,
+                                      unsigned int max_iter = 20,
+                                      float correction = 0.75,
+                                      bool offset = false,
+                                      int message_bits = 8);
+
+    /*!
+     * \brief Build a min-sum decoding FEC API object from an
+     *        alist file, for codes built with ldpc_encoder.
+     * \param alist_file The alist file of the parity check matrix.
+     * \param max_iter See make().
+     * \param correction See make().
+     * \param offset See make().
+     * \param message_bits See make().
+     */
+    static generic_decoder::sptr make_alist(const std::string& alist_file,
+                                            unsigned int max_iter = 20,
+                                            float correction = 0.75,
+                                            bool offset = false,
+                                            int message_bits = 8);
+
+    /*!
+     * \brief  Sets the uncoded frame size to \p frame_size.
+     * \details
+     * Sets the uncoded frame size to \p frame_size, which must
+     * be a multiple of the information word size of the code.
+     */
+    bool set_frame_size(unsigned int frame_size) override = 0;
+
+    //! Returns the coding rate of this decoder.
+    double rate() override = 0;
+};
+} /* namespace code */
+} /* namespace fec */
+} /* namespace gr */
+
+#endif /* INCLUDED_FEC_LDPC_MIN_SUM_DECODER_H */
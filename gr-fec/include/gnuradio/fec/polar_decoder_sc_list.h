@@ -34,6 +34,12 @@ class scl_list;
  *
  * Block expects float input with bits mapped 1 --> 1, 0 --> -1
  * Or: f = 2.0 * bit - 1.0
+ *
+ * With a CRC, the last crc_size information bits are expected to hold
+ * the CRC of the preceding ones, most significant bit first, computed
+ * with a zero initial register. The decoder then outputs the most
+ * likely path that passes the CRC (CA-SCL), or the most likely path if
+ * none does. The output still contains the CRC bits.
  */
 class FEC_API polar_decoder_sc_list : public polar_decoder_common
 {
@@ -51,12 +57,19 @@ public:
      * \param frozen_bit_values holds an unpacked byte for every
      *        frozen bit position. It defines if a frozen bit is
      *        fixed to '0' or '1'. Defaults to all ZERO.
+     * \param crc_size number of CRC bits at the end of the
+     *        information bits, 0 to disable CRC-aided decoding.
+     *        At most 32 and less than num_info_bits.
+     * \param crc_polynomial CRC generator polynomial without the
+     *        leading term, e.g. 0x621 for the 5G NR CRC11.
      */
     static generic_decoder::sptr make(int max_list_size,
                                       int block_size,
                                       int num_info_bits,
                                       std::vector<int> frozen_bit_positions,
-                                      std::vector<uint8_t> frozen_bit_values);
+                                      std::vector<uint8_t> frozen_bit_values,
+                                      int crc_size = 0,
+                                      unsigned int crc_polynomial = 0);
     ~polar_decoder_sc_list() override;
 
     // FECAPI
@@ -67,7 +80,13 @@ private:
                           int block_size,
                           int num_info_bits,
                           std::vector<int> frozen_bit_positions,
-                          std::vector<uint8_t> frozen_bit_values);
+                          std::vector<uint8_t> frozen_bit_values,
+                          int crc_size,
+                          unsigned int crc_polynomial);
+
+    const int d_crc_size;
+    const unsigned int d_crc_polynomial;
+    std::vector<unsigned char> d_info_bits;
 
     // Pointer because it's an impl type.
     const std::unique_ptr<polar::scl_list> d_scl;
@@ -77,6 +96,7 @@ private:
     void decode_bit(const int u_num);
     void calculate_llrs_for_list(const int u_num);
     void set_bit_in_list(const int u_num);
+    bool crc_passes(const unsigned char* info_bits) const;
 };
 
 } // namespace code
@@ -17,6 +17,16 @@ FEC_API void* init_rs_char(unsigned int symsize,
                            unsigned int nroots);
 FEC_API void free_rs_char(void* rs);
 
+/* Decode count shortened codewords of len symbols each, stored back to
+ * back, in place. Error free codewords are found by a batch syndrome
+ * check and left alone; the others go through decode_rs_char. When
+ * results is not NULL, results[i] gets the decode_rs_char return value
+ * of codeword i (0 if it was error free). Returns the number of
+ * codewords that could not be corrected.
+ */
+FEC_API int
+decode_rs_char_batch(void* rs, unsigned char* data, int len, int count, int* results);
+
 /* General purpose RS codec, integer symbols */
 FEC_API void encode_rs_int(void* rs, int* data, int* parity);
 FEC_API int decode_rs_int(void* rs, int* data, int* eras_pos, int no_eras);
@@ -32,10 +42,12 @@ FEC_API void free_rs_int(void* rs);
  */
 FEC_API void encode_rs_8(unsigned char* data, unsigned char* parity);
 FEC_API int decode_rs_8(unsigned char* data, int* eras_pos, int no_eras);
+FEC_API int decode_rs_8_batch(unsigned char* data, int len, int count, int* results);
 
 /* CCSDS standard (255,223) RS codec with dual-basis symbol representation
  */
 FEC_API void encode_rs_ccsds(unsigned char* data, unsigned char* parity);
 FEC_API int decode_rs_ccsds(unsigned char* data, int* eras_pos, int no_eras);
+FEC_API int decode_rs_ccsds_batch(unsigned char* data, int len, int count, int* results);
 
 #endif /* INCLUDED_RS_H */
@@ -100,6 +100,8 @@ int cc_encoder_impl::get_output_size() { return d_output_size; }
 
 int cc_encoder_impl::get_input_size() { return d_frame_size; }
 
+bool cc_encoder_impl::carries_state() { return d_mode == CC_STREAMING; }
+
 bool cc_encoder_impl::set_frame_size(unsigned int frame_size)
 {
     bool ret = true;
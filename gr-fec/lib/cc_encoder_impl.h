@@ -26,6 +26,7 @@ private:
     void generic_work(void* inbuffer, void* outbuffer) override;
     int get_output_size() override;
     int get_input_size() override;
+    bool carries_state() override;
 
     // everything else...
     unsigned char Partab[256];
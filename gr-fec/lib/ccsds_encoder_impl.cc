@@ -51,6 +51,8 @@ const char* ccsds_encoder_impl::get_input_conversion()
     return "pack";
 }
 
+bool ccsds_encoder_impl::carries_state() { return d_mode == CC_STREAMING; }
+
 bool ccsds_encoder_impl::set_frame_size(unsigned int frame_size)
 {
     bool ret = true;
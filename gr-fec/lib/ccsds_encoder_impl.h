@@ -27,6 +27,7 @@ private:
     int get_output_size() override;
     int get_input_size() override;
     const char* get_input_conversion() override;
+    bool carries_state() override;
 
     unsigned int d_max_frame_size;
     unsigned int d_frame_size;
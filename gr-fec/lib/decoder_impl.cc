@@ -14,7 +14,9 @@
 
 #include "decoder_impl.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
 #include <cstdio>
+#include <stdexcept>
 
 namespace gr {
 namespace fec {
@@ -24,18 +26,48 @@ decoder::sptr decoder::make(generic_decoder::sptr my_decoder,
                             size_t output_item_size)
 {
     return gnuradio::make_block_sptr<decoder_impl>(
-        my_decoder, input_item_size, output_item_size);
+        std::vector<generic_decoder::sptr>{ my_decoder },
+        input_item_size,
+        output_item_size);
 }
 
-decoder_impl::decoder_impl(generic_decoder::sptr my_decoder,
+decoder::sptr decoder::make(const std::vector<generic_decoder::sptr>& my_decoders,
+                            size_t input_item_size,
+                            size_t output_item_size)
+{
+    return gnuradio::make_block_sptr<decoder_impl>(
+        my_decoders, input_item_size, output_item_size);
+}
+
+decoder_impl::decoder_impl(const std::vector<generic_decoder::sptr>& my_decoders,
                            size_t input_item_size,
                            size_t output_item_size)
     : block("fec_decoder",
             io_signature::make(1, 1, input_item_size),
             io_signature::make(1, 1, output_item_size)),
+      d_decoders(my_decoders),
       d_input_item_size(input_item_size),
       d_output_item_size(output_item_size)
 {
+    if (my_decoders.empty()) {
+        throw std::invalid_argument("fec_decoder: no decoder objects given");
+    }
+    generic_decoder::sptr my_decoder = my_decoders[0];
+    if (my_decoders.size() > 1) {
+        for (const auto& dec : my_decoders) {
+            if (dec->get_input_size() != my_decoder->get_input_size() ||
+                dec->get_output_size() != my_decoder->get_output_size()) {
+                throw std::invalid_argument(
+                    "fec_decoder: decoder objects have different frame sizes");
+            }
+            if (dec->get_history() != 0) {
+                throw std::invalid_argument(
+                    "fec_decoder: cannot decode in parallel with a decoder with history");
+            }
+        }
+        d_pool = std::make_unique<worker_pool>(my_decoders.size(), "fec_decoder");
+    }
+
     set_fixed_rate(true);
     set_relative_rate((uint64_t)my_decoder->get_output_size(),
                       (uint64_t)my_decoder->get_input_size());
@@ -49,6 +81,8 @@ decoder_impl::decoder_impl(generic_decoder::sptr my_decoder,
     d_decoder = my_decoder;
 }
 
+decoder_impl::~decoder_impl() {}
+
 int decoder_impl::fixed_rate_ninput_to_noutput(int ninput)
 {
     return std::lround(ninput * relative_rate());
@@ -81,11 +115,30 @@ int decoder_impl::general_work(int noutput_items,
                     ? noutput_items / (output_multiple() - d_decoder->get_history())
                     : innum;
 
-    for (int i = 0; i < items; ++i) {
-        d_decoder->generic_work(
-            (void*)(in + (i * d_decoder->get_input_size() * d_input_item_size)),
-            (void*)(out + (i * d_decoder->get_output_size() * d_output_item_size)));
+    const size_t in_frame = d_decoder->get_input_size() * d_input_item_size;
+    const size_t out_frame = d_decoder->get_output_size() * d_output_item_size;
+    auto decode = [&](generic_decoder* dec, int first, int last) {
+        for (int i = first; i < last; ++i) {
+            dec->generic_work((void*)(in + (i * in_frame)), (void*)(out + (i * out_frame)));
+        }
+    };
+
+    if (d_pool && items > 1) {
+        // Contiguous runs of frames per worker, each writing its own
+        // part of the output buffer.
+        const int nworkers = std::min<int>(d_pool->size(), items);
+        d_pool->run([&](unsigned int w) {
+            if ((int)w < nworkers) {
+                decode(d_decoders[w].get(),
+                       items * w / nworkers,
+                       items * (w + 1) / nworkers);
+            }
+        });
+    } else {
+        decode(d_decoder.get(), 0, items);
+    }
 
+    for (int i = 0; i < items; ++i) {
         add_item_tag(0,
                      nitems_written(0) +
                          ((i + 1) * d_decoder->get_output_size() * d_output_item_size),
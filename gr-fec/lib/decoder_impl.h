@@ -11,6 +11,7 @@
 #ifndef INCLUDED_FEC_DECODER_IMPL_H
 #define INCLUDED_FEC_DECODER_IMPL_H
 
+#include "worker_pool.h"
 #include <gnuradio/fec/decoder.h>
 
 namespace gr {
@@ -20,13 +21,16 @@ class FEC_API decoder_impl : public decoder
 {
 private:
     generic_decoder::sptr d_decoder;
+    std::vector<generic_decoder::sptr> d_decoders; // one per worker
+    std::unique_ptr<worker_pool> d_pool;
     size_t d_input_item_size;
     size_t d_output_item_size;
 
 public:
-    decoder_impl(generic_decoder::sptr my_decoder,
+    decoder_impl(const std::vector<generic_decoder::sptr>& my_decoders,
                  size_t input_item_size,
                  size_t output_item_size);
+    ~decoder_impl() override;
 
     int general_work(int noutput_items,
                      gr_vector_int& ninput_items,
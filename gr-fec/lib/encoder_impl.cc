@@ -14,7 +14,9 @@
 
 #include "encoder_impl.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
 #include <cstdio>
+#include <stdexcept>
 
 namespace gr {
 namespace fec {
@@ -24,18 +26,49 @@ encoder::sptr encoder::make(generic_encoder::sptr my_encoder,
                             size_t output_item_size)
 {
     return gnuradio::make_block_sptr<encoder_impl>(
-        my_encoder, input_item_size, output_item_size);
+        std::vector<generic_encoder::sptr>{ my_encoder },
+        input_item_size,
+        output_item_size);
 }
 
-encoder_impl::encoder_impl(generic_encoder::sptr my_encoder,
+encoder::sptr encoder::make(const std::vector<generic_encoder::sptr>& my_encoders,
+                            size_t input_item_size,
+                            size_t output_item_size)
+{
+    return gnuradio::make_block_sptr<encoder_impl>(
+        my_encoders, input_item_size, output_item_size);
+}
+
+encoder_impl::encoder_impl(const std::vector<generic_encoder::sptr>& my_encoders,
                            size_t input_item_size,
                            size_t output_item_size)
     : block("fec_encoder",
             io_signature::make(1, 1, input_item_size),
             io_signature::make(1, 1, output_item_size)),
+      d_encoders(my_encoders),
       d_input_item_size(input_item_size),
       d_output_item_size(output_item_size)
 {
+    if (my_encoders.empty()) {
+        throw std::invalid_argument("fec_encoder: no encoder objects given");
+    }
+    generic_encoder::sptr my_encoder = my_encoders[0];
+    if (my_encoders.size() > 1) {
+        for (const auto& enc : my_encoders) {
+            if (enc->get_input_size() != my_encoder->get_input_size() ||
+                enc->get_output_size() != my_encoder->get_output_size()) {
+                throw std::invalid_argument(
+                    "fec_encoder: encoder objects have different frame sizes");
+            }
+            if (enc->carries_state()) {
+                throw std::invalid_argument(
+                    "fec_encoder: cannot encode in parallel with an encoder that "
+                    "carries state between frames");
+            }
+        }
+        d_pool = std::make_unique<worker_pool>(my_encoders.size(), "fec_encoder");
+    }
+
     set_fixed_rate(true);
     set_relative_rate((uint64_t)my_encoder->get_output_size(),
                       (uint64_t)my_encoder->get_input_size());
@@ -71,9 +104,26 @@ int encoder_impl::general_work(int noutput_items,
     char* inbuffer = (char*)input_items[0];
     char* outbuffer = (char*)output_items[0];
 
-    for (int i = 0; i < noutput_items / output_multiple(); i++) {
-        d_encoder->generic_work((void*)(inbuffer + (i * d_input_size)),
-                                (void*)(outbuffer + (i * d_output_size)));
+    const int items = noutput_items / output_multiple();
+
+    auto encode = [&](generic_encoder* enc, int first, int last) {
+        for (int i = first; i < last; i++) {
+            enc->generic_work((void*)(inbuffer + (i * d_input_size)),
+                              (void*)(outbuffer + (i * d_output_size)));
+        }
+    };
+
+    if (d_pool && items > 1) {
+        const int nworkers = std::min<int>(d_pool->size(), items);
+        d_pool->run([&](unsigned int w) {
+            if ((int)w < nworkers) {
+                encode(d_encoders[w].get(),
+                       items * w / nworkers,
+                       items * (w + 1) / nworkers);
+            }
+        });
+    } else {
+        encode(d_encoder.get(), 0, items);
     }
 
     consume_each(fixed_rate_noutput_to_ninput(noutput_items));
@@ -11,6 +11,7 @@
 #ifndef INCLUDED_FEC_ENCODER_IMPL_H
 #define INCLUDED_FEC_ENCODER_IMPL_H
 
+#include "worker_pool.h"
 #include <gnuradio/fec/encoder.h>
 
 namespace gr {
@@ -20,13 +21,15 @@ class FEC_API encoder_impl : public encoder
 {
 private:
     generic_encoder::sptr d_encoder;
+    std::vector<generic_encoder::sptr> d_encoders; // one per worker
+    std::unique_ptr<worker_pool> d_pool;
     size_t d_input_item_size;
     size_t d_output_item_size;
     size_t d_input_size;
     size_t d_output_size;
 
 public:
-    encoder_impl(generic_encoder::sptr my_encoder,
+    encoder_impl(const std::vector<generic_encoder::sptr>& my_encoders,
                  size_t input_item_size,
                  size_t output_item_size);
     ~encoder_impl() override;
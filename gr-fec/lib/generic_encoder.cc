@@ -32,6 +32,8 @@ const char* generic_encoder::get_input_conversion() { return "none"; }
 
 const char* generic_encoder::get_output_conversion() { return "none"; }
 
+bool generic_encoder::carries_state() { return false; }
+
 int generic_encoder::base_unique_id = 1;
 int generic_encoder::unique_id() { return my_id; }
 
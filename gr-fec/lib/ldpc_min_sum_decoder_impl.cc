@@ -0,0 +1,413 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "fec_mtrx_impl.h"
+#include "ldpc_min_sum_decoder_impl.h"
+#include <gnuradio/fec/alist.h>
+#include <gnuradio/fec/cldpc.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gr {
+namespace fec {
+namespace code {
+
+namespace {
+
+// Number of code words decoded side by side
+constexpr unsigned int s_lanes = 16;
+
+// Largest a-posteriori magnitude
+constexpr int s_llr_max = 32767;
+
+/*
+ * Fixed point format of the messages: largest magnitude and number of
+ * quantization steps per unit of input. The 16 bit format leaves a factor
+ * of two of headroom so that a message plus a channel value still fits
+ * the 16 bit a-posteriori values.
+ */
+template <class T>
+struct msg_format;
+
+template <>
+struct msg_format<int8_t> {
+    static constexpr int max = 127;
+    static constexpr float scale = 8.0f;
+};
+
+template <>
+struct msg_format<int16_t> {
+    static constexpr int max = 16383;
+    static constexpr float scale = 256.0f;
+};
+
+inline int saturate(int x, int max) { return std::min(std::max(x, -max), max); }
+
+} // namespace
+
+generic_decoder::sptr ldpc_min_sum_decoder::make(const fec_mtrx_sptr mtrx_obj,
+                                                 unsigned int max_iter,
+                                                 float correction,
+                                                 bool offset,
+                                                 int message_bits)
+{
+    auto mtrx = std::dynamic_pointer_cast<fec_mtrx_impl>(mtrx_obj);
+    if (!mtrx) {
+        throw std::runtime_error(
+            "ldpc_min_sum_decoder: expected a ldpc_H_matrix or ldpc_G_matrix.");
+    }
+
+    const unsigned int n = mtrx->n();
+    const unsigned int k = mtrx->k();
+    const gsl_matrix* H = mtrx->H();
+
+    std::vector<std::vector<unsigned int>> checks(H->size1);
+    for (unsigned int row = 0; row < H->size1; row++) {
+        for (unsigned int col = 0; col < H->size2; col++) {
+            if (gsl_matrix_get(H, row, col) > 0) {
+                checks[row].push_back(col);
+            }
+        }
+    }
+
+    // Same info bit positions as fec_mtrx::decode()
+    std::vector<unsigned int> info_bits(k);
+    const unsigned int first = mtrx->parity_bits_come_last() ? 0 : n - k;
+    for (unsigned int i = 0; i < k; i++) {
+        info_bits[i] = first + i;
+    }
+
+    return generic_decoder::sptr(new ldpc_min_sum_decoder_impl(
+        n, checks, info_bits, max_iter, correction, offset, message_bits));
+}
+
+generic_decoder::sptr ldpc_min_sum_decoder::make_alist(const std::string& alist_file,
+                                                       unsigned int max_iter,
+                                                       float correction,
+                                                       bool offset,
+                                                       int message_bits)
+{
+    if (!std::filesystem::exists(alist_file))
+        throw std::runtime_error("Bad AList file name!");
+
+    alist list;
+    list.read(alist_file.c_str());
+    cldpc code;
+    code.set_alist(list);
+
+    const unsigned int n = list.get_N();
+    const unsigned int k = code.dimension();
+
+    // alist indices are 1-based
+    const std::vector<std::vector<int>> mlist = list.get_mlist();
+    const std::vector<int> num_mlist = list.get_num_mlist();
+    std::vector<std::vector<unsigned int>> checks(mlist.size());
+    for (size_t row = 0; row < mlist.size(); row++) {
+        for (int i = 0; i < num_mlist[row]; i++) {
+            checks[row].push_back(mlist[row][i] - 1);
+        }
+    }
+
+    // cldpc only hands out the systematic bits of a code word; recover
+    // their positions by feeding it the bit planes of the bit indices.
+    std::vector<unsigned int> info_bits(k, 0);
+    std::vector<uint8_t> word(n);
+    for (unsigned int b = 0; (1u << b) < n; b++) {
+        for (unsigned int j = 0; j < n; j++) {
+            word[j] = (j >> b) & 1;
+        }
+        const std::vector<uint8_t> sys = code.get_systematic_bits(word);
+        for (unsigned int i = 0; i < k; i++) {
+            info_bits[i] |= static_cast<unsigned int>(sys[i]) << b;
+        }
+    }
+
+    return generic_decoder::sptr(new ldpc_min_sum_decoder_impl(
+        n, checks, info_bits, max_iter, correction, offset, message_bits));
+}
+
+ldpc_min_sum_decoder_impl::ldpc_min_sum_decoder_impl(
+    unsigned int n,
+    const std::vector<std::vector<unsigned int>>& checks,
+    const std::vector<unsigned int>& info_bits,
+    unsigned int max_iter,
+    float correction,
+    bool offset,
+    int message_bits)
+    : generic_decoder("ldpc_min_sum_decoder"),
+      d_n(n),
+      d_k(info_bits.size()),
+      d_max_check_degree(0),
+      d_info_bits(info_bits),
+      d_max_iterations(max_iter),
+      d_iterations(0),
+      d_offset(offset),
+      d_message_bits(message_bits)
+{
+    if (d_k == 0 || d_k >= d_n) {
+        throw std::runtime_error("ldpc_min_sum_decoder: invalid code dimensions.");
+    }
+    if (message_bits != 8 && message_bits != 16) {
+        throw std::runtime_error("ldpc_min_sum_decoder: message_bits must be 8 or 16.");
+    }
+
+    const float scale = (message_bits == 8) ? msg_format<int8_t>::scale
+                                            : msg_format<int16_t>::scale;
+    if (offset) {
+        if (correction < 0) {
+            throw std::runtime_error(
+                "ldpc_min_sum_decoder: the offset must not be negative.");
+        }
+        d_correction = static_cast<int>(std::lround(correction * scale));
+    } else {
+        if (correction <= 0 || correction > 1) {
+            throw std::runtime_error(
+                "ldpc_min_sum_decoder: the normalization factor must be in (0, 1].");
+        }
+        d_correction = std::max(1, static_cast<int>(std::lround(correction * 16)));
+    }
+
+    d_check_offsets.reserve(checks.size() + 1);
+    d_check_offsets.push_back(0);
+    for (const auto& check : checks) {
+        for (unsigned int var : check) {
+            if (var >= d_n) {
+                throw std::runtime_error(
+                    "ldpc_min_sum_decoder: parity check index out of range.");
+            }
+            d_check_vars.push_back(var);
+        }
+        d_check_offsets.push_back(d_check_vars.size());
+        d_max_check_degree =
+            std::max(d_max_check_degree, static_cast<unsigned int>(check.size()));
+    }
+
+    d_llr.resize(d_n * s_lanes);
+    if (message_bits == 8) {
+        d_msg8.resize(d_check_vars.size() * s_lanes);
+    } else {
+        d_msg16.resize(d_check_vars.size() * s_lanes);
+    }
+    d_q.resize(d_max_check_degree * s_lanes);
+
+    d_rate = static_cast<double>(d_k) / static_cast<double>(d_n);
+
+    // Set frame size to k, the # of bits in the information word
+    // All buffers and settings will be based on this value.
+    set_frame_size(d_k);
+}
+
+ldpc_min_sum_decoder_impl::~ldpc_min_sum_decoder_impl() {}
+
+int ldpc_min_sum_decoder_impl::get_output_size() { return d_output_size; }
+
+int ldpc_min_sum_decoder_impl::get_input_size() { return d_input_size; }
+
+bool ldpc_min_sum_decoder_impl::set_frame_size(unsigned int frame_size)
+{
+    if (frame_size % d_k != 0) {
+        d_logger->error("Frame size ({:d} bits) must be a "
+                        "multiple of the information word "
+                        "size of the LDPC matrix, {:d}",
+                        frame_size,
+                        d_k);
+        throw std::runtime_error("ldpc_min_sum_decoder: cannot use frame size.");
+    }
+
+    d_output_size = frame_size;
+    d_input_size = (frame_size / d_k) * d_n;
+
+    return true;
+}
+
+double ldpc_min_sum_decoder_impl::rate() { return d_rate; }
+
+float ldpc_min_sum_decoder_impl::get_iterations() { return d_iterations; }
+
+template <unsigned int W>
+bool ldpc_min_sum_decoder_impl::update_active(unsigned char* active)
+{
+    const int16_t* L = d_llr.data();
+    const unsigned int nchecks = d_check_offsets.size() - 1;
+
+    // Inactive lanes are not updated any more and cannot fail, so the
+    // scan can stop once all active lanes have failed a check.
+    unsigned char failed[W] = {};
+    for (unsigned int c = 0; c < nchecks; c++) {
+        unsigned char parity[W] = {};
+        for (unsigned int e = d_check_offsets[c]; e < d_check_offsets[c + 1]; e++) {
+            const int16_t* Lv = &L[d_check_vars[e] * W];
+            for (unsigned int l = 0; l < W; l++) {
+                parity[l] ^= (Lv[l] < 0);
+            }
+        }
+        unsigned char pending = 0;
+        for (unsigned int l = 0; l < W; l++) {
+            failed[l] |= parity[l];
+            pending |= active[l] && !failed[l];
+        }
+        if (!pending) {
+            break;
+        }
+    }
+
+    unsigned char any = 0;
+    for (unsigned int l = 0; l < W; l++) {
+        active[l] = failed[l];
+        any |= failed[l];
+    }
+    return any;
+}
+
+template <class T, unsigned int W>
+unsigned int ldpc_min_sum_decoder_impl::decode_lanes(const float* in,
+                                                     unsigned char* out,
+                                                     unsigned int ncw)
+{
+    constexpr int mmax = msg_format<T>::max;
+    constexpr float scale = msg_format<T>::scale;
+
+    int16_t* L = d_llr.data();
+    T* R;
+    if constexpr (std::is_same_v<T, int8_t>) {
+        R = d_msg8.data();
+    } else {
+        R = d_msg16.data();
+    }
+
+    // Channel values as log(P(0) / P(1)); positive inputs mean a '1'.
+    // Unused lanes stay at 0, which satisfies every check.
+    unsigned char active[W];
+    for (unsigned int l = 0; l < W; l++) {
+        active[l] = (l < ncw);
+    }
+    for (unsigned int v = 0; v < d_n; v++) {
+        for (unsigned int l = 0; l < W; l++) {
+            const float x = (l < ncw) ? -scale * in[l * d_n + v] : 0.0f;
+            L[v * W + l] = saturate(static_cast<int>(std::lrint(x)), mmax);
+        }
+    }
+    std::fill(R, R + d_check_vars.size() * W, 0);
+
+    const unsigned int nchecks = d_check_offsets.size() - 1;
+    const int corr = d_correction;
+    const bool offset = d_offset;
+
+    unsigned int iter = 0;
+    // Lanes are frozen as soon as their hard decisions form a code word:
+    // with saturated messages, min-sum can wander off a valid code word
+    // again while the other lanes are still being decoded.
+    while (iter < d_max_iterations && update_active<W>(active)) {
+        for (unsigned int c = 0; c < nchecks; c++) {
+            const unsigned int first = d_check_offsets[c];
+            const unsigned int degree = d_check_offsets[c + 1] - first;
+            const unsigned int* vars = &d_check_vars[first];
+            T* r = &R[first * W];
+            int16_t* q = d_q.data();
+
+            int16_t min1[W], min2[W];
+            unsigned char sign[W];
+            for (unsigned int l = 0; l < W; l++) {
+                min1[l] = mmax;
+                min2[l] = mmax;
+                sign[l] = 0;
+            }
+
+            // Variable to check messages: remove this check's previous
+            // contribution from the a-posteriori values.
+            for (unsigned int e = 0; e < degree; e++) {
+                const int16_t* Lv = &L[vars[e] * W];
+                for (unsigned int l = 0; l < W; l++) {
+                    const int t = saturate(Lv[l] - r[e * W + l], mmax);
+                    const int a = std::abs(t);
+                    q[e * W + l] = t;
+                    min2[l] = std::min<int>(min2[l], std::max<int>(a, min1[l]));
+                    min1[l] = std::min<int>(min1[l], a);
+                    sign[l] ^= (t < 0);
+                }
+            }
+
+            int16_t mag1[W], mag2[W];
+            for (unsigned int l = 0; l < W; l++) {
+                if (offset) {
+                    mag1[l] = std::max(min1[l] - corr, 0);
+                    mag2[l] = std::max(min2[l] - corr, 0);
+                } else {
+                    mag1[l] = (min1[l] * corr) >> 4;
+                    mag2[l] = (min2[l] * corr) >> 4;
+                }
+            }
+
+            // Check to variable messages: the smallest magnitude of the
+            // other edges, with the parity of their signs.
+            for (unsigned int e = 0; e < degree; e++) {
+                int16_t* Lv = &L[vars[e] * W];
+                for (unsigned int l = 0; l < W; l++) {
+                    const int t = q[e * W + l];
+                    const int mag = (std::abs(t) == min1[l]) ? mag2[l] : mag1[l];
+                    const int m = (sign[l] ^ (t < 0)) ? -mag : mag;
+                    r[e * W + l] = active[l] ? m : r[e * W + l];
+                    Lv[l] = active[l] ? saturate(t + m, s_llr_max) : Lv[l];
+                }
+            }
+        }
+        iter++;
+    }
+
+    for (unsigned int l = 0; l < ncw; l++) {
+        for (unsigned int i = 0; i < d_k; i++) {
+            out[l * d_k + i] = L[d_info_bits[i] * W + l] < 0;
+        }
+    }
+
+    return iter;
+}
+
+void ldpc_min_sum_decoder_impl::generic_work(void* inbuffer, void* outbuffer)
+{
+    const float* in = (const float*)inbuffer;
+    unsigned char* out = (unsigned char*)outbuffer;
+
+    const unsigned int ncw = d_output_size / d_k;
+    unsigned int total_iterations = 0;
+
+    for (unsigned int cw = 0; cw < ncw;) {
+        const unsigned int m = std::min(s_lanes, ncw - cw);
+        const float* cw_in = &in[cw * d_n];
+        unsigned char* cw_out = &out[cw * d_k];
+
+        unsigned int iterations;
+        if (d_message_bits == 8) {
+            iterations = (m == 1) ? decode_lanes<int8_t, 1>(cw_in, cw_out, m)
+                                  : decode_lanes<int8_t, s_lanes>(cw_in, cw_out, m);
+        } else {
+            iterations = (m == 1) ? decode_lanes<int16_t, 1>(cw_in, cw_out, m)
+                                  : decode_lanes<int16_t, s_lanes>(cw_in, cw_out, m);
+        }
+
+        total_iterations += iterations * m;
+        cw += m;
+    }
+
+    d_iterations = static_cast<float>(total_iterations) / ncw;
+
+} /* ldpc_min_sum_decoder_impl::generic_work() */
+
+} /* namespace code */
+} /* namespace fec */
+} /* namespace gr */
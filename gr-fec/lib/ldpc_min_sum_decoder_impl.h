@@ -0,0 +1,92 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_FEC_LDPC_MIN_SUM_DECODER_IMPL_H
+#define INCLUDED_FEC_LDPC_MIN_SUM_DECODER_IMPL_H
+
+#include <gnuradio/fec/ldpc_min_sum_decoder.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace fec {
+namespace code {
+
+class FEC_API ldpc_min_sum_decoder_impl : public ldpc_min_sum_decoder
+{
+private:
+    // Plug into the generic FEC API:
+    int get_input_size() override;  // n, # of bits in the received block
+    int get_output_size() override; // k, # of bits in the info word
+    int d_input_size;
+    int d_output_size;
+
+    double d_rate;
+
+    unsigned int d_n; // code word length
+    unsigned int d_k; // info word length
+
+    // Tanner graph, check node by check node: the variables of
+    // check c are d_check_vars[d_check_offsets[c]] up to
+    // d_check_vars[d_check_offsets[c + 1] - 1].
+    std::vector<unsigned int> d_check_offsets;
+    std::vector<unsigned int> d_check_vars;
+    unsigned int d_max_check_degree;
+
+    // Position of each info bit in the code word
+    std::vector<unsigned int> d_info_bits;
+
+    unsigned int d_max_iterations;
+    float d_iterations;
+
+    bool d_offset;
+    int d_message_bits;
+    int d_correction; // normalization factor in 1/16ths, or fixed point offset
+
+    // Working memory, lane-interleaved: value i of lane l at i * lanes + l
+    std::vector<int16_t> d_llr;   // a-posteriori values, n per lane
+    std::vector<int8_t> d_msg8;   // check to variable messages, one per edge,
+    std::vector<int16_t> d_msg16; // for 8 and 16 bit messages respectively
+    std::vector<int16_t> d_q;     // variable to check messages of one check
+
+    template <class T, unsigned int W>
+    unsigned int decode_lanes(const float* in, unsigned char* out, unsigned int ncw);
+
+    // Deactivates the lanes whose hard decisions satisfy all checks and
+    // returns whether any lane is left.
+    template <unsigned int W>
+    bool update_active(unsigned char* active);
+
+public:
+    /*!
+     * \param n code word length
+     * \param checks the variables taking part in each parity check
+     * \param info_bits position of each info bit in the code word
+     */
+    ldpc_min_sum_decoder_impl(unsigned int n,
+                              const std::vector<std::vector<unsigned int>>& checks,
+                              const std::vector<unsigned int>& info_bits,
+                              unsigned int max_iter,
+                              float correction,
+                              bool offset,
+                              int message_bits);
+    ~ldpc_min_sum_decoder_impl() override;
+
+    void generic_work(void* inbuffer, void* outbuffer) override;
+    bool set_frame_size(unsigned int frame_size) override;
+    double rate() override;
+    float get_iterations() override;
+};
+
+} /* namespace code */
+} /* namespace fec */
+} /* namespace gr */
+
+#endif /* INCLUDED_FEC_LDPC_MIN_SUM_DECODER_IMPL_H */
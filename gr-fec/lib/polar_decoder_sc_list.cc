@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <stdexcept>
 
 namespace gr {
 namespace fec {
@@ -28,24 +29,37 @@ generic_decoder::sptr polar_decoder_sc_list::make(int max_list_size,
                                                   int block_size,
                                                   int num_info_bits,
                                                   std::vector<int> frozen_bit_positions,
-                                                  std::vector<uint8_t> frozen_bit_values)
+                                                  std::vector<uint8_t> frozen_bit_values,
+                                                  int crc_size,
+                                                  unsigned int crc_polynomial)
 {
     return generic_decoder::sptr(new polar_decoder_sc_list(max_list_size,
                                                            block_size,
                                                            num_info_bits,
                                                            frozen_bit_positions,
-                                                           frozen_bit_values));
+                                                           frozen_bit_values,
+                                                           crc_size,
+                                                           crc_polynomial));
 }
 
 polar_decoder_sc_list::polar_decoder_sc_list(int max_list_size,
                                              int block_size,
                                              int num_info_bits,
                                              std::vector<int> frozen_bit_positions,
-                                             std::vector<uint8_t> frozen_bit_values)
+                                             std::vector<uint8_t> frozen_bit_values,
+                                             int crc_size,
+                                             unsigned int crc_polynomial)
     : polar_decoder_common(
           block_size, num_info_bits, frozen_bit_positions, frozen_bit_values),
+      d_crc_size(crc_size),
+      d_crc_polynomial(crc_polynomial),
+      d_info_bits(num_info_bits),
       d_scl(std::make_unique<polar::scl_list>(max_list_size, block_size, block_power()))
 {
+    if (crc_size < 0 || crc_size > 32 || crc_size >= num_info_bits) {
+        throw std::invalid_argument(
+            "polar_decoder_sc_list: crc_size must be in [0, 32] and < num_info_bits");
+    }
 }
 
 polar_decoder_sc_list::~polar_decoder_sc_list() {}
@@ -64,6 +78,7 @@ void polar_decoder_sc_list::initialize_list(const float* in_buf)
 {
     polar::path* init_path = d_scl->initial_path();
     initialize_decoder(init_path->u_vec, init_path->llr_vec, in_buf);
+    d_scl->share_channel_llrs();
 }
 
 const unsigned char* polar_decoder_sc_list::decode_list()
@@ -71,7 +86,39 @@ const unsigned char* polar_decoder_sc_list::decode_list()
     for (int u_num = 0; u_num < block_size(); u_num++) {
         decode_bit(u_num);
     }
-    return d_scl->optimal_path()->u_vec;
+    if (d_crc_size == 0) {
+        return d_scl->optimal_path()->u_vec;
+    }
+
+    const std::vector<const polar::path*> ranked = d_scl->ranked_paths();
+    for (const polar::path* p : ranked) {
+        extract_info_bits(d_info_bits.data(), p->u_vec);
+        if (crc_passes(d_info_bits.data())) {
+            return p->u_vec;
+        }
+    }
+    return ranked.front()->u_vec;
+}
+
+bool polar_decoder_sc_list::crc_passes(const unsigned char* info_bits) const
+{
+    const int num_data_bits = d_info_bits.size() - d_crc_size;
+    const uint64_t top = uint64_t(1) << (d_crc_size - 1);
+    const uint64_t mask = (top << 1) - 1;
+    uint64_t reg = 0;
+    for (int i = 0; i < num_data_bits; i++) {
+        const bool feedback = ((reg & top) != 0) != (info_bits[i] != 0);
+        reg = (reg << 1) & mask;
+        if (feedback) {
+            reg ^= d_crc_polynomial & mask;
+        }
+    }
+    for (int i = 0; i < d_crc_size; i++) {
+        if (((reg >> (d_crc_size - 1 - i)) & 1) != info_bits[num_data_bits + i]) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void polar_decoder_sc_list::decode_bit(const int u_num)
@@ -83,7 +130,7 @@ void polar_decoder_sc_list::decode_bit(const int u_num)
 void polar_decoder_sc_list::calculate_llrs_for_list(const int u_num)
 {
     for (unsigned int i = 0; i < d_scl->active_size(); i++) {
-        polar::path* current_path = d_scl->next_active_path();
+        polar::path* current_path = d_scl->next_active_path(u_num);
         butterfly(current_path->llr_vec, current_path->u_vec, 0, u_num, u_num);
     }
 }
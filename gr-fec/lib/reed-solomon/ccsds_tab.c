@@ -43,3 +43,70 @@ char CCSDS_poly[] = {
  24,  5,170, 66, 50,213,  3, 30, 97,251,126, 43,  4, 66, 59,249,
   0,
 };
+
+char CCSDS_syndrome_tables[] = {
+0x00,0x15,0x2a,0x3f,0x54,0x41,0x7e,0x6b,0xa8,0xbd,0x82,0x97,0xfc,0xe9,0xd6,0xc3,
+0x00,0xd7,0x29,0xfe,0x52,0x85,0x7b,0xac,0xa4,0x73,0x8d,0x5a,0xf6,0x21,0xdf,0x08,
+0x00,0x64,0xc8,0xac,0x17,0x73,0xdf,0xbb,0x2e,0x4a,0xe6,0x82,0x39,0x5d,0xf1,0x95,
+0x00,0x5c,0xb8,0xe4,0xf7,0xab,0x4f,0x13,0x69,0x35,0xd1,0x8d,0x9e,0xc2,0x26,0x7a,
+0x00,0x8c,0x9f,0x13,0xb9,0x35,0x26,0xaa,0xf5,0x79,0x6a,0xe6,0x4c,0xc0,0xd3,0x5f,
+0x00,0x6d,0xda,0xb7,0x33,0x5e,0xe9,0x84,0x66,0x0b,0xbc,0xd1,0x55,0x38,0x8f,0xe2,
+0x00,0x7c,0xf8,0x84,0x77,0x0b,0x8f,0xf3,0xee,0x92,0x16,0x6a,0x99,0xe5,0x61,0x1d,
+0x00,0x5b,0xb6,0xed,0xeb,0xb0,0x5d,0x06,0x51,0x0a,0xe7,0xbc,0xba,0xe1,0x0c,0x57,
+0x00,0x02,0x04,0x06,0x08,0x0a,0x0c,0x0e,0x10,0x12,0x14,0x16,0x18,0x1a,0x1c,0x1e,
+0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0x87,0xa7,0xc7,0xe7,0x07,0x27,0x47,0x67,
+0x00,0xdd,0x3d,0xe0,0x7a,0xa7,0x47,0x9a,0xf4,0x29,0xc9,0x14,0x8e,0x53,0xb3,0x6e,
+0x00,0x6f,0xde,0xb1,0x3b,0x54,0xe5,0x8a,0x76,0x19,0xa8,0xc7,0x4d,0x22,0x93,0xfc,
+0x00,0xfb,0x71,0x8a,0xe2,0x19,0x93,0x68,0x43,0xb8,0x32,0xc9,0xa1,0x5a,0xd0,0x2b,
+0x00,0x86,0x8b,0x0d,0x91,0x17,0x1a,0x9c,0xa5,0x23,0x2e,0xa8,0x34,0xb2,0xbf,0x39,
+0x00,0x74,0xe8,0x9c,0x57,0x23,0xbf,0xcb,0xae,0xda,0x46,0x32,0xf9,0x8d,0x11,0x65,
+0x00,0xdb,0x31,0xea,0x62,0xb9,0x53,0x88,0xc4,0x1f,0xf5,0x2e,0xa6,0x7d,0x97,0x4c,
+0x00,0x78,0xf0,0x88,0x67,0x1f,0x97,0xef,0xce,0xb6,0x3e,0x46,0xa9,0xd1,0x59,0x21,
+0x00,0x1b,0x36,0x2d,0x6c,0x77,0x5a,0x41,0xd8,0xc3,0xee,0xf5,0xb4,0xaf,0x82,0x99,
+0x00,0x3f,0x7e,0x41,0xfc,0xc3,0x82,0xbd,0x7f,0x40,0x01,0x3e,0x83,0xbc,0xfd,0xc2,
+0x00,0xfe,0x7b,0x85,0xf6,0x08,0x8d,0x73,0x6b,0x95,0x10,0xee,0x9d,0x63,0xe6,0x18,
+0x00,0xac,0xdf,0x73,0x39,0x95,0xe6,0x4a,0x72,0xde,0xad,0x01,0x4b,0xe7,0x94,0x38,
+0x00,0xe4,0x4f,0xab,0x9e,0x7a,0xd1,0x35,0xbb,0x5f,0xf4,0x10,0x25,0xc1,0x6a,0x8e,
+0x00,0x13,0x26,0x35,0x4c,0x5f,0x6a,0x79,0x98,0x8b,0xbe,0xad,0xd4,0xc7,0xf2,0xe1,
+0x00,0xb7,0xe9,0x5e,0x55,0xe2,0xbc,0x0b,0xaa,0x1d,0x43,0xf4,0xff,0x48,0x16,0xa1,
+0x00,0x84,0x8f,0x0b,0x99,0x1d,0x16,0x92,0xb5,0x31,0x3a,0xbe,0x2c,0xa8,0xa3,0x27,
+0x00,0xed,0x5d,0xb0,0xba,0x57,0xe7,0x0a,0xf3,0x1e,0xae,0x43,0x49,0xa4,0x14,0xf9,
+0x00,0x06,0x0c,0x0a,0x18,0x1e,0x14,0x12,0x30,0x36,0x3c,0x3a,0x28,0x2e,0x24,0x22,
+0x00,0x60,0xc0,0xa0,0x07,0x67,0xc7,0xa7,0x0e,0x6e,0xce,0xae,0x09,0x69,0xc9,0xa9,
+0x00,0xe0,0x47,0xa7,0x8e,0x6e,0xc9,0x29,0x9b,0x7b,0xdc,0x3c,0x15,0xf5,0x52,0xb2,
+0x00,0xb1,0xe5,0x54,0x4d,0xfc,0xa8,0x19,0x9a,0x2b,0x7f,0xce,0xd7,0x66,0x32,0x83,
+0x00,0x8a,0x93,0x19,0xa1,0x2b,0x32,0xb8,0xc5,0x4f,0x56,0xdc,0x64,0xee,0xf7,0x7d,
+0x00,0x0d,0x1a,0x17,0x34,0x39,0x2e,0x23,0x68,0x65,0x72,0x7f,0x5c,0x51,0x46,0x4b,
+0x00,0x9c,0xbf,0x23,0xf9,0x65,0x46,0xda,0x75,0xe9,0xca,0x56,0x8c,0x10,0x33,0xaf,
+0x00,0xea,0x53,0xb9,0xa6,0x4c,0xf5,0x1f,0xcb,0x21,0x98,0x72,0x6d,0x87,0x3e,0xd4,
+0x00,0x88,0x97,0x1f,0xa9,0x21,0x3e,0xb6,0xd5,0x5d,0x42,0xca,0x7c,0xf4,0xeb,0x63,
+0x00,0x2d,0x5a,0x77,0xb4,0x99,0xee,0xc3,0xef,0xc2,0xb5,0x98,0x5b,0x76,0x01,0x2c,
+0x00,0x41,0x82,0xc3,0x83,0xc2,0x01,0x40,0x81,0xc0,0x03,0x42,0x02,0x43,0x80,0xc1,
+0x00,0x85,0x8d,0x08,0x9d,0x18,0x10,0x95,0xbd,0x38,0x30,0xb5,0x20,0xa5,0xad,0x28,
+0x00,0x73,0xe6,0x95,0x4b,0x38,0xad,0xde,0x96,0xe5,0x70,0x03,0xdd,0xae,0x3b,0x48,
+0x00,0xab,0xd1,0x7a,0x25,0x8e,0xf4,0x5f,0x4a,0xe1,0x9b,0x30,0x6f,0xc4,0xbe,0x15,
+0x00,0x35,0x6a,0x5f,0xd4,0xe1,0xbe,0x8b,0x2f,0x1a,0x45,0x70,0xfb,0xce,0x91,0xa4,
+0x00,0x5e,0xbc,0xe2,0xff,0xa1,0x43,0x1d,0x79,0x27,0xc5,0x9b,0x86,0xd8,0x3a,0x64,
+0x00,0x0b,0x16,0x1d,0x2c,0x27,0x3a,0x31,0x58,0x53,0x4e,0x45,0x74,0x7f,0x62,0x69,
+0x00,0xb0,0xe7,0x57,0x49,0xf9,0xae,0x1e,0x92,0x22,0x75,0xc5,0xdb,0x6b,0x3c,0x8c,
+0x00,0x0a,0x14,0x1e,0x28,0x22,0x3c,0x36,0x50,0x5a,0x44,0x4e,0x78,0x72,0x6c,0x66,
+0x00,0xa0,0xc7,0x67,0x09,0xa9,0xce,0x6e,0x12,0xb2,0xd5,0x75,0x1b,0xbb,0xdc,0x7c,
+0x00,0xa7,0xc9,0x6e,0x15,0xb2,0xdc,0x7b,0x2a,0x8d,0xe3,0x44,0x3f,0x98,0xf6,0x51,
+0x00,0x54,0xa8,0xfc,0xd7,0x83,0x7f,0x2b,0x29,0x7d,0x81,0xd5,0xfe,0xaa,0x56,0x02,
+0x00,0x19,0x32,0x2b,0x64,0x7d,0x56,0x4f,0xc8,0xd1,0xfa,0xe3,0xac,0xb5,0x9e,0x87,
+0x00,0x17,0x2e,0x39,0x5c,0x4b,0x72,0x65,0xb8,0xaf,0x96,0x81,0xe4,0xf3,0xca,0xdd,
+0x00,0x23,0x46,0x65,0x8c,0xaf,0xca,0xe9,0x9f,0xbc,0xd9,0xfa,0x13,0x30,0x55,0x76,
+0x00,0xb9,0xf5,0x4c,0x6d,0xd4,0x98,0x21,0xda,0x63,0x2f,0x96,0xb7,0x0e,0x42,0xfb,
+0x00,0x1f,0x3e,0x21,0x7c,0x63,0x42,0x5d,0xf8,0xe7,0xc6,0xd9,0x84,0x9b,0xba,0xa5,
+0x00,0x77,0xee,0x99,0x5b,0x2c,0xb5,0xc2,0xb6,0xc1,0x58,0x2f,0xed,0x9a,0x03,0x74,
+0x00,0xc3,0x01,0xc2,0x02,0xc1,0x03,0xc0,0x04,0xc7,0x05,0xc6,0x06,0xc5,0x07,0xc4,
+0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78,
+0x00,0x95,0xad,0x38,0xdd,0x48,0x70,0xe5,0x3d,0xa8,0x90,0x05,0xe0,0x75,0x4d,0xd8,
+0x00,0x7a,0xf4,0x8e,0x6f,0x15,0x9b,0xe1,0xde,0xa4,0x2a,0x50,0xb1,0xcb,0x45,0x3f,
+0x00,0x5f,0xbe,0xe1,0xfb,0xa4,0x45,0x1a,0x71,0x2e,0xcf,0x90,0x8a,0xd5,0x34,0x6b,
+0x00,0xe2,0x43,0xa1,0x86,0x64,0xc5,0x27,0x8b,0x69,0xc8,0x2a,0x0d,0xef,0x4e,0xac,
+0x00,0x1d,0x3a,0x27,0x74,0x69,0x4e,0x53,0xe8,0xf5,0xd2,0xcf,0x9c,0x81,0xa6,0xbb,
+0x00,0x57,0xae,0xf9,0xdb,0x8c,0x75,0x22,0x31,0x66,0x9f,0xc8,0xea,0xbd,0x44,0x13,
+0x00,0x1e,0x3c,0x22,0x78,0x66,0x44,0x5a,0xf0,0xee,0xcc,0xd2,0x88,0x96,0xb4,0xaa,
+0x00,0x67,0xce,0xa9,0x1b,0x7c,0xd5,0xb2,0x36,0x51,0xf8,0x9f,0x2d,0x4a,0xe3,0x84,
+};
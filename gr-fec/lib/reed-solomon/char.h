@@ -20,6 +20,7 @@ struct rs {
     unsigned char prim;      /* Primitive element, index form */
     unsigned char iprim;     /* prim-th root of 1, index form */
     int* modnn_table;        /* modnn lookup table, 512 entries */
+    unsigned char* syn_tables; /* Root multiplication tables, see syndrome.h */
 };
 
 static inline unsigned int modnn(struct rs* rs, unsigned int x)
@@ -0,0 +1,47 @@
+/* Batch Reed-Solomon decoder for character symbols
+ *
+ * Copyright 2023 Free Software Foundation, Inc.
+ * May be used under the terms of the GNU General Public License (GPL)
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "char.h"
+#include "syndrome.h"
+#include <string.h>
+
+int decode_rs_char_batch(void* p, unsigned char* data, int len, int count, int* results)
+{
+    struct rs* rs = (struct rs*)p;
+    unsigned char block[256];
+    int pad = NN - len;
+    int failures = 0;
+    int b, i;
+
+    for (b = 0; b < count; b += RS_BATCH) {
+        int n = count - b < RS_BATCH ? count - b : RS_BATCH;
+        unsigned int mask =
+            rs_batch_syndromes(rs->syn_tables, NROOTS, &data[b * len], len, n, NULL);
+
+        for (i = 0; i < n; i++) {
+            unsigned char* cw = &data[(b + i) * len];
+            int r = 0;
+
+            if (mask & (1u << i)) {
+                /* Restore the zero padding of shortened codewords */
+                memset(block, 0, pad);
+                memcpy(&block[pad], cw, len);
+                r = decode_rs_char(rs, block, NULL, 0);
+                if (r > 0)
+                    memcpy(cw, &block[pad], len);
+                else if (r < 0)
+                    failures++;
+            }
+            if (results != NULL)
+                results[b + i] = r;
+        }
+    }
+    return failures;
+}
@@ -8,6 +8,8 @@
 #define FIXED 1
 #include "ccsds.h"
 #include "fixed.h"
+#include "syndrome.h"
+#include <string.h>
 
 int decode_rs_ccsds(unsigned char* data, int* eras_pos, int no_eras)
 {
@@ -27,3 +29,57 @@ int decode_rs_ccsds(unsigned char* data, int* eras_pos, int no_eras)
     }
     return r;
 }
+
+/* Batch decoding, see decode_rs_char_batch(). The dual basis variant
+ * converts the data to the conventional basis on the fly for the
+ * syndrome check, so error free codewords are never converted.
+ */
+static int decode_batch(unsigned char* data,
+                        int len,
+                        int count,
+                        int* results,
+                        const unsigned char* to_conventional,
+                        const unsigned char* to_dual)
+{
+    unsigned char block[NN];
+    int pad = NN - len;
+    int failures = 0;
+    int b, i, j;
+
+    for (b = 0; b < count; b += RS_BATCH) {
+        int n = count - b < RS_BATCH ? count - b : RS_BATCH;
+        unsigned int mask = rs_batch_syndromes(
+            CCSDS_syndrome_tables, NROOTS, &data[b * len], len, n, to_conventional);
+
+        for (i = 0; i < n; i++) {
+            unsigned char* cw = &data[(b + i) * len];
+            int r = 0;
+
+            if (mask & (1u << i)) {
+                memset(block, 0, pad);
+                for (j = 0; j < len; j++)
+                    block[pad + j] = to_conventional ? to_conventional[cw[j]] : cw[j];
+                r = decode_rs_8(block, NULL, 0);
+                if (r > 0) {
+                    for (j = 0; j < len; j++)
+                        cw[j] = to_dual ? to_dual[block[pad + j]] : block[pad + j];
+                } else if (r < 0) {
+                    failures++;
+                }
+            }
+            if (results != NULL)
+                results[b + i] = r;
+        }
+    }
+    return failures;
+}
+
+int decode_rs_8_batch(unsigned char* data, int len, int count, int* results)
+{
+    return decode_batch(data, len, count, results, NULL, NULL);
+}
+
+int decode_rs_ccsds_batch(unsigned char* data, int len, int count, int* results)
+{
+    return decode_batch(data, len, count, results, Tal1tab, Taltab);
+}
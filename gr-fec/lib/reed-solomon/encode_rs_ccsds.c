@@ -21,6 +21,6 @@ void encode_rs_ccsds(unsigned char* data, unsigned char* parity)
     encode_rs_8(cdata, parity);
 
     /* Convert parity from conventional to dual basis */
-    for (i = 0; i < NN - NROOTS; i++)
+    for (i = 0; i < NROOTS; i++)
         parity[i] = Taltab[parity[i]];
 }
@@ -22,6 +22,7 @@ static inline int mod255(int x)
 extern unsigned char CCSDS_alpha_to[];
 extern unsigned char CCSDS_index_of[];
 extern unsigned char CCSDS_poly[];
+extern unsigned char CCSDS_syndrome_tables[];
 
 #define MM 8
 #define NN 255
@@ -3,6 +3,7 @@
  * May be used under the terms of the GNU General Public License (GPL)
  */
 #include "char.h"
+#include "syndrome.h"
 #include <stdio.h>
 
 int main()
@@ -30,6 +31,12 @@ int main()
 
         printf("%3d,", rs->genpoly[i]);
     }
+    printf("\n};\n\nunsigned char CCSDS_syndrome_tables[] = {");
+    for (i = 0; i < 32 * RS_SYN_TABLE_SIZE; i++) {
+        if ((i % 16) == 0)
+            printf("\n");
+        printf("0x%02x,", rs->syn_tables[i]);
+    }
     printf("\n};\n");
     exit(0);
 }
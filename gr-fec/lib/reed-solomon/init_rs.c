@@ -12,6 +12,7 @@
 #else
 #include "char.h"
 #endif
+#include "syndrome.h"
 
 #ifndef NULL
 #define NULL ((void*)0)
@@ -28,6 +29,7 @@ void FREE_RS(void* p)
 #elif defined(BIGSYM)
 #else
     free(rs->modnn_table);
+    free(rs->syn_tables);
 #endif
     free(rs);
 }
@@ -150,6 +152,19 @@ void* INIT_RS(unsigned int symsize,
         j = i;
         rs->modnn_table[i] = modnn(rs, j);
     }
+
+    /* Form root multiplication tables for batch decoding */
+    rs->syn_tables = (unsigned char*)malloc(RS_SYN_TABLE_SIZE * nroots + 1);
+    if (rs->syn_tables == NULL) {
+        free(rs->modnn_table);
+        free(rs->genpoly);
+        free(rs->alpha_to);
+        free(rs->index_of);
+        free(rs);
+        return NULL;
+    }
+    rs_syndrome_tables(
+        rs->syn_tables, rs->alpha_to, rs->index_of, rs->nn, fcr, prim, nroots);
 #endif
 
 #if 0
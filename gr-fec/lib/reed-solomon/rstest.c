@@ -12,6 +12,7 @@
 #include <gnuradio/fec/rs.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 int exercise_char(void*, int);
@@ -51,6 +52,73 @@ struct {
     { 0, 0, 0, 0, 0 },
 };
 
+/* Decode a batch of shortened codewords, some of them with errors, and
+ * compare with the transmitted data. encode is called on a full zero
+ * padded block of nn symbols.
+ */
+static int exercise_batch(void* handle,
+                          int nn,
+                          int nroots,
+                          int pad,
+                          void (*encode)(void*, unsigned char*, unsigned char*),
+                          int (*decode)(void*, unsigned char*, int, int, int*))
+{
+    enum { COUNT = 37 };
+    int len = nn - pad;
+    unsigned char* sent = malloc(COUNT * len);
+    unsigned char* received = malloc(COUNT * len);
+    unsigned char block[256];
+    int results[COUNT];
+    int errors[COUNT];
+    int i, j, failures, decoder_errors = 0;
+
+    for (i = 0; i < COUNT; i++) {
+        memset(block, 0, pad);
+        for (j = pad; j < nn - nroots; j++)
+            block[j] = rand() & nn;
+        encode(handle, block, &block[nn - nroots]);
+        memcpy(&sent[i * len], &block[pad], len);
+        memcpy(&received[i * len], &block[pad], len);
+
+        /* Every third codeword error free, the others up to capacity */
+        errors[i] = (i % 3 == 0) ? 0 : 1 + i % (nroots / 2);
+        for (j = 0; j < errors[i]; j++)
+            received[i * len + (j * 7 + i) % len] ^= 1 + j % nn;
+    }
+
+    failures = decode(handle, received, len, COUNT, results);
+    if (failures != 0 || memcmp(sent, received, COUNT * len) != 0) {
+        printf(" batch decoding failed\n");
+        decoder_errors++;
+    }
+    for (i = 0; i < COUNT; i++) {
+        if (results[i] != errors[i]) {
+            printf(" batch decoder says %d errors, true number is %d\n",
+                   results[i],
+                   errors[i]);
+            decoder_errors++;
+        }
+    }
+    free(sent);
+    free(received);
+    return decoder_errors;
+}
+
+static void encode_char(void* handle, unsigned char* data, unsigned char* parity)
+{
+    encode_rs_char(handle, data, parity);
+}
+
+static void encode_ccsds(void* handle, unsigned char* data, unsigned char* parity)
+{
+    encode_rs_ccsds(data, parity);
+}
+
+static int decode_ccsds(void* handle, unsigned char* data, int len, int count, int* r)
+{
+    return decode_rs_ccsds_batch(data, len, count, r);
+}
+
 int main()
 {
     void* handle;
@@ -77,6 +145,14 @@ int main()
     }
 #endif
 
+    printf("Testing CCSDS batch decoding...");
+    fflush(stdout);
+    errs = exercise_batch(NULL, 255, 32, 51, encode_ccsds, decode_ccsds);
+    terrs += errs;
+    if (errs == 0) {
+        printf("OK\n");
+    }
+
     for (i = 0; Tab[i].symsize != 0; i++) {
         int nn, kk;
 
@@ -94,6 +170,16 @@ int main()
                 continue;
             }
             errs = exercise_char(handle, Tab[i].ntrials);
+            if (Tab[i].nroots >= 2) {
+                errs += exercise_batch(
+                    handle, nn, Tab[i].nroots, 0, encode_char, decode_rs_char_batch);
+                errs += exercise_batch(handle,
+                                       nn,
+                                       Tab[i].nroots,
+                                       nn / 4,
+                                       encode_char,
+                                       decode_rs_char_batch);
+            }
         } else {
 #ifdef ALL_VERSIONS
             if ((handle = init_rs_int(Tab[i].symsize,
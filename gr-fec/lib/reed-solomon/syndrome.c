@@ -0,0 +1,173 @@
+/* Batch syndrome computation for the 8-bit Reed-Solomon codecs
+ *
+ * The syndromes are evaluated for RS_BATCH codewords at a time, one
+ * codeword per byte lane, by Horner's rule. A symbol is multiplied by
+ * the constant root with two 16-entry tables indexed by its nibbles,
+ * which is a single pshufb each where SSSE3 is available.
+ *
+ * Copyright 2023 Free Software Foundation, Inc.
+ * May be used under the terms of the GNU General Public License (GPL)
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "syndrome.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RS_SYN_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+void rs_syndrome_tables(unsigned char* tables,
+                        const unsigned char* alpha_to,
+                        const unsigned char* index_of,
+                        unsigned int nn,
+                        unsigned int fcr,
+                        unsigned int prim,
+                        unsigned int nroots)
+{
+    unsigned int i, x;
+
+    for (i = 0; i < nroots; i++) {
+        unsigned int root = ((fcr + i) * prim) % nn;
+        unsigned char* lo = &tables[i * RS_SYN_TABLE_SIZE];
+        unsigned char* hi = lo + 16;
+
+        for (x = 0; x < 16; x++) {
+            lo[x] = (x == 0 || x > nn) ? 0 : alpha_to[(index_of[x] + root) % nn];
+            hi[x] = (x == 0 || (x << 4) > nn)
+                        ? 0
+                        : alpha_to[(index_of[x << 4] + root) % nn];
+        }
+    }
+}
+
+/* Transpose the batch so that symbol j of all codewords is contiguous */
+static void load_columns(unsigned char* columns,
+                         const unsigned char* data,
+                         unsigned int len,
+                         unsigned int count,
+                         const unsigned char* map)
+{
+    unsigned int c, j;
+
+    if (count < RS_BATCH)
+        memset(columns, 0, len * RS_BATCH);
+    for (c = 0; c < count; c++) {
+        const unsigned char* cw = &data[c * len];
+        if (map != NULL) {
+            for (j = 0; j < len; j++)
+                columns[j * RS_BATCH + c] = map[cw[j]];
+        } else {
+            for (j = 0; j < len; j++)
+                columns[j * RS_BATCH + c] = cw[j];
+        }
+    }
+}
+
+static unsigned int syndromes_generic(const unsigned char* tables,
+                                      unsigned int nroots,
+                                      const unsigned char* columns,
+                                      unsigned int len)
+{
+    unsigned char nonzero[RS_BATCH];
+    unsigned int i, j, c, mask;
+
+    memset(nonzero, 0, sizeof(nonzero));
+    for (i = 0; i < nroots; i++) {
+        const unsigned char* lo = &tables[i * RS_SYN_TABLE_SIZE];
+        const unsigned char* hi = lo + 16;
+        unsigned char s[RS_BATCH];
+
+        memset(s, 0, sizeof(s));
+        for (j = 0; j < len; j++) {
+            const unsigned char* col = &columns[j * RS_BATCH];
+            for (c = 0; c < RS_BATCH; c++)
+                s[c] = lo[s[c] & 0xf] ^ hi[s[c] >> 4] ^ col[c];
+        }
+        for (c = 0; c < RS_BATCH; c++)
+            nonzero[c] |= s[c];
+    }
+
+    mask = 0;
+    for (c = 0; c < RS_BATCH; c++)
+        if (nonzero[c])
+            mask |= 1u << c;
+    return mask;
+}
+
+#ifdef RS_SYN_SSSE3
+__attribute__((target("ssse3"))) static unsigned int
+syndromes_ssse3(const unsigned char* tables,
+                unsigned int nroots,
+                const unsigned char* columns,
+                unsigned int len)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i nonzero = _mm_setzero_si128();
+    unsigned int i, j;
+
+/* s = s * root ^ column */
+#define RS_SYN_STEP(s, lo, hi, col)                                                    \
+    s = _mm_xor_si128(                                                                 \
+        _mm_xor_si128(_mm_shuffle_epi8(lo, _mm_and_si128(s, nibble)),                  \
+                      _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(s, 4), nibble))), \
+        col)
+
+    /* Two roots per pass to overlap the dependency chains */
+    for (i = 0; i + 1 < nroots; i += 2) {
+        const unsigned char* t = &tables[i * RS_SYN_TABLE_SIZE];
+        const __m128i lo0 = _mm_loadu_si128((const __m128i*)t);
+        const __m128i hi0 = _mm_loadu_si128((const __m128i*)(t + 16));
+        const __m128i lo1 = _mm_loadu_si128((const __m128i*)(t + 32));
+        const __m128i hi1 = _mm_loadu_si128((const __m128i*)(t + 48));
+        __m128i s0 = _mm_setzero_si128();
+        __m128i s1 = _mm_setzero_si128();
+
+        for (j = 0; j < len; j++) {
+            const __m128i col = _mm_loadu_si128((const __m128i*)&columns[j * RS_BATCH]);
+            RS_SYN_STEP(s0, lo0, hi0, col);
+            RS_SYN_STEP(s1, lo1, hi1, col);
+        }
+        nonzero = _mm_or_si128(nonzero, _mm_or_si128(s0, s1));
+    }
+    if (i < nroots) {
+        const unsigned char* t = &tables[i * RS_SYN_TABLE_SIZE];
+        const __m128i lo0 = _mm_loadu_si128((const __m128i*)t);
+        const __m128i hi0 = _mm_loadu_si128((const __m128i*)(t + 16));
+        __m128i s0 = _mm_setzero_si128();
+
+        for (j = 0; j < len; j++) {
+            const __m128i col = _mm_loadu_si128((const __m128i*)&columns[j * RS_BATCH]);
+            RS_SYN_STEP(s0, lo0, hi0, col);
+        }
+        nonzero = _mm_or_si128(nonzero, s0);
+    }
+#undef RS_SYN_STEP
+
+    return ~_mm_movemask_epi8(_mm_cmpeq_epi8(nonzero, _mm_setzero_si128())) & 0xffff;
+}
+#endif
+
+unsigned int rs_batch_syndromes(const unsigned char* tables,
+                                unsigned int nroots,
+                                const unsigned char* data,
+                                unsigned int len,
+                                unsigned int count,
+                                const unsigned char* map)
+{
+    unsigned char columns[256 * RS_BATCH];
+    unsigned int mask;
+
+    load_columns(columns, data, len, count, map);
+#ifdef RS_SYN_SSSE3
+    if (__builtin_cpu_supports("ssse3"))
+        mask = syndromes_ssse3(tables, nroots, columns, len);
+    else
+#endif
+        mask = syndromes_generic(tables, nroots, columns, len);
+    return mask & ((1u << count) - 1);
+}
@@ -0,0 +1,40 @@
+/* Batch syndrome computation for the 8-bit Reed-Solomon codecs
+ *
+ * Copyright 2023 Free Software Foundation, Inc.
+ * May be used under the terms of the GNU General Public License (GPL)
+ */
+#ifndef INCLUDED_RS_SYNDROME_H
+#define INCLUDED_RS_SYNDROME_H
+
+/* Codewords checked side by side */
+#define RS_BATCH 16
+
+/* Bytes of multiplication tables per generator root */
+#define RS_SYN_TABLE_SIZE 32
+
+/* Fill the tables used by rs_batch_syndromes, RS_SYN_TABLE_SIZE bytes
+ * per root: the products of the root with the low and with the high
+ * nibble of a symbol. All arguments as in init_rs_char().
+ */
+void rs_syndrome_tables(unsigned char* tables,
+                        const unsigned char* alpha_to,
+                        const unsigned char* index_of,
+                        unsigned int nn,
+                        unsigned int fcr,
+                        unsigned int prim,
+                        unsigned int nroots);
+
+/* Evaluate count <= RS_BATCH codewords of len symbols each, stored back
+ * to back, at all roots of the generator. Leading symbols of shortened
+ * codewords are zero and need not be stored. Symbols are translated
+ * through map first if it is not NULL. Returns a bit mask of the
+ * codewords with a nonzero syndrome.
+ */
+unsigned int rs_batch_syndromes(const unsigned char* tables,
+                                unsigned int nroots,
+                                const unsigned char* data,
+                                unsigned int len,
+                                unsigned int count,
+                                const unsigned char* map);
+
+#endif /* INCLUDED_RS_SYNDROME_H */
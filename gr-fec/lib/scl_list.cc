@@ -11,6 +11,7 @@
 #include "scl_list.h"
 #include <volk/volk.h>
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 namespace gr {
@@ -21,120 +22,182 @@ namespace polar {
 scl_list::scl_list(const unsigned int size,
                    const unsigned int block_size,
                    const unsigned int block_power)
-    : d_list_size(size), d_num_buff_elements(block_size * (block_power + 1))
+    : d_list_size(size),
+      d_block_size(block_size),
+      d_block_power(block_power),
+      d_num_buff_elements(block_size * (block_power + 1))
 {
-    for (unsigned int i = 0; i < 2 * size; i++) {
-        d_path_list.push_back(new path());
-    }
-
     for (unsigned int i = 0; i < size; i++) {
-        d_path_list[i]->llr_vec = (float*)volk_malloc(sizeof(float) * d_num_buff_elements,
-                                                      volk_get_alignment());
-        memset(d_path_list[i]->llr_vec, 0, sizeof(float) * d_num_buff_elements);
-        d_path_list[i]->u_vec = (unsigned char*)volk_malloc(
+        float* llr_vec = (float*)volk_malloc(sizeof(float) * d_num_buff_elements,
+                                             volk_get_alignment());
+        memset(llr_vec, 0, sizeof(float) * d_num_buff_elements);
+        d_llr_buffers.push_back(llr_vec);
+        unsigned char* u_vec = (unsigned char*)volk_malloc(
             sizeof(unsigned char) * d_num_buff_elements, volk_get_alignment());
-        memset(d_path_list[i]->u_vec, 0, sizeof(unsigned char) * d_num_buff_elements);
-        d_path_list[i]->owns_vectors = true;
+        memset(u_vec, 0, sizeof(unsigned char) * d_num_buff_elements);
+        d_u_buffers.push_back(u_vec);
     }
+    d_ref_count.resize(size);
+    d_free_buffers.reserve(size);
+    d_path_list.reserve(size);
+    d_next_list.reserve(size);
+    d_candidates.reserve(2 * size);
 
-    d_path_list[0]->is_active = true;
-    d_active_path_counter = 1;
-    d_active_pos = 0;
+    initial_path();
 }
 
 scl_list::~scl_list()
 {
-    for (unsigned int i = 0; i < d_path_list.size(); i++) {
-        delete d_path_list[i];
+    for (unsigned int i = 0; i < d_list_size; i++) {
+        volk_free(d_llr_buffers[i]);
+        volk_free(d_u_buffers[i]);
     }
 }
 
+path* scl_list::initial_path()
+{
+    d_free_buffers.clear();
+    for (unsigned int i = d_list_size; i-- > 1;) {
+        d_ref_count[i] = 0;
+        d_free_buffers.push_back(i);
+    }
+    d_ref_count[0] = 1;
+
+    d_path_list.clear();
+    d_path_list.push_back({ 0.0f, 0, -1, 0, d_llr_buffers[0], d_u_buffers[0] });
+    d_active_pos = 0;
+    return &d_path_list[0];
+}
 
-const path* scl_list::optimal_path()
+void scl_list::share_channel_llrs()
+{
+    const unsigned int offset = d_block_size * d_block_power;
+    for (unsigned int i = 1; i < d_list_size; i++) {
+        memcpy(d_llr_buffers[i] + offset,
+               d_llr_buffers[0] + offset,
+               sizeof(float) * d_block_size);
+    }
+}
+
+path* scl_list::next_active_path(const int u_num)
 {
-    const path* temp = *std::min_element(
-        d_path_list.begin(), d_path_list.begin() + d_active_path_counter, path_compare);
-    reset();
-    return temp;
+    path& p = d_path_list[d_active_pos++];
+    make_writable(p, u_num);
+    return &p;
 }
 
-void scl_list::reset()
+void scl_list::make_writable(path& p, const int u_num)
 {
-    // leave 0th element active for next iteration
-    d_path_list[0]->path_metric = 0.0f;
-    for (unsigned int i = 1; i < d_path_list.size(); i++) {
-        d_path_list[i]->is_active = false;
-        d_path_list[i]->path_metric = 0.0f;
+    if (d_ref_count[p.buffer] > 1) {
+        const unsigned int target = d_free_buffers.back();
+        d_free_buffers.pop_back();
+        copy_live_memory(target, p.buffer, u_num);
+        d_ref_count[p.buffer]--;
+        d_ref_count[target] = 1;
+        p.buffer = target;
+    }
+    p.llr_vec = d_llr_buffers[p.buffer];
+    p.u_vec = d_u_buffers[p.buffer];
+    if (p.pending_pos >= 0) {
+        p.u_vec[p.pending_pos] = p.pending_bit;
+        p.pending_pos = -1;
     }
-    d_active_path_counter = 1;
-    d_active_pos = 0;
 }
 
-void scl_list::set_info_bit(const int bit_pos)
+/*
+ * Decoding bit u_num recomputes the LLRs of the stages up to the number
+ * of trailing zeros of u_num, from the block of the next stage that
+ * holds row u_num. Those blocks, one per stage, and the decided bits
+ * are all later bits depend on. The channel LLRs in the last stage are
+ * the same in every buffer.
+ */
+void scl_list::copy_live_memory(const unsigned int target,
+                                const unsigned int source,
+                                const int u_num)
 {
-    if (d_active_path_counter < d_list_size) {
-        const int offset = d_active_path_counter;
-        for (int i = 0; i < offset; i++) {
-            duplicate_path(d_path_list[i + offset], d_path_list[i]);
-            d_path_list[i]->path_metric = update_path_metric(
-                d_path_list[i]->path_metric, d_path_list[i]->llr_vec[bit_pos], 0);
-            d_path_list[i + offset]->path_metric =
-                update_path_metric(d_path_list[i + offset]->path_metric,
-                                   d_path_list[i + offset]->llr_vec[bit_pos],
-                                   1);
-            d_path_list[i]->u_vec[bit_pos] = 0;
-            d_path_list[i + offset]->u_vec[bit_pos] = 1;
-        }
-    } else {
-
-        for (unsigned int i = 0; i < d_list_size; i++) {
-            branch_paths(d_path_list[i + d_list_size],
-                         d_path_list[i],
-                         d_path_list[i]->llr_vec[bit_pos]);
-        }
-        std::sort(d_path_list.begin(), d_path_list.end(), path_compare);
-
-        for (unsigned int i = 0; i < d_list_size; i++) {
-            if (!d_path_list[i]->owns_vectors) {
-                int t_pos = d_list_size;
-                while (!d_path_list[t_pos]->owns_vectors) {
-                    t_pos++;
-                }
-                steal_vector_ownership(d_path_list[i], d_path_list[t_pos]);
-                d_path_list[i]->u_vec[bit_pos] = 1;
-            } else {
-                d_path_list[i]->u_vec[bit_pos] = 0;
-            }
-        }
+    memcpy(d_u_buffers[target], d_u_buffers[source], sizeof(unsigned char) * u_num);
+
+    unsigned int depth = 0;
+    while (depth < d_block_power && ((u_num >> depth) & 1) == 0) {
+        depth++;
+    }
+    for (unsigned int stage = depth + 1; stage < d_block_power; stage++) {
+        const unsigned int block = 1 << stage;
+        const unsigned int offset = stage * d_block_size + (u_num & ~(block - 1));
+        memcpy(d_llr_buffers[target] + offset,
+               d_llr_buffers[source] + offset,
+               sizeof(float) * block);
     }
-    d_active_pos = 0;
 }
 
-void scl_list::branch_paths(path* target, path* original, const float llr)
+void scl_list::release(const path& p)
 {
-    target->path_metric = update_path_metric(original->path_metric, llr, 1);
-    original->path_metric = update_path_metric(original->path_metric, llr, 0);
-    target->llr_vec = original->llr_vec;
-    target->u_vec = original->u_vec;
+    if (--d_ref_count[p.buffer] == 0) {
+        d_free_buffers.push_back(p.buffer);
+    }
 }
 
-void scl_list::steal_vector_ownership(path* target, path* original)
+void scl_list::flush_pending_bits()
 {
-    memcpy(original->llr_vec, target->llr_vec, sizeof(float) * d_num_buff_elements);
-    memcpy(original->u_vec, target->u_vec, sizeof(unsigned char) * d_num_buff_elements);
-    target->llr_vec = original->llr_vec;
-    target->u_vec = original->u_vec;
-    target->owns_vectors = true;
-    original->owns_vectors = false;
+    for (path& p : d_path_list) {
+        make_writable(p, d_block_size);
+    }
 }
 
-void scl_list::duplicate_path(path* target, const path* original)
+const path* scl_list::optimal_path()
+{
+    flush_pending_bits();
+    return &*std::min_element(
+        d_path_list.begin(), d_path_list.end(), [](const path& a, const path& b) {
+            return a.path_metric < b.path_metric;
+        });
+}
+
+std::vector<const path*> scl_list::ranked_paths()
 {
-    memcpy(target->llr_vec, original->llr_vec, sizeof(float) * d_num_buff_elements);
-    memcpy(target->u_vec, original->u_vec, sizeof(unsigned char) * d_num_buff_elements);
-    target->path_metric = original->path_metric;
-    d_active_path_counter++;
-    target->is_active = true;
+    flush_pending_bits();
+    std::vector<const path*> ranked;
+    for (const path& p : d_path_list) {
+        ranked.push_back(&p);
+    }
+    std::sort(ranked.begin(), ranked.end(), path_compare);
+    return ranked;
+}
+
+void scl_list::set_info_bit(const int bit_pos)
+{
+    d_candidates.clear();
+    for (unsigned int i = 0; i < d_path_list.size(); i++) {
+        const path& p = d_path_list[i];
+        const float llr = p.llr_vec[bit_pos];
+        d_candidates.push_back({ update_path_metric(p.path_metric, llr, 0), i, 0 });
+        d_candidates.push_back({ update_path_metric(p.path_metric, llr, 1), i, 1 });
+    }
+    if (d_candidates.size() > d_list_size) {
+        std::nth_element(d_candidates.begin(),
+                         d_candidates.begin() + d_list_size,
+                         d_candidates.end(),
+                         candidate_compare);
+        d_candidates.resize(d_list_size);
+    }
+
+    // Surviving branches share the memory of their parent.
+    d_next_list.clear();
+    for (const candidate& c : d_candidates) {
+        const path& parent = d_path_list[c.parent];
+        d_ref_count[parent.buffer]++;
+        d_next_list.push_back({ c.path_metric,
+                                parent.buffer,
+                                bit_pos,
+                                c.bit,
+                                parent.llr_vec,
+                                parent.u_vec });
+    }
+    for (const path& p : d_path_list) {
+        release(p);
+    }
+    d_path_list.swap(d_next_list);
+    d_active_pos = 0;
 }
 
 float scl_list::update_path_metric(const float last_pm,
@@ -150,27 +213,15 @@ float scl_list::update_path_metric(const float last_pm,
 
 void scl_list::set_frozen_bit(const unsigned char frozen_bit, const int bit_pos)
 {
-    for (unsigned int i = 0; i < d_active_path_counter; i++) {
-        d_path_list[i]->u_vec[bit_pos] = frozen_bit;
-        d_path_list[i]->path_metric = update_path_metric(
-            d_path_list[i]->path_metric, d_path_list[i]->llr_vec[bit_pos], frozen_bit);
+    // Every path was made writable to calculate its LLRs for this bit.
+    for (path& p : d_path_list) {
+        p.u_vec[bit_pos] = frozen_bit;
+        p.path_metric =
+            update_path_metric(p.path_metric, p.llr_vec[bit_pos], frozen_bit);
     }
     d_active_pos = 0;
 }
 
-path::path()
-    : path_metric(0.0f), owns_vectors(false), is_active(false), llr_vec(NULL), u_vec(NULL)
-{
-}
-
-path::~path()
-{
-    if (owns_vectors) {
-        volk_free(llr_vec);
-        volk_free(u_vec);
-    }
-}
-
 } /* namespace polar */
 } /* namespace code */
 } /* namespace fec */
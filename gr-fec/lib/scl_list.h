@@ -19,14 +19,13 @@ namespace code {
 namespace polar {
 
 struct path {
-    path();
-    // Disable copy because of raw pointers.
-    path(const path&) = delete;
-    path& operator=(const path&) = delete;
-    ~path();
     float path_metric;
-    bool owns_vectors;
-    bool is_active;
+    // LLR and bit memory, possibly shared with other paths until one of
+    // them writes to it.
+    unsigned int buffer;
+    // Bit decided while the memory was shared, stored on the next write.
+    int pending_pos;
+    unsigned char pending_bit;
     float* llr_vec;
     unsigned char* u_vec;
 };
@@ -34,23 +33,50 @@ struct path {
 /*!
  * \brief List implementation for Successive Cancellation List decoders
  *
+ * \details
+ * Paths branching on an information bit share their memory, so that
+ * branches which are dropped again are never copied. A path gets a
+ * private copy of the memory when it is written, with only the parts
+ * needed to decode the remaining bits: the decided bits and, for
+ * every stage, the block of LLRs the next bit depends on. The best
+ * candidates are found by partial selection.
  */
 class scl_list
 {
+    struct candidate {
+        float path_metric;
+        unsigned int parent;
+        unsigned char bit;
+    };
+
     const unsigned int d_list_size;
+    const unsigned int d_block_size;
+    const unsigned int d_block_power;
     const unsigned int d_num_buff_elements;
-    std::vector<path*> d_path_list;
-    unsigned int d_active_path_counter;
+    std::vector<path> d_path_list;
+    std::vector<path> d_next_list;
+    std::vector<candidate> d_candidates;
     unsigned int d_active_pos;
 
+    std::vector<float*> d_llr_buffers;
+    std::vector<unsigned char*> d_u_buffers;
+    std::vector<unsigned int> d_ref_count;
+    std::vector<unsigned int> d_free_buffers;
+
     float update_path_metric(const float last_pm, const float llr, const float ui) const;
-    void duplicate_path(path* target, const path* original);
-    void branch_paths(path* target, path* original, const float llr);
-    void steal_vector_ownership(path* target, path* original);
-    void reset();
+    void make_writable(path& p, const int u_num);
+    void copy_live_memory(const unsigned int target,
+                          const unsigned int source,
+                          const int u_num);
+    void release(const path& p);
+    void flush_pending_bits();
 
-    // comparator for std::sort
-    static bool path_compare(path* first, path* second)
+    // comparator for std::nth_element and std::sort
+    static bool candidate_compare(const candidate& first, const candidate& second)
+    {
+        return first.path_metric < second.path_metric;
+    };
+    static bool path_compare(const path* first, const path* second)
     {
         return first->path_metric < second->path_metric;
     };
@@ -66,13 +92,20 @@ public:
 
     virtual ~scl_list();
     const unsigned int size() const { return d_list_size; };
-    const unsigned int active_size() const { return d_active_path_counter; };
+    const unsigned int active_size() const { return d_path_list.size(); };
 
-    path* initial_path() const { return d_path_list[0]; };
-    path* next_active_path() { return d_path_list[d_active_pos++]; };
+    // Resets the list to a single path for the next code word.
+    path* initial_path();
+    // Copies the channel LLRs of the initial path to all buffers.
+    void share_channel_llrs();
+    // Returns the next path, with memory it may write to for decoding
+    // bit u_num.
+    path* next_active_path(const int u_num);
     void set_frozen_bit(const unsigned char frozen_bit, const int bit_pos);
     void set_info_bit(const int bit_pos);
     const path* optimal_path();
+    // All paths of the list, best path metric first.
+    std::vector<const path*> ranked_paths();
 };
 
 } /* namespace polar */
@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "worker_pool.h"
+
+namespace gr {
+namespace fec {
+
+worker_pool::worker_pool(unsigned int nworkers, const std::string& name)
+    : d_name(name), d_job(nullptr), d_round(0), d_pending(0), d_stop(false)
+{
+    for (unsigned int i = 1; i < nworkers; i++) {
+        d_threads.emplace_back(
+            std::make_unique<gr::thread::thread>([this, i] { worker(i); }));
+    }
+}
+
+worker_pool::~worker_pool()
+{
+    {
+        gr::thread::scoped_lock lock(d_mutex);
+        d_stop = true;
+    }
+    d_start.notify_all();
+    for (auto& thread : d_threads) {
+        thread->join();
+    }
+}
+
+void worker_pool::run(const job_t& job)
+{
+    {
+        gr::thread::scoped_lock lock(d_mutex);
+        d_job = &job;
+        d_pending = d_threads.size();
+        d_error = nullptr;
+        d_round++;
+    }
+    d_start.notify_all();
+
+    std::exception_ptr error;
+    try {
+        job(0);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    gr::thread::scoped_lock lock(d_mutex);
+    while (d_pending > 0) {
+        d_done.wait(lock);
+    }
+    d_job = nullptr;
+    if (!error) {
+        error = d_error;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void worker_pool::worker(unsigned int index)
+{
+    gr::thread::set_thread_name(gr::thread::get_current_thread_id(),
+                                d_name + std::to_string(index));
+
+    unsigned long round = 0;
+    while (true) {
+        const job_t* job;
+        {
+            gr::thread::scoped_lock lock(d_mutex);
+            while (!d_stop && d_round == round) {
+                d_start.wait(lock);
+            }
+            if (d_stop) {
+                return;
+            }
+            round = d_round;
+            job = d_job;
+        }
+
+        std::exception_ptr error;
+        try {
+            (*job)(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        gr::thread::scoped_lock lock(d_mutex);
+        if (error) {
+            d_error = error;
+        }
+        if (--d_pending == 0) {
+            d_done.notify_one();
+        }
+    }
+}
+
+} /* namespace fec */
+} /* namespace gr */
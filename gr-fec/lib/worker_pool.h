@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_FEC_WORKER_POOL_H
+#define INCLUDED_FEC_WORKER_POOL_H
+
+#include <gnuradio/thread/thread.h>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gr {
+namespace fec {
+
+/*!
+ * \brief Persistent threads running one job on all workers at a time.
+ *
+ * Worker 0 is the calling thread; workers 1 .. size() - 1 are started
+ * once and wait for the next call to run(). This keeps the cost of a
+ * parallel call to two condition variable handoffs instead of
+ * starting threads in every work call.
+ */
+class worker_pool
+{
+public:
+    typedef std::function<void(unsigned int)> job_t;
+
+    /*!
+     * \param nworkers Number of workers, including the calling thread.
+     * \param name Name given to the threads.
+     */
+    worker_pool(unsigned int nworkers, const std::string& name);
+    ~worker_pool();
+
+    unsigned int size() const { return d_threads.size() + 1; }
+
+    /*!
+     * Calls job(w) on worker w for every worker and returns when all
+     * of them are done. An exception thrown by a job is rethrown
+     * here.
+     */
+    void run(const job_t& job);
+
+private:
+    void worker(unsigned int index);
+
+    const std::string d_name;
+    std::vector<std::unique_ptr<gr::thread::thread>> d_threads;
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_start;
+    gr::thread::condition_variable d_done;
+    const job_t* d_job;
+    unsigned long d_round;
+    unsigned int d_pending;
+    bool d_stop;
+    std::exception_ptr d_error;
+};
+
+} /* namespace fec */
+} /* namespace gr */
+
+#endif /* INCLUDED_FEC_WORKER_POOL_H */
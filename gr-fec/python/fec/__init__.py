@@ -86,6 +86,7 @@ try:
     ldpc_gen_mtrx_encoder = code.ldpc_gen_mtrx_encoder
     ldpc_gen_mtrx_encoder_make = code.ldpc_gen_mtrx_encoder.make
     ldpc_bit_flip_decoder = code.ldpc_bit_flip_decoder
+    ldpc_min_sum_decoder = code.ldpc_min_sum_decoder
 except AttributeError:
     pass
 
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(decoder.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(662191634b23e5216992ab2bb954c5a8)                     */
+/* BINDTOOL_HEADER_FILE_HASH(951912b13f6097784286f86b16987400)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -36,11 +36,23 @@ void bind_decoder(py::module& m)
     py::class_<decoder, gr::block, gr::basic_block, std::shared_ptr<decoder>>(
         m, "decoder", D(decoder))
 
-        .def(py::init(&decoder::make),
+        .def(py::init((std::shared_ptr<decoder>(*)(
+                          gr::fec::generic_decoder::sptr, size_t, size_t)) &
+                      decoder::make),
              py::arg("my_decoder"),
              py::arg("input_item_size"),
              py::arg("output_item_size"),
-             D(decoder, make))
+             D(decoder, make, 0))
+
+        .def(py::init((std::shared_ptr<decoder>(*)(
+                          const std::vector<gr::fec::generic_decoder::sptr>&,
+                          size_t,
+                          size_t)) &
+                      decoder::make),
+             py::arg("my_decoders"),
+             py::arg("input_item_size"),
+             py::arg("output_item_size"),
+             D(decoder, make, 1))
 
 
         .def("general_work",
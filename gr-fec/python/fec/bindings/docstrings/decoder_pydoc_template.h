@@ -24,7 +24,10 @@ static const char* __doc_gr_fec_decoder_decoder_0 = R"doc()doc";
 static const char* __doc_gr_fec_decoder_decoder_1 = R"doc()doc";
 
 
-static const char* __doc_gr_fec_decoder_make = R"doc()doc";
+static const char* __doc_gr_fec_decoder_make_0 = R"doc()doc";
+
+
+static const char* __doc_gr_fec_decoder_make_1 = R"doc()doc";
 
 
 static const char* __doc_gr_fec_decoder_general_work = R"doc()doc";
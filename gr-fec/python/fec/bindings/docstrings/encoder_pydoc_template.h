@@ -24,7 +24,10 @@ static const char* __doc_gr_fec_encoder_encoder_0 = R"doc()doc";
 static const char* __doc_gr_fec_encoder_encoder_1 = R"doc()doc";
 
 
-static const char* __doc_gr_fec_encoder_make = R"doc()doc";
+static const char* __doc_gr_fec_encoder_make_0 = R"doc()doc";
+
+
+static const char* __doc_gr_fec_encoder_make_1 = R"doc()doc";
 
 
 static const char* __doc_gr_fec_encoder_general_work = R"doc()doc";
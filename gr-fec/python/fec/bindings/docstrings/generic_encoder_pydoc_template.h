@@ -51,6 +51,9 @@ static const char* __doc_gr_fec_generic_encoder_get_input_conversion = R"doc()do
 static const char* __doc_gr_fec_generic_encoder_get_output_conversion = R"doc()doc";
 
 
+static const char* __doc_gr_fec_generic_encoder_carries_state = R"doc()doc";
+
+
 static const char* __doc_gr_fec_generic_encoder_set_frame_size = R"doc()doc";
 
 
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, fec, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder = R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_ldpc_min_sum_decoder_0 =
+    R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_ldpc_min_sum_decoder_1 =
+    R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_make = R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_make_alist = R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_set_frame_size = R"doc()doc";
+
+
+static const char* __doc_gr_fec_code_ldpc_min_sum_decoder_rate = R"doc()doc";
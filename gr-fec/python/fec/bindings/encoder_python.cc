@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(encoder.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(d120efc9684a7563dd04193326c94954)                     */
+/* BINDTOOL_HEADER_FILE_HASH(298d2ed0adb5c48bfc556be3090f8405)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -36,11 +36,23 @@ void bind_encoder(py::module& m)
     py::class_<encoder, gr::block, gr::basic_block, std::shared_ptr<encoder>>(
         m, "encoder", D(encoder))
 
-        .def(py::init(&encoder::make),
+        .def(py::init((std::shared_ptr<encoder>(*)(
+                          gr::fec::generic_encoder::sptr, size_t, size_t)) &
+                      encoder::make),
              py::arg("my_encoder"),
              py::arg("input_item_size"),
              py::arg("output_item_size"),
-             D(encoder, make))
+             D(encoder, make, 0))
+
+        .def(py::init((std::shared_ptr<encoder>(*)(
+                          const std::vector<gr::fec::generic_encoder::sptr>&,
+                          size_t,
+                          size_t)) &
+                      encoder::make),
+             py::arg("my_encoders"),
+             py::arg("input_item_size"),
+             py::arg("output_item_size"),
+             D(encoder, make, 1))
 
 
         .def("general_work",
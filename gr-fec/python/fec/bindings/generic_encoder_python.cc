@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(generic_encoder.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(8f2010dc3c6371720e76fe7c2903bd84)                     */
+/* BINDTOOL_HEADER_FILE_HASH(a04fd8b43a018be99f93cba39eb10603)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -81,6 +81,11 @@ void bind_generic_encoder(py::module& m)
              D(generic_encoder, get_output_conversion))
 
 
+        .def("carries_state",
+             &generic_encoder::carries_state,
+             D(generic_encoder, carries_state))
+
+
         .def("set_frame_size",
              &generic_encoder::set_frame_size,
              py::arg("frame_size"),
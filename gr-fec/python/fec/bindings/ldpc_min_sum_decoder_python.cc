@@ -0,0 +1,73 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(ldpc_min_sum_decoder.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(29b231c437c0c58e878f049823f57e8f)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/fec/ldpc_min_sum_decoder.h>
+// pydoc.h is automatically generated in the build directory
+#include <ldpc_min_sum_decoder_pydoc.h>
+
+void bind_ldpc_min_sum_decoder(py::module& m)
+{
+
+
+    py::module m_code = m.def_submodule("code");
+
+    using ldpc_min_sum_decoder = ::gr::fec::code::ldpc_min_sum_decoder;
+
+
+    py::class_<ldpc_min_sum_decoder,
+               gr::fec::generic_decoder,
+               std::shared_ptr<ldpc_min_sum_decoder>>(
+        m_code, "ldpc_min_sum_decoder", D(code, ldpc_min_sum_decoder))
+
+        .def_static("make",
+                    &ldpc_min_sum_decoder::make,
+                    py::arg("mtrx_obj"),
+                    py::arg("max_iter") = 20,
+                    py::arg("correction") = 0.75,
+                    py::arg("offset") = false,
+                    py::arg("message_bits") = 8,
+                    D(code, ldpc_min_sum_decoder, make))
+
+
+        .def_static("make_alist",
+                    &ldpc_min_sum_decoder::make_alist,
+                    py::arg("alist_file"),
+                    py::arg("max_iter") = 20,
+                    py::arg("correction") = 0.75,
+                    py::arg("offset") = false,
+                    py::arg("message_bits") = 8,
+                    D(code, ldpc_min_sum_decoder, make_alist))
+
+
+        .def("set_frame_size",
+             &ldpc_min_sum_decoder::set_frame_size,
+             py::arg("frame_size"),
+             D(code, ldpc_min_sum_decoder, set_frame_size))
+
+
+        .def("rate", &ldpc_min_sum_decoder::rate, D(code, ldpc_min_sum_decoder, rate))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(polar_decoder_sc_list.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(87aca1c0c780c3ddedb0ba5d8e84a85b)                     */
+/* BINDTOOL_HEADER_FILE_HASH(a66d8a279b32dfcf1a4aa4365d703417)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -48,6 +48,8 @@ void bind_polar_decoder_sc_list(py::module& m)
                     py::arg("num_info_bits"),
                     py::arg("frozen_bit_positions"),
                     py::arg("frozen_bit_values"),
+                    py::arg("crc_size") = 0,
+                    py::arg("crc_polynomial") = 0,
                     D(code, polar_decoder_sc_list, make))
 
 
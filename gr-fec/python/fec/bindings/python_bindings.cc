@@ -42,6 +42,7 @@ void bind_fec_mtrx(py::module&);
 void bind_ldpc_G_matrix(py::module&);
 void bind_ldpc_H_matrix(py::module&);
 void bind_ldpc_bit_flip_decoder(py::module&);
+void bind_ldpc_min_sum_decoder(py::module&);
 void bind_ldpc_gen_mtrx_encoder(py::module&);
 void bind_ldpc_par_mtrx_encoder(py::module&);
 #endif
@@ -113,6 +114,7 @@ PYBIND11_MODULE(fec_python, m)
     bind_ldpc_G_matrix(m);
     bind_ldpc_H_matrix(m);
     bind_ldpc_bit_flip_decoder(m);
+    bind_ldpc_min_sum_decoder(m);
     bind_ldpc_gen_mtrx_encoder(m);
     bind_ldpc_par_mtrx_encoder(m);
 #endif
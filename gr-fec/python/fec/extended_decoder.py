@@ -189,6 +189,15 @@ class extended_decoder(gr.hier_block2):
                 )
             )
 
+        elif threading == "native":
+            self.blocks.append(
+                fec.decoder(
+                    decoder_obj_list,
+                    fec.get_decoder_input_item_size(decoder_obj_list[0]),
+                    fec.get_decoder_output_item_size(decoder_obj_list[0]),
+                )
+            )
+
         else:
             self.blocks.append(
                 fec.decoder(
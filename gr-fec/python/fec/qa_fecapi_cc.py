@@ -192,6 +192,53 @@ class test_fecapi_cc(gr_unittest.TestCase):
 
         self.assertEqual(data_in, data_out)
 
+    def test_parallelism1_06(self):
+        frame_size = 30
+        k = 7
+        rate = 2
+        polys = [109, 79]
+        mode = fec.CC_TERMINATED
+        enc = list(map((lambda a: fec.cc_encoder_make(
+            frame_size * 8, k, rate, polys, mode=mode)), list(range(0, 4))))
+        dec = list(map((lambda a: fec.cc_decoder.make(
+            frame_size * 8, k, rate, polys, mode=mode)), list(range(0, 4))))
+        threading = 'native'
+        self.test = _qa_helper(100 * frame_size, enc, dec, threading)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_out = self.test.snk_output.data()
+        data_in = self.test.snk_input.data()[0:len(data_out)]
+
+        self.assertEqual(data_in, data_out)
+
+    def test_parallelism1_07(self):
+        # A streaming encoder carries its state from frame to frame,
+        # so it cannot be split across workers.
+        frame_size = 30
+        k = 7
+        rate = 2
+        polys = [109, 79]
+        enc = list(map((lambda a: fec.cc_encoder_make(
+            frame_size * 8, k, rate, polys, mode=fec.CC_STREAMING)),
+            list(range(0, 4))))
+        self.assertTrue(enc[0].carries_state())
+        with self.assertRaises(ValueError):
+            fec.encoder(enc, gr.sizeof_char, gr.sizeof_char)
+
+    def test_parallelism1_08(self):
+        # Every decoder in the list is checked for history, not just
+        # the first one.
+        frame_size = 30
+        k = 7
+        rate = 2
+        polys = [109, 79]
+        modes = [fec.CC_TRUNCATED, fec.CC_TRUNCATED, fec.CC_STREAMING]
+        dec = list(map((lambda m: fec.cc_decoder.make(
+            frame_size * 8, k, rate, polys, mode=m)), modes))
+        with self.assertRaises(ValueError):
+            fec.decoder(dec, gr.sizeof_float, gr.sizeof_char)
+
     def test_async_00(self):
         frame_size = 30
         k = 7
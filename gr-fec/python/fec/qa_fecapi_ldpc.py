@@ -10,9 +10,10 @@
 
 
 import os
+import random
 
 from gnuradio import gr, gr_unittest
-from gnuradio import fec
+from gnuradio import fec, blocks
 from gnuradio.fec import extended_encoder
 from gnuradio.fec import extended_decoder
 
@@ -26,6 +27,29 @@ from _qa_helper_async import _qa_helper_async
 LDPC_ALIST_DIR = os.getenv('srcdir', '.') + "/../../ldpc_alist/"
 
 
+class _qa_helper_channel(_qa_helper):
+    """
+    _qa_helper with a channel between encoder and decoder: every soft
+    value is multiplied by 'gain' and then 'noise' is added, both
+    repeated over the stream.
+    """
+
+    def __init__(self, data_size, enc, dec, threading, gain, noise):
+        _qa_helper.__init__(self, data_size, enc, dec, threading)
+
+        self.gain = blocks.vector_source_f(gain, True)
+        self.noise = blocks.vector_source_f(noise, True)
+        self.mult = blocks.multiply_ff()
+        self.add = blocks.add_ff()
+
+        self.disconnect(self.to_float, self.ext_decoder)
+        self.connect(self.to_float, (self.mult, 0))
+        self.connect(self.gain, (self.mult, 1))
+        self.connect(self.mult, (self.add, 0))
+        self.connect(self.noise, (self.add, 1))
+        self.connect(self.add, self.ext_decoder)
+
+
 class test_fecapi_ldpc(gr_unittest.TestCase):
 
     def setUp(self):
@@ -122,6 +146,120 @@ class test_fecapi_ldpc(gr_unittest.TestCase):
 
         self.assertEqual(data_in, data_out)
 
+    def test_parallelism0_04_min_sum(self):
+        filename = LDPC_ALIST_DIR + "n_0100_k_0027_gap_04.alist"
+        gap = 4
+        LDPC_matrix_object = fec.ldpc_H_matrix(filename, gap)
+        k = LDPC_matrix_object.k()
+        enc = fec.ldpc_par_mtrx_encoder.make_H(LDPC_matrix_object)
+        dec = fec.ldpc_min_sum_decoder.make(
+            LDPC_matrix_object.get_base_sptr())
+        # Several code words per frame, so that they are decoded side by side
+        enc.set_frame_size(20 * k)
+        dec.set_frame_size(20 * k)
+        threading = None
+        self.test = _qa_helper(60 * k, enc, dec, threading)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertEqual(data_in, data_out)
+
+    def test_parallelism0_05_min_sum_gen(self):
+        filename = LDPC_ALIST_DIR + "n_0100_k_0058_gen_matrix.alist"
+        LDPC_matrix_object = fec.ldpc_G_matrix(filename)
+        k = LDPC_matrix_object.k()
+        enc = fec.ldpc_gen_mtrx_encoder.make(LDPC_matrix_object)
+        dec = fec.ldpc_min_sum_decoder.make(
+            LDPC_matrix_object.get_base_sptr(), 20, 0.5, True, 16)
+        threading = 'capillary'
+        self.test = _qa_helper(20 * k, enc, dec, threading)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertEqual(data_in, data_out)
+
+    def test_parallelism0_06_min_sum_alist(self):
+        filename = LDPC_ALIST_DIR + "n_0100_k_0042_gap_02.alist"
+        enc = fec.ldpc_encoder.make(filename)
+        dec = fec.ldpc_min_sum_decoder.make_alist(filename)
+        k = enc.get_input_size()
+        threading = None
+        self.test = _qa_helper(10 * k, enc, dec, threading)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertEqual(data_in, data_out)
+
+    def test_parallelism0_07_min_sum_flips(self):
+        filename = LDPC_ALIST_DIR + "n_0100_k_0027_gap_04.alist"
+        gap = 4
+        LDPC_matrix_object = fec.ldpc_H_matrix(filename, gap)
+        k = LDPC_matrix_object.k()
+        n = LDPC_matrix_object.n()
+        enc = fec.ldpc_par_mtrx_encoder.make_H(LDPC_matrix_object)
+        dec = fec.ldpc_min_sum_decoder.make(
+            LDPC_matrix_object.get_base_sptr())
+        # One frame fills all 16 lanes
+        enc.set_frame_size(16 * k)
+        dec.set_frame_size(16 * k)
+
+        # Code bits received with the wrong sign. With these errors the
+        # lanes reach a code word after 0, 1, 2, 3, 4 and 5 iterations,
+        # so they are frozen one after the other.
+        flips = [[],
+                 [59, 99],
+                 [32, 45, 67, 83, 88, 94],
+                 [0, 9, 16, 17, 26, 56, 79, 99],
+                 [32, 36, 47, 51, 52, 65, 70, 76],
+                 [2, 5, 7, 21, 25, 34, 43, 83]]
+        gain = 16 * n * [1.0]
+        for cw in range(16):
+            for i in flips[cw % len(flips)]:
+                gain[cw * n + i] = -1.0
+
+        threading = None
+        self.test = _qa_helper_channel(18, enc, dec, threading, gain, [0.0])
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertEqual(data_in, data_out)
+        self.assertEqual(dec.get_iterations(), 5)
+
+    def test_parallelism0_08_min_sum_noise(self):
+        filename = LDPC_ALIST_DIR + "n_0100_k_0042_gap_02.alist"
+        enc = fec.ldpc_encoder.make(filename)
+        dec = fec.ldpc_min_sum_decoder.make_alist(filename, 20, 0.25, True, 16)
+        k = enc.get_input_size()
+        n = enc.get_output_size()
+        dec.set_frame_size(16 * k)
+
+        # About two bit errors per code word before decoding
+        rng = random.Random(0)
+        noise = [rng.gauss(0.0, 0.5) for i in range(16 * n)]
+
+        threading = None
+        self.test = _qa_helper_channel(28, enc, dec, threading, [1.0], noise)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertEqual(data_in, data_out)
+        self.assertGreater(dec.get_iterations(), 0)
+
     def test_parallelism1_00(self):
         filename = LDPC_ALIST_DIR + "n_0100_k_0027_gap_04.alist"
         gap = 4
@@ -156,6 +156,24 @@ class test_fecapi_repetition(gr_unittest.TestCase):
 
         self.assertSequenceEqualGR(data_in, data_out)
 
+    def test_parallelism1_05(self):
+        frame_size = 30
+        rep = 3
+        dims = 4
+        enc = list(map((lambda a: fec.repetition_encoder_make(
+            frame_size * 8, rep)), list(range(0, dims))))
+        dec = list(map((lambda a: fec.repetition_decoder.make(
+            frame_size * 8, rep)), list(range(0, dims))))
+        threading = 'native'
+        self.test = _qa_helper(100 * frame_size, enc, dec, threading)
+        self.tb.connect(self.test)
+        self.tb.run()
+
+        data_in = self.test.snk_input.data()
+        data_out = self.test.snk_output.data()
+
+        self.assertSequenceEqualGR(data_in, data_out)
+
     def test_async_00(self):
         frame_size = 30
         rep = 3
@@ -21,6 +21,21 @@ from gnuradio.fec.polar import channel_construction as cc
 # raw_input('tell me smth')
 
 
+def crc_bits(bits, crc_size, crc_polynomial):
+    """CRC of bits, MSB first, zero initial register"""
+    reg = 0
+    for b in bits:
+        feedback = ((reg >> (crc_size - 1)) & 1) ^ b
+        reg = (reg << 1) & ((1 << crc_size) - 1)
+        if feedback:
+            reg ^= crc_polynomial
+    return [(reg >> (crc_size - 1 - i)) & 1 for i in range(crc_size)]
+
+
+def append_crc(bits, crc_size, crc_polynomial):
+    return np.append(bits, crc_bits(bits, crc_size, crc_polynomial))
+
+
 class test_polar_decoder_sc_list(gr_unittest.TestCase):
 
     def setUp(self):
@@ -136,6 +151,120 @@ class test_polar_decoder_sc_list(gr_unittest.TestCase):
         res = np.array(snk.data()).astype(dtype=int)
         self.assertTupleEqual(tuple(res), tuple(ref))
 
+    def test_004_crc_aided(self):
+        expo = 8
+        block_size = 2 ** expo
+        num_info_bits = 2 ** (expo - 1)
+        max_list_size = 32
+        crc_size = 11
+        crc_polynomial = 0x621
+        num_frozen_bits = block_size - num_info_bits
+        frozen_bit_positions = cc.frozen_bit_positions(
+            block_size, num_info_bits, 0.0)
+        frozen_bit_values = np.array([0] * num_frozen_bits,)
+
+        bits = append_crc(np.random.randint(2, size=num_info_bits - crc_size),
+                          crc_size, crc_polynomial)
+
+        encoder = PolarEncoder(
+            block_size,
+            num_info_bits,
+            frozen_bit_positions,
+            frozen_bit_values)
+        data = encoder.encode(bits)
+        gr_data = 2.0 * data - 1.0
+
+        polar_decoder = fec.polar_decoder_sc_list.make(
+            max_list_size,
+            block_size,
+            num_info_bits,
+            frozen_bit_positions,
+            frozen_bit_values,
+            crc_size,
+            crc_polynomial)
+        src = blocks.vector_source_f(gr_data, False)
+        dec_block = extended_decoder(polar_decoder, None)
+        snk = blocks.vector_sink_b(1)
+
+        self.tb.connect(src, dec_block)
+        self.tb.connect(dec_block, snk)
+        self.tb.run()
+
+        res = np.array(snk.data()).astype(dtype=int)
+        self.assertTupleEqual(tuple(res), tuple(bits))
+
+    def test_005_crc_aided_noisy(self):
+        nframes = 300
+        expo = 8
+        block_size = 2 ** expo
+        num_info_bits = 2 ** (expo - 1)
+        max_list_size = 32
+        crc_size = 11
+        crc_polynomial = 0x621
+        num_frozen_bits = block_size - num_info_bits
+        frozen_bit_positions = cc.frozen_bit_positions(
+            block_size, num_info_bits, 0.0)
+        frozen_bit_values = np.array([0] * num_frozen_bits,)
+
+        encoder = PolarEncoder(
+            block_size,
+            num_info_bits,
+            frozen_bit_positions,
+            frozen_bit_values)
+        rng = np.random.default_rng(42)
+        ref = []
+        data = np.array([], dtype=int)
+        for i in range(nframes):
+            b = append_crc(rng.integers(2, size=num_info_bits - crc_size),
+                           crc_size, crc_polynomial)
+            ref.append(b)
+            data = np.append(data, encoder.encode(b))
+        # about 1 dB Eb/N0, where the most likely path is often wrong
+        gr_data = 2.0 * data - 1.0 + 0.9 * rng.standard_normal(len(data))
+
+        def decode(crc_size, crc_polynomial):
+            polar_decoder = fec.polar_decoder_sc_list.make(
+                max_list_size,
+                block_size,
+                num_info_bits,
+                frozen_bit_positions,
+                frozen_bit_values,
+                crc_size,
+                crc_polynomial)
+            tb = gr.top_block()
+            src = blocks.vector_source_f(gr_data, False)
+            dec_block = extended_decoder(polar_decoder, None)
+            snk = blocks.vector_sink_b(1)
+            tb.connect(src, dec_block, snk)
+            tb.run()
+            res = np.array(snk.data()).astype(dtype=int)
+            self.assertEqual(len(res), nframes * num_info_bits)
+            return res.reshape(nframes, num_info_bits)
+
+        # without a CRC the decoder outputs the most likely path
+        best = decode(0, 0)
+        aided = decode(crc_size, crc_polynomial)
+
+        def passes(bits):
+            return crc_bits(bits[:-crc_size], crc_size,
+                            crc_polynomial) == list(bits[-crc_size:])
+
+        rescued = 0
+        for i in range(nframes):
+            if not np.array_equal(aided[i], best[i]):
+                # a lower ranked path is only chosen if it passes the CRC
+                # and the most likely one does not
+                self.assertFalse(passes(best[i]))
+                self.assertTrue(passes(aided[i]))
+                if np.array_equal(aided[i], ref[i]):
+                    rescued += 1
+        self.assertGreater(rescued, 0)
+        best_errors = sum(not np.array_equal(best[i], ref[i])
+                          for i in range(nframes))
+        aided_errors = sum(not np.array_equal(aided[i], ref[i])
+                           for i in range(nframes))
+        self.assertLess(aided_errors, best_errors)
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_polar_decoder_sc_list)
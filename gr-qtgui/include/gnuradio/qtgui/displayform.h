@@ -37,6 +37,8 @@ public:
     virtual DisplayPlot* getPlot() = 0;
     void Reset();
     bool isClosed() const;
+    //! Width of the plot area in pixels; GUI thread only, see plotWidthChanged().
+    int getPlotWidth() const;
 
     void enableMenu(bool en = true);
 
@@ -86,8 +88,13 @@ private slots:
 signals:
     void plotPointSelected(const QPointF p, int type);
     void toggleGrid(bool en);
+    //! Emitted on the GUI thread when the plot area is shown or resized.
+    void plotWidthChanged(int width);
 
 protected:
+    void showEvent(QShowEvent* e) override;
+    bool eventFilter(QObject* obj, QEvent* e) override;
+
     bool d_isclosed;
 
     unsigned int d_nplots;
@@ -123,6 +130,9 @@ protected:
     QAction* d_save_act;
 
     double d_update_time;
+
+private:
+    int d_plot_width;
 };
 
 #endif /* DISPLAY_FORM_H */
@@ -13,6 +13,7 @@
 
 #include <gnuradio/fft/window.h>
 #include <gnuradio/qtgui/api.h>
+#include <gnuradio/qtgui/reduction_mode.h>
 #include <gnuradio/qtgui/trigger_mode.h>
 #include <gnuradio/sync_block.h>
 #include <qapplication.h>
@@ -113,6 +114,23 @@ public:
     //! If true, normalize window to unit power
     virtual void set_fft_window_normalized(const bool enable) = 0;
 
+    /*!
+     * \brief Reduce the spectrum to the resolution of the plot before
+     * it is handed to the GUI.
+     *
+     * \details
+     * FFT bins are combined into \p width points per row, so that
+     * large FFTs do not cost the GUI more than the plot can show.
+     *
+     * \param width number of points to display: 0 to display every
+     *        bin (the default), -1 to follow the width of the plot in
+     *        pixels.
+     * \param mode combine bins by their maximum or their mean
+     */
+    virtual void set_display_reduction(int width, reduction_mode mode = REDUCE_MAX) = 0;
+    virtual int display_reduction_width() const = 0;
+    virtual reduction_mode display_reduction_mode() const = 0;
+
     virtual void set_frequency_range(const double centerfreq, const double bandwidth) = 0;
     virtual void set_y_axis(double min, double max) = 0;
 
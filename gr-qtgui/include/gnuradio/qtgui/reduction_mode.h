@@ -0,0 +1,29 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_QTGUI_REDUCTION_MODE_H
+#define INCLUDED_QTGUI_REDUCTION_MODE_H
+
+namespace gr {
+namespace qtgui {
+
+/*!
+ * How the spectrum sinks combine FFT bins that end up in the same
+ * pixel, and FFT rows that end up in the same line of a waterfall.
+ */
+enum reduction_mode {
+    REDUCE_MAX,
+    REDUCE_MEAN,
+};
+
+} /* namespace qtgui */
+} /* namespace gr */
+
+#endif /* INCLUDED_QTGUI_REDUCTION_MODE_H */
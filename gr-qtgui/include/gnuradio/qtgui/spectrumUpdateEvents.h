@@ -13,12 +13,14 @@
 
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/qtgui/api.h>
+#include <gnuradio/qtgui/triple_buffer.h>
 #include <gnuradio/tags.h>
 #include <volk/volk_alloc.hh>
 #include <QEvent>
 #include <QString>
 #include <complex>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 static constexpr int SpectrumUpdateEventType = 10005;
@@ -105,12 +107,32 @@ private:
 };
 
 
+/*!
+ * Latest data of a sink, handed to its display form through a
+ * DisplayBuffer. Posting an update event for a DisplayBuffer only when
+ * the form has taken the previous frame keeps a slow GUI from queueing
+ * up events and copies of the data.
+ */
+struct QTGUI_API DisplayFrame {
+    std::vector<volk::vector<double>> points;
+    uint64_t numPoints = 0;
+    std::vector<std::vector<gr::tag_t>> tags;
+
+    //! Copy the first n points of each data vector, reusing the memory.
+    void assign(const std::vector<volk::vector<double>>& data, uint64_t n);
+};
+
+typedef gr::qtgui::triple_buffer<DisplayFrame> DisplayBuffer;
+
+
 class TimeUpdateEvent : public QEvent
 {
 public:
     TimeUpdateEvent(const std::vector<volk::vector<double>> timeDomainPoints,
                     const uint64_t numTimeDomainDataPoints,
                     const std::vector<std::vector<gr::tag_t>> tags);
+    //! Update with the latest frame of display, read when handled.
+    TimeUpdateEvent(std::shared_ptr<DisplayBuffer> display);
 
     ~TimeUpdateEvent() override;
 
@@ -129,6 +151,9 @@ private:
     std::vector<double*> _dataTimeDomainPoints;
     uint64_t _numTimeDomainDataPoints;
     std::vector<std::vector<gr::tag_t>> _tags;
+    std::shared_ptr<DisplayBuffer> _display;
+    mutable const DisplayFrame* _frame = nullptr;
+    const DisplayFrame& frame() const;
 };
 
 
@@ -140,6 +165,8 @@ class FreqUpdateEvent : public QEvent
 public:
     FreqUpdateEvent(const std::vector<volk::vector<double>> dataPoints,
                     const uint64_t numDataPoints);
+    //! Update with the latest frame of display, read when handled.
+    FreqUpdateEvent(std::shared_ptr<DisplayBuffer> display);
 
     ~FreqUpdateEvent() override;
 
@@ -155,6 +182,9 @@ private:
     size_t _nplots;
     std::vector<double*> _dataPoints;
     uint64_t _numDataPoints;
+    std::shared_ptr<DisplayBuffer> _display;
+    mutable const DisplayFrame* _frame = nullptr;
+    const DisplayFrame& frame() const;
 };
 
 
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_QTGUI_TRIPLE_BUFFER_H
+#define INCLUDED_QTGUI_TRIPLE_BUFFER_H
+
+#include <atomic>
+
+namespace gr {
+namespace qtgui {
+
+/*!
+ * \brief Lock-free hand-over of the latest frame from one writer
+ * thread to one reader thread.
+ *
+ * \details
+ * The writer fills back() and publishes it, the reader acquires the
+ * most recently published frame as front(). Neither side ever waits
+ * for the other: frames the reader is too slow for are overwritten,
+ * and each side only touches its own buffer between calls.
+ */
+template <typename T>
+class triple_buffer
+{
+public:
+    triple_buffer() : d_back(0), d_middle(1), d_front(2) {}
+
+    triple_buffer(const triple_buffer&) = delete;
+    triple_buffer& operator=(const triple_buffer&) = delete;
+
+    //! Frame the writer fills next.
+    T& back() { return d_frames[d_back]; }
+
+    /*!
+     * Hand the back frame over to the reader.
+     * \returns true if the reader had acquired the previously published
+     * frame, so that it needs to be told about this one.
+     */
+    bool publish()
+    {
+        const unsigned int old = d_middle.exchange(d_back | DIRTY);
+        d_back = old & INDEX;
+        return (old & DIRTY) == 0;
+    }
+
+    /*!
+     * Make the most recently published frame the front frame.
+     * \returns false if nothing was published since the last call.
+     */
+    bool acquire()
+    {
+        if ((d_middle.load() & DIRTY) == 0) {
+            return false;
+        }
+        d_front = d_middle.exchange(d_front) & INDEX;
+        return true;
+    }
+
+    //! Frame the reader owns, valid until the next acquire().
+    T& front() { return d_frames[d_front]; }
+
+private:
+    static constexpr unsigned int INDEX = 3;
+    static constexpr unsigned int DIRTY = 4;
+
+    T d_frames[3];
+    unsigned int d_back;
+    std::atomic<unsigned int> d_middle;
+    unsigned int d_front;
+};
+
+} /* namespace qtgui */
+} /* namespace gr */
+
+#endif /* INCLUDED_QTGUI_TRIPLE_BUFFER_H */
@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "display_reducer.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace gr {
+namespace qtgui {
+
+display_reducer::display_reducer()
+    : d_mode(REDUCE_MAX), d_npoints(0), d_edges(1, 0), d_nrows(0)
+{
+}
+
+bool display_reducer::resize(int npoints, int width)
+{
+    if (width <= 0 || width > npoints) {
+        width = npoints;
+    }
+    if (npoints == d_npoints && width == points()) {
+        return false;
+    }
+
+    d_npoints = npoints;
+    d_edges.resize(width + 1);
+    for (int p = 0; p <= width; p++) {
+        d_edges[p] = static_cast<int>(static_cast<int64_t>(p) * npoints / width);
+    }
+    d_row.resize(width);
+    d_acc.resize(width);
+    d_nrows = 0;
+    return true;
+}
+
+void display_reducer::set_mode(reduction_mode mode)
+{
+    if (mode != d_mode) {
+        d_mode = mode;
+        d_nrows = 0;
+    }
+}
+
+void display_reducer::reduce(const double* in, double* out) const
+{
+    const int width = points();
+    if (width == d_npoints) {
+        memcpy(out, in, sizeof(double) * width);
+        return;
+    }
+
+    for (int p = 0; p < width; p++) {
+        const double* first = in + d_edges[p];
+        const double* last = in + d_edges[p + 1];
+        double acc = *first;
+        if (d_mode == REDUCE_MAX) {
+            for (const double* x = first + 1; x < last; x++) {
+                acc = std::max(acc, *x);
+            }
+        } else {
+            for (const double* x = first + 1; x < last; x++) {
+                acc += *x;
+            }
+            acc /= static_cast<double>(last - first);
+        }
+        out[p] = acc;
+    }
+}
+
+void display_reducer::accumulate(const double* in)
+{
+    // Rows are combined after they are reduced, so the hold only costs
+    // points() values per row whatever the FFT size.
+    const int width = points();
+    if (d_nrows == 0) {
+        reduce(in, d_acc.data());
+    } else {
+        reduce(in, d_row.data());
+        if (d_mode == REDUCE_MAX) {
+            volk_64f_x2_max_64f(d_acc.data(), d_acc.data(), d_row.data(), width);
+        } else {
+            volk_64f_x2_add_64f(d_acc.data(), d_acc.data(), d_row.data(), width);
+        }
+    }
+    d_nrows++;
+}
+
+bool display_reducer::flush(double* out)
+{
+    if (d_nrows == 0) {
+        return false;
+    }
+
+    const int width = points();
+    if (d_mode == REDUCE_MEAN && d_nrows > 1) {
+        const double scale = 1.0 / d_nrows;
+        for (int p = 0; p < width; p++) {
+            out[p] = d_acc[p] * scale;
+        }
+    } else {
+        memcpy(out, d_acc.data(), sizeof(double) * width);
+    }
+    d_nrows = 0;
+    return true;
+}
+
+} /* namespace qtgui */
+} /* namespace gr */
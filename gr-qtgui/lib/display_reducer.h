@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_QTGUI_DISPLAY_REDUCER_H
+#define INCLUDED_QTGUI_DISPLAY_REDUCER_H
+
+#include <gnuradio/qtgui/api.h>
+#include <gnuradio/qtgui/reduction_mode.h>
+#include <volk/volk_alloc.hh>
+#include <vector>
+
+namespace gr {
+namespace qtgui {
+
+/*!
+ * \brief Reduces spectra to the resolution they are displayed at.
+ *
+ * \details
+ * A row of FFT bins is binned down to a number of points, each the
+ * maximum or mean of the bins it covers, so that the amount of data
+ * handed to the GUI depends on the size of the plot and not on the
+ * FFT size. Successive rows can be accumulated and collapsed into one
+ * the same way.
+ */
+class QTGUI_API display_reducer
+{
+public:
+    display_reducer();
+
+    /*!
+     * Reduce rows of \p npoints bins to \p width points; with \p width
+     * zero or at least \p npoints, rows keep their size. Drops any
+     * accumulated rows if the sizes change.
+     * \returns true if the sizes changed.
+     */
+    bool resize(int npoints, int width);
+    void set_mode(reduction_mode mode);
+
+    //! Number of points per reduced row.
+    int points() const { return d_edges.size() - 1; }
+
+    //! Bin one row of bins into points() values in \p out.
+    void reduce(const double* in, double* out) const;
+
+    //! Reduce one row and combine it with the rows accumulated so far.
+    void accumulate(const double* in);
+
+    /*!
+     * Write the combination of the accumulated rows to \p out and start
+     * over. \returns false if no row was accumulated.
+     */
+    bool flush(double* out);
+
+    //! Number of rows accumulated since the last flush().
+    unsigned int rows() const { return d_nrows; }
+
+private:
+    reduction_mode d_mode;
+    int d_npoints;
+    // First bin of each point, and one past the last bin
+    std::vector<int> d_edges;
+    // Last reduced row, and the max or sum of the reduced rows so far
+    volk::vector<double> d_row;
+    volk::vector<double> d_acc;
+    unsigned int d_nrows;
+};
+
+} /* namespace qtgui */
+} /* namespace gr */
+
+#endif /* INCLUDED_QTGUI_DISPLAY_REDUCER_H */
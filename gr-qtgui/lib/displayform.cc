@@ -14,7 +14,7 @@
 #include <QPixmap>
 
 DisplayForm::DisplayForm(int nplots, QWidget* parent)
-    : QWidget(parent), d_nplots(nplots), d_system_specified_flag(false)
+    : QWidget(parent), d_nplots(nplots), d_system_specified_flag(false), d_plot_width(0)
 {
     d_isclosed = false;
     d_axislabels = true;
@@ -168,6 +168,31 @@ void DisplayForm::Reset() {}
 
 bool DisplayForm::isClosed() const { return d_isclosed; }
 
+int DisplayForm::getPlotWidth() const { return d_display_plot->canvas()->width(); }
+
+void DisplayForm::showEvent(QShowEvent* e)
+{
+    // Follow the canvas size from now on; installing twice is a no-op
+    d_display_plot->canvas()->installEventFilter(this);
+    if (getPlotWidth() != d_plot_width) {
+        d_plot_width = getPlotWidth();
+        emit plotWidthChanged(d_plot_width);
+    }
+    QWidget::showEvent(e);
+}
+
+bool DisplayForm::eventFilter(QObject* obj, QEvent* e)
+{
+    if (obj == d_display_plot->canvas() && e->type() == QEvent::Resize) {
+        const int width = static_cast<QResizeEvent*>(e)->size().width();
+        if (width != d_plot_width) {
+            d_plot_width = width;
+            emit plotWidthChanged(width);
+        }
+    }
+    return QWidget::eventFilter(obj, e);
+}
+
 void DisplayForm::enableMenu(bool en) { d_menu_on = en; }
 
 void DisplayForm::closeEvent(QCloseEvent* e)
@@ -60,6 +60,7 @@ freq_sink_c_impl::freq_sink_c_impl(int fftsize,
       d_nconnections(nconnections),
       d_port(pmt::mp("freq")),
       d_port_bw(pmt::mp("bw")),
+      d_display(std::make_shared<DisplayBuffer>()),
       d_parent(parent)
 {
     // setup bw input port
@@ -96,6 +97,7 @@ freq_sink_c_impl::freq_sink_c_impl(int fftsize,
 
 freq_sink_c_impl::~freq_sink_c_impl()
 {
+    QObject::disconnect(d_plot_width_connection);
     if (!d_main_gui->isClosed())
         d_main_gui->close();
 }
@@ -118,6 +120,10 @@ void freq_sink_c_impl::initialize()
 
     int numplots = (d_nconnections > 0) ? d_nconnections : 1;
     d_main_gui = new FreqDisplayForm(numplots, d_parent);
+    d_plot_width_connection =
+        QObject::connect(d_main_gui,
+                         &DisplayForm::plotWidthChanged,
+                         [this](int width) { this->set_plot_width(width); });
     set_fft_window(d_wintype);
     set_fft_size(d_fftsize);
     set_frequency_range(d_center_freq, d_bandwidth);
@@ -164,6 +170,28 @@ void freq_sink_c_impl::set_fft_window(const fft::window::win_type win)
 
 fft::window::win_type freq_sink_c_impl::fft_window() { return d_wintype; }
 
+void freq_sink_c_impl::set_display_reduction(int width, reduction_mode mode)
+{
+    if (width < -1) {
+        throw std::invalid_argument(
+            "freq_sink_c: display reduction width must be -1 or larger.");
+    }
+
+    gr::thread::scoped_lock lock(d_setlock);
+    d_reduce_width = width;
+    d_reduce_mode = mode;
+}
+
+int freq_sink_c_impl::display_reduction_width() const { return d_reduce_width; }
+
+reduction_mode freq_sink_c_impl::display_reduction_mode() const { return d_reduce_mode; }
+
+void freq_sink_c_impl::set_plot_width(int width)
+{
+    gr::thread::scoped_lock lock(d_setlock);
+    d_plot_width = width;
+}
+
 void freq_sink_c_impl::set_fft_window_normalized(const bool enable)
 {
     d_window_normalize = enable;
@@ -419,6 +447,33 @@ bool freq_sink_c_impl::fftresize()
     return false;
 }
 
+void freq_sink_c_impl::post_update()
+{
+    // Called with d_setlock held
+    const int width = (d_reduce_width < 0) ? d_plot_width : d_reduce_width;
+    d_reducer.set_mode(d_reduce_mode);
+    d_reducer.resize(d_fftsize, width);
+
+    DisplayFrame& frame = d_display->back();
+    const int npoints = d_reducer.points();
+    if (npoints == d_fftsize) {
+        frame.assign(d_magbufs, d_fftsize);
+    } else {
+        frame.points.resize(d_magbufs.size());
+        for (size_t n = 0; n < d_magbufs.size(); n++) {
+            frame.points[n].resize(npoints);
+            d_reducer.reduce(d_magbufs[n].data(), frame.points[n].data());
+        }
+        frame.numPoints = npoints;
+    }
+
+    // Only notify the GUI if it has taken the last frame, it will
+    // pick up the latest one either way.
+    if (d_display->publish()) {
+        d_qApplication->postEvent(d_main_gui, new FreqUpdateEvent(d_display));
+    }
+}
+
 void freq_sink_c_impl::check_clicked()
 {
     if (d_main_gui->checkClicked()) {
@@ -563,8 +618,7 @@ int freq_sink_c_impl::work(int noutput_items,
             // If a trigger (FREE always triggers), plot and reset state
             if (d_triggered) {
                 d_last_time = gr::high_res_timer_now();
-                d_qApplication->postEvent(d_main_gui,
-                                          new FreqUpdateEvent(d_magbufs, d_fftsize));
+                post_update();
                 _reset();
             }
         }
@@ -651,7 +705,8 @@ void freq_sink_c_impl::handle_pdus(pmt::pmt_t msg)
         }
 
         // update gui per-pdu
-        d_qApplication->postEvent(d_main_gui, new FreqUpdateEvent(d_magbufs, d_fftsize));
+        gr::thread::scoped_lock lock(d_setlock);
+        post_update();
     }
 }
 
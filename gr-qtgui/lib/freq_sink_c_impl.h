@@ -13,11 +13,14 @@
 
 #include <gnuradio/qtgui/freq_sink_c.h>
 
+#include "display_reducer.h"
+
 #include <gnuradio/fft/fft.h>
 #include <gnuradio/fft/fft_shift.h>
 #include <gnuradio/fft/window.h>
 #include <gnuradio/high_res_timer.h>
 #include <gnuradio/qtgui/freqdisplayform.h>
+#include <gnuradio/qtgui/spectrumUpdateEvents.h>
 
 namespace gr {
 namespace qtgui {
@@ -51,6 +54,19 @@ private:
     double* d_pdu_magbuf;
     volk::vector<float> d_fbuf;
 
+    // Hands d_magbufs to the GUI thread, reduced to the plot's
+    // resolution if asked to
+    const std::shared_ptr<DisplayBuffer> d_display;
+    int d_reduce_width = 0;
+    reduction_mode d_reduce_mode = REDUCE_MAX;
+    display_reducer d_reducer;
+    void post_update();
+
+    // Plot width in pixels, posted by the GUI thread
+    int d_plot_width = 0;
+    QMetaObject::Connection d_plot_width_connection;
+    void set_plot_width(int width);
+
     // Required now for Qt; argc must be greater than 0 and argv
     // must have at least one valid character. Must be valid through
     // life of the qApplication:
@@ -123,6 +139,10 @@ public:
     fft::window::win_type fft_window() override;
     void set_fft_window_normalized(const bool enable) override;
 
+    void set_display_reduction(int width, reduction_mode mode) override;
+    int display_reduction_width() const override;
+    reduction_mode display_reduction_mode() const override;
+
     void set_frequency_range(const double centerfreq, const double bandwidth) override;
     void set_y_axis(double min, double max) override;
 
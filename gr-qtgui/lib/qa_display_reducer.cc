@@ -0,0 +1,161 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "display_reducer.h"
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using gr::qtgui::display_reducer;
+
+BOOST_AUTO_TEST_CASE(t1_max)
+{
+    display_reducer r;
+    BOOST_CHECK(r.resize(8, 4));
+    BOOST_CHECK_EQUAL(r.points(), 4);
+
+    const std::vector<double> in = { 1, 5, -3, -7, 2, 2, 0, 9 };
+    std::vector<double> out(4);
+    r.reduce(in.data(), out.data());
+    const std::vector<double> expected = { 5, -3, 2, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(t2_mean)
+{
+    display_reducer r;
+    r.set_mode(gr::qtgui::REDUCE_MEAN);
+    r.resize(8, 2);
+
+    const std::vector<double> in = { 1, 5, -3, -7, 2, 2, 0, 8 };
+    std::vector<double> out(2);
+    r.reduce(in.data(), out.data());
+    BOOST_CHECK_CLOSE(out[0], -1.0, 1e-9);
+    BOOST_CHECK_CLOSE(out[1], 3.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(t3_partial_bins)
+{
+    // 10 bins over 4 points: points cover 2, 3, 2 and 3 bins
+    display_reducer r;
+    r.resize(10, 4);
+    BOOST_CHECK_EQUAL(r.points(), 4);
+
+    const std::vector<double> in = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::vector<double> out(4);
+    r.reduce(in.data(), out.data());
+    const std::vector<double> max = { 1, 4, 6, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), max.begin(), max.end());
+
+    r.set_mode(gr::qtgui::REDUCE_MEAN);
+    r.reduce(in.data(), out.data());
+    BOOST_CHECK_CLOSE(out[0], 0.5, 1e-9);
+    BOOST_CHECK_CLOSE(out[1], 3.0, 1e-9);
+    BOOST_CHECK_CLOSE(out[2], 5.5, 1e-9);
+    BOOST_CHECK_CLOSE(out[3], 8.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(t4_passthrough)
+{
+    const std::vector<double> in = { 3, 1, 4, 1, 5 };
+    std::vector<double> out(5);
+
+    // no width, or at least as many points as bins, keeps every bin
+    for (int width : { 0, -1, 5, 64 }) {
+        display_reducer r;
+        r.resize(5, width);
+        BOOST_CHECK_EQUAL(r.points(), 5);
+        r.reduce(in.data(), out.data());
+        BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), in.begin(), in.end());
+    }
+
+    display_reducer r;
+    BOOST_CHECK(r.resize(5, 2));
+    BOOST_CHECK(!r.resize(5, 2));
+    BOOST_CHECK(r.resize(5, 0));
+}
+
+BOOST_AUTO_TEST_CASE(t5_accumulate_max)
+{
+    display_reducer r;
+    r.resize(8, 4);
+    std::vector<double> out(4);
+    BOOST_CHECK(!r.flush(out.data()));
+
+    const std::vector<double> row0 = { 1, 5, -3, -7, 2, 2, 0, 9 };
+    const std::vector<double> row1 = { 6, 0, -9, -8, 1, 3, 4, 4 };
+    const std::vector<double> row2 = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    r.accumulate(row0.data());
+    r.accumulate(row1.data());
+    r.accumulate(row2.data());
+    BOOST_CHECK_EQUAL(r.rows(), 3u);
+
+    // Each point holds the maximum over its bins of every row
+    BOOST_CHECK(r.flush(out.data()));
+    const std::vector<double> expected = { 6, 0, 3, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), expected.begin(), expected.end());
+
+    // A flush starts a new hold
+    BOOST_CHECK_EQUAL(r.rows(), 0u);
+    BOOST_CHECK(!r.flush(out.data()));
+    r.accumulate(row2.data());
+    BOOST_CHECK(r.flush(out.data()));
+    const std::vector<double> zeros(4, 0.0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), zeros.begin(), zeros.end());
+}
+
+BOOST_AUTO_TEST_CASE(t6_accumulate_mean)
+{
+    display_reducer r;
+    r.set_mode(gr::qtgui::REDUCE_MEAN);
+    r.resize(8, 2);
+
+    const std::vector<double> row0 = { 1, 5, -3, -7, 2, 2, 0, 8 };
+    const std::vector<double> row1 = { 3, 3, 3, 3, -4, -4, -4, -4 };
+    r.accumulate(row0.data());
+    r.accumulate(row1.data());
+
+    // Means of the rows reduced to -1, 3 and 3, -4
+    std::vector<double> out(2);
+    BOOST_CHECK(r.flush(out.data()));
+    BOOST_CHECK_CLOSE(out[0], 1.0, 1e-9);
+    BOOST_CHECK_CLOSE(out[1], -0.5, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(t7_accumulate_reset)
+{
+    const std::vector<double> row = { 1, 2, 3, 4 };
+    std::vector<double> out(4);
+
+    // Resizing drops the rows held so far
+    display_reducer r;
+    r.resize(4, 2);
+    r.accumulate(row.data());
+    BOOST_CHECK(r.resize(4, 0));
+    BOOST_CHECK(!r.flush(out.data()));
+
+    // So does changing the mode, rows held as a sum are not maxima
+    r.accumulate(row.data());
+    r.set_mode(gr::qtgui::REDUCE_MAX);
+    BOOST_CHECK_EQUAL(r.rows(), 1u);
+    r.set_mode(gr::qtgui::REDUCE_MEAN);
+    BOOST_CHECK_EQUAL(r.rows(), 0u);
+
+    // Without reduction rows are still combined bin by bin
+    const std::vector<double> other = { 3, 0, 5, 2 };
+    r.accumulate(row.data());
+    r.accumulate(other.data());
+    BOOST_CHECK(r.flush(out.data()));
+    const std::vector<double> mean = { 2, 1, 4, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), mean.begin(), mean.end());
+}
@@ -12,6 +12,7 @@
 #define SPECTRUM_UPDATE_EVENTS_C
 
 #include <gnuradio/qtgui/spectrumUpdateEvents.h>
+#include <algorithm>
 
 SpectrumUpdateEvent::SpectrumUpdateEvent(const float* fft_points,
                                          const uint64_t numFFTDataPoints,
@@ -128,6 +129,28 @@ double SpectrumFrequencyRangeEvent::GetStopFrequency() const { return _stopFrequ
 /***************************************************************************/
 
 
+void DisplayFrame::assign(const std::vector<volk::vector<double>>& data, uint64_t n)
+{
+    points.resize(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        if (points[i].size() != n) {
+            points[i].resize(n);
+        }
+        memcpy(points[i].data(), data[i].data(), n * sizeof(double));
+    }
+    numPoints = n;
+}
+
+static std::vector<double*> frame_points(const DisplayFrame& frame)
+{
+    std::vector<double*> points;
+    for (const auto& p : frame.points) {
+        points.push_back(const_cast<double*>(p.data()));
+    }
+    return points;
+}
+
+
 TimeUpdateEvent::TimeUpdateEvent(const std::vector<volk::vector<double>> timeDomainPoints,
                                  const uint64_t numTimeDomainDataPoints,
                                  const std::vector<std::vector<gr::tag_t>> tags)
@@ -153,6 +176,14 @@ TimeUpdateEvent::TimeUpdateEvent(const std::vector<volk::vector<double>> timeDom
     _tags = tags;
 }
 
+TimeUpdateEvent::TimeUpdateEvent(std::shared_ptr<DisplayBuffer> display)
+    : QEvent(QEvent::Type(SpectrumUpdateEventType)),
+      _nplots(0),
+      _numTimeDomainDataPoints(0),
+      _display(display)
+{
+}
+
 TimeUpdateEvent::~TimeUpdateEvent()
 {
     for (size_t i = 0; i < _nplots; i++) {
@@ -160,18 +191,36 @@ TimeUpdateEvent::~TimeUpdateEvent()
     }
 }
 
+const DisplayFrame& TimeUpdateEvent::frame() const
+{
+    if (_frame == nullptr) {
+        _display->acquire();
+        _frame = &_display->front();
+    }
+    return *_frame;
+}
+
 const std::vector<double*> TimeUpdateEvent::getTimeDomainPoints() const
 {
+    if (_display) {
+        return frame_points(frame());
+    }
     return _dataTimeDomainPoints;
 }
 
 uint64_t TimeUpdateEvent::getNumTimeDomainDataPoints() const
 {
+    if (_display) {
+        return std::max<uint64_t>(frame().numPoints, 1);
+    }
     return _numTimeDomainDataPoints;
 }
 
 const std::vector<std::vector<gr::tag_t>> TimeUpdateEvent::getTags() const
 {
+    if (_display) {
+        return frame().tags;
+    }
     return _tags;
 }
 
@@ -198,6 +247,14 @@ FreqUpdateEvent::FreqUpdateEvent(const std::vector<volk::vector<double>> dataPoi
     }
 }
 
+FreqUpdateEvent::FreqUpdateEvent(std::shared_ptr<DisplayBuffer> display)
+    : QEvent(QEvent::Type(SpectrumUpdateEventType)),
+      _nplots(0),
+      _numDataPoints(0),
+      _display(display)
+{
+}
+
 FreqUpdateEvent::~FreqUpdateEvent()
 {
     for (size_t i = 0; i < _nplots; i++) {
@@ -205,9 +262,30 @@ FreqUpdateEvent::~FreqUpdateEvent()
     }
 }
 
-const std::vector<double*> FreqUpdateEvent::getPoints() const { return _dataPoints; }
+const DisplayFrame& FreqUpdateEvent::frame() const
+{
+    if (_frame == nullptr) {
+        _display->acquire();
+        _frame = &_display->front();
+    }
+    return *_frame;
+}
+
+const std::vector<double*> FreqUpdateEvent::getPoints() const
+{
+    if (_display) {
+        return frame_points(frame());
+    }
+    return _dataPoints;
+}
 
-uint64_t FreqUpdateEvent::getNumDataPoints() const { return _numDataPoints; }
+uint64_t FreqUpdateEvent::getNumDataPoints() const
+{
+    if (_display) {
+        return std::max<uint64_t>(frame().numPoints, 1);
+    }
+    return _numDataPoints;
+}
 
 
 SetFreqEvent::SetFreqEvent(const double centerFreq, const double bandwidth)
@@ -51,6 +51,7 @@ time_sink_c_impl::time_sink_c_impl(int size,
       d_name(name),
       d_nconnections(2 * nconnections),
       d_tag_key(pmt::mp("tags")),
+      d_display(std::make_shared<DisplayBuffer>()),
       d_parent(parent)
 {
     if (nconnections > 12)
@@ -540,19 +541,18 @@ int time_sink_c_impl::work(int noutput_items,
 
     // If we've have a trigger and a full d_size of items in the buffers, plot.
     if ((d_triggered) && (d_index == d_end)) {
-        // Copy data to be plotted to start of buffers.
-        for (n = 0; n < d_nconnections / 2; n++) {
-            volk_32fc_deinterleave_64f_x2(d_buffers[2 * n + 0].data(),
-                                          d_buffers[2 * n + 1].data(),
-                                          &d_cbuffers[n][d_start],
-                                          d_size);
-        }
-
         // Plot if we are able to update
         if (gr::high_res_timer_now() - d_last_time > d_update_time) {
             d_last_time = gr::high_res_timer_now();
-            d_qApplication->postEvent(d_main_gui,
-                                      new TimeUpdateEvent(d_buffers, d_size, d_tags));
+
+            // Copy data to be plotted to start of buffers.
+            for (n = 0; n < d_nconnections / 2; n++) {
+                volk_32fc_deinterleave_64f_x2(d_buffers[2 * n + 0].data(),
+                                              d_buffers[2 * n + 1].data(),
+                                              &d_cbuffers[n][d_start],
+                                              d_size);
+            }
+            post_update(d_size, d_tags);
         }
 
         // We've plotting, so reset the state
@@ -630,7 +630,20 @@ void time_sink_c_impl::handle_pdus(pmt::pmt_t msg)
                                       in,
                                       len);
 
-        d_qApplication->postEvent(d_main_gui, new TimeUpdateEvent(d_buffers, len, t));
+        post_update(len, t);
+    }
+}
+
+void time_sink_c_impl::post_update(uint64_t npoints,
+                                   const std::vector<std::vector<gr::tag_t>>& tags)
+{
+    // Only notify the GUI if it has taken the last frame, it will
+    // pick up the latest one either way.
+    DisplayFrame& frame = d_display->back();
+    frame.assign(d_buffers, npoints);
+    frame.tags = tags;
+    if (d_display->publish()) {
+        d_qApplication->postEvent(d_main_gui, new TimeUpdateEvent(d_display));
     }
 }
 
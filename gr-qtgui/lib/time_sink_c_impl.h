@@ -14,6 +14,7 @@
 #include <gnuradio/qtgui/time_sink_c.h>
 
 #include <gnuradio/high_res_timer.h>
+#include <gnuradio/qtgui/spectrumUpdateEvents.h>
 #include <gnuradio/qtgui/timedisplayform.h>
 
 namespace gr {
@@ -36,6 +37,10 @@ private:
     std::vector<volk::vector<double>> d_buffers;
     std::vector<std::vector<gr::tag_t>> d_tags;
 
+    // Hands d_buffers to the GUI thread
+    const std::shared_ptr<DisplayBuffer> d_display;
+    void post_update(uint64_t npoints, const std::vector<std::vector<gr::tag_t>>& tags);
+
     // Required now for Qt; argc must be greater than 0 and argv
     // must have at least one valid character. Must be valid through
     // life of the qApplication:
@@ -63,6 +63,8 @@ waterfall_sink_c_impl::waterfall_sink_c_impl(int fftsize,
       d_residbufs(d_nconnections + 1), // One extra "connection" for the PDU memory.
       d_magbufs(d_nconnections + 1),   // One extra "connection" for the PDU memory.
       d_fbuf(fftsize),
+      d_reducers(d_nconnections + 1),
+      d_reduced(d_nconnections + 1),
       d_parent(parent)
 {
     resize_bufs(d_fftsize);
@@ -71,6 +73,8 @@ waterfall_sink_c_impl::waterfall_sink_c_impl(int fftsize,
 
     initialize();
 
+    update_reduction();
+
     // setup bw input port
     message_port_register_in(d_port_bw);
     set_msg_handler(d_port_bw, [this](pmt::pmt_t msg) { this->handle_set_bw(msg); });
@@ -88,6 +92,7 @@ waterfall_sink_c_impl::waterfall_sink_c_impl(int fftsize,
 
 waterfall_sink_c_impl::~waterfall_sink_c_impl()
 {
+    QObject::disconnect(d_plot_width_connection);
     if (!d_main_gui->isClosed())
         d_main_gui->close();
 }
@@ -119,6 +124,10 @@ void waterfall_sink_c_impl::initialize()
 
     int numplots = (d_nconnections > 0) ? d_nconnections : 1;
     d_main_gui = new WaterfallDisplayForm(numplots, d_parent);
+    d_plot_width_connection =
+        QObject::connect(d_main_gui,
+                         &DisplayForm::plotWidthChanged,
+                         [this](int width) { this->set_plot_width(width); });
     set_fft_window(d_wintype);
     set_fft_size(d_fftsize);
     set_frequency_range(d_center_freq, d_bandwidth);
@@ -157,6 +166,31 @@ void waterfall_sink_c_impl::set_fft_window(const fft::window::win_type win)
 
 fft::window::win_type waterfall_sink_c_impl::fft_window() { return d_wintype; }
 
+void waterfall_sink_c_impl::set_display_reduction(int width, reduction_mode mode)
+{
+    if (width < -1) {
+        throw std::invalid_argument(
+            "waterfall_sink_c: display reduction width must be -1 or larger.");
+    }
+
+    gr::thread::scoped_lock lock(d_setlock);
+    d_reduce_width = width;
+    d_reduce_mode = mode;
+}
+
+int waterfall_sink_c_impl::display_reduction_width() const { return d_reduce_width; }
+
+reduction_mode waterfall_sink_c_impl::display_reduction_mode() const
+{
+    return d_reduce_mode;
+}
+
+void waterfall_sink_c_impl::set_plot_width(int width)
+{
+    gr::thread::scoped_lock lock(d_setlock);
+    d_plot_width = width;
+}
+
 void waterfall_sink_c_impl::set_frequency_range(const double centerfreq,
                                                 const double bandwidth)
 {
@@ -328,6 +362,27 @@ void waterfall_sink_c_impl::fftresize()
 
         d_last_time = 0;
     }
+
+    update_reduction();
+}
+
+void waterfall_sink_c_impl::update_reduction()
+{
+    d_reducing = (d_reduce_width != 0);
+    const int width = (d_reduce_width < 0) ? d_plot_width : d_reduce_width;
+
+    for (size_t n = 0; n < d_reducers.size(); n++) {
+        d_reducers[n].set_mode(d_reduce_mode);
+        d_reducers[n].resize(d_fftsize, width);
+
+        // The PDU buffer holds all rows of the plot
+        const size_t nrows = (n == d_reducers.size() - 1) ? d_nrows : 1;
+        const size_t size = d_reducing ? d_reducers[n].points() * nrows : 0;
+        if (d_reduced[n].size() != size) {
+            d_reduced[n].clear();
+            d_reduced[n].resize(size);
+        }
+    }
 }
 
 void waterfall_sink_c_impl::check_clicked()
@@ -383,7 +438,9 @@ int waterfall_sink_c_impl::work(int noutput_items,
         // If we have enough input for one full FFT, do it
         if (datasize >= resid) {
 
-            if (gr::high_res_timer_now() - d_last_time > d_update_time) {
+            // When reducing, every FFT goes into the next row displayed
+            const bool update = gr::high_res_timer_now() - d_last_time > d_update_time;
+            if (update || d_reducing) {
                 for (int n = 0; n < d_nconnections; n++) {
                     // Fill up residbuf with d_fftsize number of items
                     in = (const gr_complex*)input_items[n];
@@ -397,12 +454,28 @@ int waterfall_sink_c_impl::work(int noutput_items,
                                                    (d_fftavg)*d_fbuf[x]);
                     }
                     // volk_32f_convert_64f(d_magbufs[n], d_fbuf, d_fftsize);
+
+                    if (d_reducing) {
+                        d_reducers[n].accumulate(d_magbufs[n].data());
+                    }
                 }
+            }
 
+            if (update) {
                 d_last_time = gr::high_res_timer_now();
-                d_qApplication->postEvent(
-                    d_main_gui,
-                    new WaterfallUpdateEvent(d_magbufs, d_fftsize, d_last_time));
+                if (d_reducing) {
+                    for (int n = 0; n < d_nconnections; n++) {
+                        d_reducers[n].flush(d_reduced[n].data());
+                    }
+                    d_qApplication->postEvent(
+                        d_main_gui,
+                        new WaterfallUpdateEvent(
+                            d_reduced, d_reducers[0].points(), d_last_time));
+                } else {
+                    d_qApplication->postEvent(
+                        d_main_gui,
+                        new WaterfallUpdateEvent(d_magbufs, d_fftsize, d_last_time));
+                }
             }
 
             d_index = 0;
@@ -504,8 +577,19 @@ void waterfall_sink_c_impl::handle_pdus(pmt::pmt_t msg)
         }
 
         // update gui per-pdu
-        d_qApplication->postEvent(
-            d_main_gui, new WaterfallUpdateEvent(d_magbufs, d_fftsize * d_nrows, 0));
+        if (d_reducing) {
+            display_reducer& reducer = d_reducers[d_nconnections];
+            const int npoints = reducer.points();
+            for (j = 0; j < d_nrows; j++) {
+                reducer.reduce(&d_pdu_magbuf[j * d_fftsize],
+                               &d_reduced[d_nconnections][j * npoints]);
+            }
+            d_qApplication->postEvent(
+                d_main_gui, new WaterfallUpdateEvent(d_reduced, npoints * d_nrows, 0));
+        } else {
+            d_qApplication->postEvent(
+                d_main_gui, new WaterfallUpdateEvent(d_magbufs, d_fftsize * d_nrows, 0));
+        }
     }
 }
 
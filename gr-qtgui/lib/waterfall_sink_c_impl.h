@@ -13,6 +13,8 @@
 
 #include <gnuradio/qtgui/waterfall_sink_c.h>
 
+#include "display_reducer.h"
+
 #include <gnuradio/fft/fft.h>
 #include <gnuradio/fft/fft_shift.h>
 #include <gnuradio/fft/window.h>
@@ -53,6 +55,20 @@ private:
     double* d_pdu_magbuf;
     volk::vector<float> d_fbuf;
 
+    // Reduction of the rows to the plot's resolution, see
+    // set_display_reduction()
+    int d_reduce_width = 0;
+    reduction_mode d_reduce_mode = REDUCE_MAX;
+    bool d_reducing = false;
+    std::vector<display_reducer> d_reducers;
+    std::vector<volk::vector<double>> d_reduced;
+    void update_reduction();
+
+    // Plot width in pixels, posted by the GUI thread
+    int d_plot_width = 0;
+    QMetaObject::Connection d_plot_width_connection;
+    void set_plot_width(int width);
+
     // Required now for Qt; argc must be greater than 0 and argv
     // must have at least one valid character. Must be valid through
     // life of the qApplication:
@@ -108,6 +124,10 @@ public:
     void set_fft_window(const gr::fft::window::win_type win) override;
     gr::fft::window::win_type fft_window() override;
 
+    void set_display_reduction(int width, reduction_mode mode) override;
+    int display_reduction_width() const override;
+    reduction_mode display_reduction_mode() const override;
+
     void set_frequency_range(const double centerfreq, const double bandwidth) override;
     void set_intensity_range(const double min, const double max) override;
 
@@ -97,6 +97,23 @@ void bind_freq_sink_c(py::module& m)
              D(freq_sink_c, set_fft_window_normalized))
 
 
+        .def("set_display_reduction",
+             &freq_sink_c::set_display_reduction,
+             py::arg("width"),
+             py::arg("mode") = ::gr::qtgui::REDUCE_MAX,
+             D(freq_sink_c, set_display_reduction))
+
+
+        .def("display_reduction_width",
+             &freq_sink_c::display_reduction_width,
+             D(freq_sink_c, display_reduction_width))
+
+
+        .def("display_reduction_mode",
+             &freq_sink_c::display_reduction_mode,
+             D(freq_sink_c, display_reduction_mode))
+
+
         .def("set_frequency_range",
              &freq_sink_c::set_frequency_range,
              py::arg("centerfreq"),
@@ -48,6 +48,7 @@ void bind_numberdisplayform(py::module&);
 // void bind_plot_raster(py::module&);
 // void bind_plot_waterfall(py::module&);
 void bind_qtgui_types(py::module&);
+void bind_reduction_mode(py::module&);
 void bind_sink_c(py::module&);
 void bind_sink_f(py::module&);
 // void bind_spectrumUpdateEvents(py::module&);
@@ -99,6 +100,8 @@ PYBIND11_MODULE(qtgui_python, m)
     // bind_TimeRasterDisplayPlot(m);
     // bind_VectorDisplayPlot(m);
     // bind_WaterfallDisplayPlot(m);
+    // Used in default arguments of the sinks
+    bind_reduction_mode(m);
     bind_ber_sink_b(m);
     bind_const_sink_c(m);
     // bind_constellationdisplayform(m);
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/* This file is automatically generated using bindtool */
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/qtgui/reduction_mode.h>
+// pydoc.h is automatically generated in the build directory
+#include <reduction_mode_pydoc.h>
+
+void bind_reduction_mode(py::module& m)
+{
+    py::enum_<::gr::qtgui::reduction_mode>(m, "reduction_mode")
+        .value("REDUCE_MAX", ::gr::qtgui::REDUCE_MAX)   // 0
+        .value("REDUCE_MEAN", ::gr::qtgui::REDUCE_MEAN) // 1
+        .export_values();
+
+    py::implicitly_convertible<int, ::gr::qtgui::reduction_mode>();
+}
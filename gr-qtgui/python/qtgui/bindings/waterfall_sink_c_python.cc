@@ -106,6 +106,23 @@ void bind_waterfall_sink_c(py::module& m)
         .def("fft_window", &waterfall_sink_c::fft_window, D(waterfall_sink_c, fft_window))
 
 
+        .def("set_display_reduction",
+             &waterfall_sink_c::set_display_reduction,
+             py::arg("width"),
+             py::arg("mode") = ::gr::qtgui::REDUCE_MAX,
+             D(waterfall_sink_c, set_display_reduction))
+
+
+        .def("display_reduction_width",
+             &waterfall_sink_c::display_reduction_width,
+             D(waterfall_sink_c, display_reduction_width))
+
+
+        .def("display_reduction_mode",
+             &waterfall_sink_c::display_reduction_mode,
+             D(waterfall_sink_c, display_reduction_mode))
+
+
         .def("set_frequency_range",
              &waterfall_sink_c::set_frequency_range,
              py::arg("centerfreq"),
@@ -82,6 +82,20 @@ class test_qtgui(gr_unittest.TestCase):
         self.qtsnk = qtgui.matrix_sink("Doppler", 2, 4, False,
                                        "rgb", "BilinearInterpolation", None)
 
+    def test16(self):
+        for make in (qtgui.freq_sink_c, qtgui.waterfall_sink_c):
+            self.qtsnk = make(65536, 5, 0, 1, "Test", 1, None)
+            self.assertEqual(self.qtsnk.display_reduction_width(), 0)
+            self.qtsnk.set_display_reduction(-1, qtgui.REDUCE_MEAN)
+            self.assertEqual(self.qtsnk.display_reduction_width(), -1)
+            self.assertEqual(self.qtsnk.display_reduction_mode(),
+                             qtgui.REDUCE_MEAN)
+            self.qtsnk.set_display_reduction(1024)
+            self.assertEqual(self.qtsnk.display_reduction_mode(),
+                             qtgui.REDUCE_MAX)
+            with self.assertRaises(ValueError):
+                self.qtsnk.set_display_reduction(-2)
+
 
 if __name__ == '__main__':
     gr_unittest.run(test_qtgui)
@@ -42,6 +42,18 @@ public:
     virtual void set_K(int K) = 0;
     virtual void set_S0(int S0) = 0;
     virtual void set_SK(int SK) = 0;
+
+    /*!
+     * \brief Decodes with a sliding traceback window of \p depth steps
+     * instead of tracing back over each block of K steps.
+     *
+     * The window bounds the decision memory to 2 * depth steps for long
+     * blocks, but may decide differently from the full traceback where
+     * survivors have not merged within depth steps. 0, the default, is
+     * the full traceback.
+     */
+    virtual void set_traceback_depth(int depth) = 0;
+    virtual int traceback_depth() const = 0;
 };
 
 typedef viterbi<std::uint8_t> viterbi_b;
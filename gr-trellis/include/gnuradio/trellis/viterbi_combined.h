@@ -53,6 +53,33 @@ public:
     virtual void set_D(int D) = 0;
     virtual void set_TABLE(const std::vector<IN_T>& table) = 0;
     virtual void set_TYPE(digital::trellis_metric_type_t type) = 0;
+
+    /*!
+     * \brief Decodes with a sliding traceback window of \p depth steps
+     * instead of tracing back over each block of K steps.
+     *
+     * The window bounds the decision memory to 2 * depth steps for long
+     * blocks, but may decide differently from the full traceback where
+     * survivors have not merged within depth steps. 0, the default, is
+     * the full traceback.
+     */
+    virtual void set_traceback_depth(int depth) = 0;
+    virtual int traceback_depth() const = 0;
+
+    /*!
+     * \brief Keeps the path metrics in \p bits bit saturating fixed
+     * point instead of float: 32, 16 or 8. 0, the default, is float.
+     *
+     * Narrower metrics let more states share a vector instruction. The
+     * branch metrics of each block are quantized with the finest step
+     * for which the path metrics cannot saturate, so 16 and 32 bit
+     * metrics decode like float, while the coarse steps of 8 bit metrics
+     * may decide differently on noisy input. FSMs whose states do not
+     * all reach each other within a fixed number of steps are always
+     * decoded with float metrics.
+     */
+    virtual void set_metric_bits(int bits) = 0;
+    virtual int metric_bits() const = 0;
 };
 
 typedef viterbi_combined<std::int16_t, std::uint8_t> viterbi_combined_sb;
@@ -8,6 +8,7 @@
  *
  */
 
+#include "trellis_kernels.h"
 #include <gnuradio/trellis/calc_metric.h>
 #include <gnuradio/trellis/core_algorithms.h>
 #include <cstring>
@@ -41,61 +42,7 @@ void viterbi_algorithm(int I,
                        T* out) //,
                                // std::vector<int> &trace)
 {
-    std::vector<int> trace(S * K);
-    std::vector<float> alpha(S * 2);
-    int alphai;
-    float norm, mm, minm;
-    int minmi;
-    int st;
-
-    if (S0 < 0) { // initial state not specified
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = INF;
-        alpha[0 * S + S0] = 0.0;
-    }
-
-    alphai = 0;
-    for (int k = 0; k < K; k++) {
-        norm = INF;
-        for (int j = 0; j < S; j++) { // for each next state do ACS
-            minm = INF;
-            minmi = 0;
-            for (unsigned int i = 0; i < PS[j].size(); i++) {
-                // int i0 = j*I+i;
-                if ((mm = alpha[alphai * S + PS[j][i]] +
-                          in[k * O + OS[PS[j][i] * I + PI[j][i]]]) < minm)
-                    minm = mm, minmi = i;
-            }
-            trace[k * S + j] = minmi;
-            alpha[((alphai + 1) % 2) * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            alpha[((alphai + 1) % 2) * S + j] -=
-                norm; // normalize total metrics so they do not explode
-        alphai = (alphai + 1) % 2;
-    }
-
-    if (SK < 0) { // final state not specified
-        minm = INF;
-        minmi = 0;
-        for (int i = 0; i < S; i++)
-            if ((mm = alpha[alphai * S + i]) < minm)
-                minm = mm, minmi = i;
-        st = minmi;
-    } else {
-        st = SK;
-    }
-
-    for (int k = K - 1; k >= 0; k--) { // traceback
-        int i0 = trace[k * S + st];
-        out[k] = (T)PI[st][i0];
-        st = PS[st][i0];
-    }
+    viterbi_kernel<float>(trellis_tables(I, S, O, NS, OS, PS, PI), K, S0, SK, in, out);
 }
 
 template void viterbi_algorithm<unsigned char>(int I,
@@ -156,63 +103,12 @@ void viterbi_algorithm_combined(int I,
                                 const Ti* in,
                                 To* out)
 {
-    std::vector<int> trace(S * K);
-    std::vector<float> alpha(S * 2);
-    std::vector<float> metric(O);
-    int alphai;
-    float norm, mm, minm;
-    int minmi;
-    int st;
-
-    if (S0 < 0) { // initial state not specified
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = INF;
-        alpha[0 * S + S0] = 0.0;
-    }
-
-    alphai = 0;
+    std::vector<float> metric(K * O);
     for (int k = 0; k < K; k++) {
-        calc_metric(O, D, TABLE, &(in[k * D]), metric.data(), TYPE); // calc metrics
-        norm = INF;
-        for (int j = 0; j < S; j++) { // for each next state do ACS
-            minm = INF;
-            minmi = 0;
-            for (unsigned int i = 0; i < PS[j].size(); i++) {
-                // int i0 = j*I+i;
-                if ((mm = alpha[alphai * S + PS[j][i]] +
-                          metric[OS[PS[j][i] * I + PI[j][i]]]) < minm)
-                    minm = mm, minmi = i;
-            }
-            trace[k * S + j] = minmi;
-            alpha[((alphai + 1) % 2) * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            alpha[((alphai + 1) % 2) * S + j] -=
-                norm; // normalize total metrics so they do not explode
-        alphai = (alphai + 1) % 2;
-    }
-
-    if (SK < 0) { // final state not specified
-        minm = INF;
-        minmi = 0;
-        for (int i = 0; i < S; i++)
-            if ((mm = alpha[alphai * S + i]) < minm)
-                minm = mm, minmi = i;
-        st = minmi;
-    } else {
-        st = SK;
-    }
-
-    for (int k = K - 1; k >= 0; k--) { // traceback
-        int i0 = trace[k * S + st];
-        out[k] = (To)PI[st][i0];
-        st = PS[st][i0];
+        calc_metric(O, D, TABLE, &(in[k * D]), &(metric[k * O]), TYPE); // calc metrics
     }
+    viterbi_kernel<float>(
+        trellis_tables(I, S, O, NS, OS, PS, PI), K, S0, SK, metric.data(), out);
 }
 
 // Ti = s i f c
@@ -501,141 +397,16 @@ void siso_algorithm(int I,
                                 // std::vector<float> &beta
 )
 {
-    float norm, mm, minm;
-    std::vector<float> alpha(S * (K + 1));
-    std::vector<float> beta(S * (K + 1));
-
-    if (S0 < 0) { // initial state not specified
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = INF;
-        alpha[0 * S + S0] = 0.0;
-    }
-
-    for (int k = 0; k < K; k++) { // forward recursion
-        norm = INF;
-        for (int j = 0; j < S; j++) {
-            minm = INF;
-            for (unsigned int i = 0; i < PS[j].size(); i++) {
-                // int i0 = j*I+i;
-                mm = alpha[k * S + PS[j][i]] + priori[k * I + PI[j][i]] +
-                     prioro[k * O + OS[PS[j][i] * I + PI[j][i]]];
-                minm = (*p2mymin)(minm, mm);
-            }
-            alpha[(k + 1) * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            alpha[(k + 1) * S + j] -=
-                norm; // normalize total metrics so they do not explode
-    }
-
-    if (SK < 0) { // final state not specified
-        for (int i = 0; i < S; i++)
-            beta[K * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            beta[K * S + i] = INF;
-        beta[K * S + SK] = 0.0;
-    }
-
-    for (int k = K - 1; k >= 0; k--) { // backward recursion
-        norm = INF;
-        for (int j = 0; j < S; j++) {
-            minm = INF;
-            for (int i = 0; i < I; i++) {
-                int i0 = j * I + i;
-                mm = beta[(k + 1) * S + NS[i0]] + priori[k * I + i] +
-                     prioro[k * O + OS[i0]];
-                minm = (*p2mymin)(minm, mm);
-            }
-            beta[k * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            beta[k * S + j] -= norm; // normalize total metrics so they do not explode
-    }
-
-    if (POSTI && POSTO) {
-        for (int k = 0; k < K; k++) { // input combining
-            norm = INF;
-            for (int i = 0; i < I; i++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    mm = alpha[k * S + j] + prioro[k * O + OS[j * I + i]] +
-                         beta[(k + 1) * S + NS[j * I + i]];
-                    minm = (*p2mymin)(minm, mm);
-                }
-                post[k * (I + O) + i] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int i = 0; i < I; i++)
-                post[k * (I + O) + i] -= norm; // normalize metrics
-        }
-
-        for (int k = 0; k < K; k++) { // output combining
-            norm = INF;
-            for (int n = 0; n < O; n++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    for (int i = 0; i < I; i++) {
-                        mm = (n == OS[j * I + i] ? alpha[k * S + j] + priori[k * I + i] +
-                                                       beta[(k + 1) * S + NS[j * I + i]]
-                                                 : INF);
-                        minm = (*p2mymin)(minm, mm);
-                    }
-                }
-                post[k * (I + O) + I + n] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int n = 0; n < O; n++)
-                post[k * (I + O) + I + n] -= norm; // normalize metrics
-        }
-    } else if (POSTI) {
-        for (int k = 0; k < K; k++) { // input combining
-            norm = INF;
-            for (int i = 0; i < I; i++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    mm = alpha[k * S + j] + prioro[k * O + OS[j * I + i]] +
-                         beta[(k + 1) * S + NS[j * I + i]];
-                    minm = (*p2mymin)(minm, mm);
-                }
-                post[k * I + i] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int i = 0; i < I; i++)
-                post[k * I + i] -= norm; // normalize metrics
-        }
-    } else if (POSTO) {
-        for (int k = 0; k < K; k++) { // output combining
-            norm = INF;
-            for (int n = 0; n < O; n++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    for (int i = 0; i < I; i++) {
-                        mm = (n == OS[j * I + i] ? alpha[k * S + j] + priori[k * I + i] +
-                                                       beta[(k + 1) * S + NS[j * I + i]]
-                                                 : INF);
-                        minm = (*p2mymin)(minm, mm);
-                    }
-                }
-                post[k * O + n] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int n = 0; n < O; n++)
-                post[k * O + n] -= norm; // normalize metrics
-        }
-    } else
-        throw std::runtime_error("Not both POSTI and POSTO can be false.");
+    siso_kernel(trellis_tables(I, S, O, NS, OS, PS, PI),
+                K,
+                S0,
+                SK,
+                POSTI,
+                POSTO,
+                p2mymin,
+                priori,
+                prioro,
+                post);
 }
 
 //===========================================================
@@ -661,144 +432,21 @@ void siso_algorithm_combined(int I,
                              const T* observations,
                              float* post)
 {
-    float norm, mm, minm;
-    std::vector<float> alpha(S * (K + 1));
-    std::vector<float> beta(S * (K + 1));
     std::vector<float> prioro(O * K);
-
-    if (S0 < 0) { // initial state not specified
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            alpha[0 * S + i] = INF;
-        alpha[0 * S + S0] = 0.0;
-    }
-
-    for (int k = 0; k < K; k++) { // forward recursion
+    for (int k = 0; k < K; k++) {
         calc_metric(
             O, D, TABLE, &(observations[k * D]), &(prioro[k * O]), TYPE); // calc metrics
-        norm = INF;
-        for (int j = 0; j < S; j++) {
-            minm = INF;
-            for (unsigned int i = 0; i < PS[j].size(); i++) {
-                // int i0 = j*I+i;
-                mm = alpha[k * S + PS[j][i]] + priori[k * I + PI[j][i]] +
-                     prioro[k * O + OS[PS[j][i] * I + PI[j][i]]];
-                minm = (*p2mymin)(minm, mm);
-            }
-            alpha[(k + 1) * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            alpha[(k + 1) * S + j] -=
-                norm; // normalize total metrics so they do not explode
-    }
-
-    if (SK < 0) { // final state not specified
-        for (int i = 0; i < S; i++)
-            beta[K * S + i] = 0;
-    } else {
-        for (int i = 0; i < S; i++)
-            beta[K * S + i] = INF;
-        beta[K * S + SK] = 0.0;
-    }
-
-    for (int k = K - 1; k >= 0; k--) { // backward recursion
-        norm = INF;
-        for (int j = 0; j < S; j++) {
-            minm = INF;
-            for (int i = 0; i < I; i++) {
-                int i0 = j * I + i;
-                mm = beta[(k + 1) * S + NS[i0]] + priori[k * I + i] +
-                     prioro[k * O + OS[i0]];
-                minm = (*p2mymin)(minm, mm);
-            }
-            beta[k * S + j] = minm;
-            if (minm < norm)
-                norm = minm;
-        }
-        for (int j = 0; j < S; j++)
-            beta[k * S + j] -= norm; // normalize total metrics so they do not explode
     }
-
-    if (POSTI && POSTO) {
-        for (int k = 0; k < K; k++) { // input combining
-            norm = INF;
-            for (int i = 0; i < I; i++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    mm = alpha[k * S + j] + prioro[k * O + OS[j * I + i]] +
-                         beta[(k + 1) * S + NS[j * I + i]];
-                    minm = (*p2mymin)(minm, mm);
-                }
-                post[k * (I + O) + i] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int i = 0; i < I; i++)
-                post[k * (I + O) + i] -= norm; // normalize metrics
-        }
-
-        for (int k = 0; k < K; k++) { // output combining
-            norm = INF;
-            for (int n = 0; n < O; n++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    for (int i = 0; i < I; i++) {
-                        mm = (n == OS[j * I + i] ? alpha[k * S + j] + priori[k * I + i] +
-                                                       beta[(k + 1) * S + NS[j * I + i]]
-                                                 : INF);
-                        minm = (*p2mymin)(minm, mm);
-                    }
-                }
-                post[k * (I + O) + I + n] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int n = 0; n < O; n++)
-                post[k * (I + O) + I + n] -= norm; // normalize metrics
-        }
-    } else if (POSTI) {
-        for (int k = 0; k < K; k++) { // input combining
-            norm = INF;
-            for (int i = 0; i < I; i++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    mm = alpha[k * S + j] + prioro[k * O + OS[j * I + i]] +
-                         beta[(k + 1) * S + NS[j * I + i]];
-                    minm = (*p2mymin)(minm, mm);
-                }
-                post[k * I + i] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int i = 0; i < I; i++)
-                post[k * I + i] -= norm; // normalize metrics
-        }
-    } else if (POSTO) {
-        for (int k = 0; k < K; k++) { // output combining
-            norm = INF;
-            for (int n = 0; n < O; n++) {
-                minm = INF;
-                for (int j = 0; j < S; j++) {
-                    for (int i = 0; i < I; i++) {
-                        mm = (n == OS[j * I + i] ? alpha[k * S + j] + priori[k * I + i] +
-                                                       beta[(k + 1) * S + NS[j * I + i]]
-                                                 : INF);
-                        minm = (*p2mymin)(minm, mm);
-                    }
-                }
-                post[k * O + n] = minm;
-                if (minm < norm)
-                    norm = minm;
-            }
-            for (int n = 0; n < O; n++)
-                post[k * O + n] -= norm; // normalize metrics
-        }
-    } else
-        throw std::runtime_error("Not both POSTI and POSTO can be false.");
+    siso_kernel(trellis_tables(I, S, O, NS, OS, PS, PI),
+                K,
+                S0,
+                SK,
+                POSTI,
+                POSTO,
+                p2mymin,
+                priori,
+                prioro.data(),
+                post);
 }
 
 //---------
@@ -903,6 +551,9 @@ void sccc_decoder_combined(const fsm& FSMo,
                            const Ti* observations,
                            To* data)
 {
+    const trellis_tables tablesi(FSMi);
+    const trellis_tables tableso(FSMo);
+
     // allocate space for priori, prioro and posti of inner FSM
     std::vector<float> ipriori(blocklength * FSMi.I(), 0.0);
     std::vector<float> iprioro(blocklength * FSMi.O());
@@ -927,22 +578,16 @@ void sccc_decoder_combined(const fsm& FSMo,
 
     for (int rep = 0; rep < iterations; rep++) {
         // run inner SISO
-        siso_algorithm(FSMi.I(),
-                       FSMi.S(),
-                       FSMi.O(),
-                       FSMi.NS(),
-                       FSMi.OS(),
-                       FSMi.PS(),
-                       FSMi.PI(),
-                       blocklength,
-                       STi0,
-                       STiK,
-                       true,
-                       false,
-                       p2mymin,
-                       &(ipriori[0]),
-                       &(iprioro[0]),
-                       &(iposti[0]));
+        siso_kernel(tablesi,
+                    blocklength,
+                    STi0,
+                    STiK,
+                    true,
+                    false,
+                    p2mymin,
+                    &(ipriori[0]),
+                    &(iprioro[0]),
+                    &(iposti[0]));
 
         // interleave soft info inner -> outer
         for (int k = 0; k < blocklength; k++) {
@@ -958,22 +603,16 @@ void sccc_decoder_combined(const fsm& FSMo,
         // run outer SISO
 
         if (rep < iterations - 1) { // do not produce posti
-            siso_algorithm(FSMo.I(),
-                           FSMo.S(),
-                           FSMo.O(),
-                           FSMo.NS(),
-                           FSMo.OS(),
-                           FSMo.PS(),
-                           FSMo.PI(),
-                           blocklength,
-                           STo0,
-                           SToK,
-                           false,
-                           true,
-                           p2mymin,
-                           &(opriori[0]),
-                           &(oprioro[0]),
-                           &(oposto[0]));
+            siso_kernel(tableso,
+                        blocklength,
+                        STo0,
+                        SToK,
+                        false,
+                        true,
+                        p2mymin,
+                        &(opriori[0]),
+                        &(oprioro[0]),
+                        &(oposto[0]));
 
             // interleave soft info outer --> inner
             for (int k = 0; k < blocklength; k++) {
@@ -987,22 +626,16 @@ void sccc_decoder_combined(const fsm& FSMo,
             }
         } else // produce posti but not posto
 
-            siso_algorithm(FSMo.I(),
-                           FSMo.S(),
-                           FSMo.O(),
-                           FSMo.NS(),
-                           FSMo.OS(),
-                           FSMo.PS(),
-                           FSMo.PI(),
-                           blocklength,
-                           STo0,
-                           SToK,
-                           true,
-                           false,
-                           p2mymin,
-                           &(opriori[0]),
-                           &(oprioro[0]),
-                           &(oposti[0]));
+            siso_kernel(tableso,
+                        blocklength,
+                        STo0,
+                        SToK,
+                        true,
+                        false,
+                        p2mymin,
+                        &(opriori[0]),
+                        &(oprioro[0]),
+                        &(oposti[0]));
 
         /*
           viterbi_algorithm(FSMo.I(),FSMo.S(),FSMo.O(),
@@ -1154,6 +787,9 @@ void sccc_decoder(const fsm& FSMo,
                   const float* iprioro,
                   T* data)
 {
+    const trellis_tables tablesi(FSMi);
+    const trellis_tables tableso(FSMo);
+
     // allocate space for priori, and posti of inner FSM
     std::vector<float> ipriori(blocklength * FSMi.I(), 0.0);
     std::vector<float> iposti(blocklength * FSMi.I());
@@ -1166,22 +802,16 @@ void sccc_decoder(const fsm& FSMo,
 
     for (int rep = 0; rep < iterations; rep++) {
         // run inner SISO
-        siso_algorithm(FSMi.I(),
-                       FSMi.S(),
-                       FSMi.O(),
-                       FSMi.NS(),
-                       FSMi.OS(),
-                       FSMi.PS(),
-                       FSMi.PI(),
-                       blocklength,
-                       STi0,
-                       STiK,
-                       true,
-                       false,
-                       p2mymin,
-                       &(ipriori[0]),
-                       &(iprioro[0]),
-                       &(iposti[0]));
+        siso_kernel(tablesi,
+                    blocklength,
+                    STi0,
+                    STiK,
+                    true,
+                    false,
+                    p2mymin,
+                    &(ipriori[0]),
+                    &(iprioro[0]),
+                    &(iposti[0]));
 
         // interleave soft info inner -> outer
         for (int k = 0; k < blocklength; k++) {
@@ -1197,22 +827,16 @@ void sccc_decoder(const fsm& FSMo,
         // run outer SISO
 
         if (rep < iterations - 1) { // do not produce posti
-            siso_algorithm(FSMo.I(),
-                           FSMo.S(),
-                           FSMo.O(),
-                           FSMo.NS(),
-                           FSMo.OS(),
-                           FSMo.PS(),
-                           FSMo.PI(),
-                           blocklength,
-                           STo0,
-                           SToK,
-                           false,
-                           true,
-                           p2mymin,
-                           &(opriori[0]),
-                           &(oprioro[0]),
-                           &(oposto[0]));
+            siso_kernel(tableso,
+                        blocklength,
+                        STo0,
+                        SToK,
+                        false,
+                        true,
+                        p2mymin,
+                        &(opriori[0]),
+                        &(oprioro[0]),
+                        &(oposto[0]));
 
             // interleave soft info outer --> inner
             for (int k = 0; k < blocklength; k++) {
@@ -1225,22 +849,16 @@ void sccc_decoder(const fsm& FSMo,
                        FSMi.I() * sizeof(float));
             }
         } else { // produce posti but not posto
-            siso_algorithm(FSMo.I(),
-                           FSMo.S(),
-                           FSMo.O(),
-                           FSMo.NS(),
-                           FSMo.OS(),
-                           FSMo.PS(),
-                           FSMo.PI(),
-                           blocklength,
-                           STo0,
-                           SToK,
-                           true,
-                           false,
-                           p2mymin,
-                           &(opriori[0]),
-                           &(oprioro[0]),
-                           &(oposti[0]));
+            siso_kernel(tableso,
+                        blocklength,
+                        STo0,
+                        SToK,
+                        true,
+                        false,
+                        p2mymin,
+                        &(opriori[0]),
+                        &(oprioro[0]),
+                        &(oposti[0]));
 
             /*
               viterbi_algorithm(FSMo.I(),FSMo.S(),FSMo.O(),
@@ -1323,6 +941,9 @@ void pccc_decoder(const fsm& FSM1,
                   const float* cprioro,
                   T* data)
 {
+    const trellis_tables tables1(FSM1);
+    const trellis_tables tables2(FSM2);
+
     // allocate space for priori, prioro and posti of FSM1
     std::vector<float> priori1(blocklength * FSM1.I(), 0.0);
     std::vector<float> prioro1(blocklength * FSM1.O());
@@ -1355,22 +976,16 @@ void pccc_decoder(const fsm& FSM1,
 
     for (int rep = 0; rep < iterations; rep++) {
         // run  SISO 1
-        siso_algorithm(FSM1.I(),
-                       FSM1.S(),
-                       FSM1.O(),
-                       FSM1.NS(),
-                       FSM1.OS(),
-                       FSM1.PS(),
-                       FSM1.PI(),
-                       blocklength,
-                       ST10,
-                       ST1K,
-                       true,
-                       false,
-                       p2mymin,
-                       &(priori1[0]),
-                       &(prioro1[0]),
-                       &(posti1[0]));
+        siso_kernel(tables1,
+                    blocklength,
+                    ST10,
+                    ST1K,
+                    true,
+                    false,
+                    p2mymin,
+                    &(priori1[0]),
+                    &(prioro1[0]),
+                    &(posti1[0]));
 
         // for(int k=0;k<blocklength;k++){
         // for(int i=0;i<FSM1.I();i++)
@@ -1390,22 +1005,16 @@ void pccc_decoder(const fsm& FSM1,
         }
 
         // run SISO 2
-        siso_algorithm(FSM2.I(),
-                       FSM2.S(),
-                       FSM2.O(),
-                       FSM2.NS(),
-                       FSM2.OS(),
-                       FSM2.PS(),
-                       FSM2.PI(),
-                       blocklength,
-                       ST20,
-                       ST2K,
-                       true,
-                       false,
-                       p2mymin,
-                       &(priori2[0]),
-                       &(prioro2[0]),
-                       &(posti2[0]));
+        siso_kernel(tables2,
+                    blocklength,
+                    ST20,
+                    ST2K,
+                    true,
+                    false,
+                    p2mymin,
+                    &(priori2[0]),
+                    &(prioro2[0]),
+                    &(posti2[0]));
 
         // interleave soft info 2 --> 1
         for (int k = 0; k < blocklength; k++) {
@@ -1502,6 +1111,9 @@ void pccc_decoder_combined(const fsm& FSM1,
     // allocate space for cprioro
     std::vector<float> cprioro(blocklength * FSM1.O() * FSM2.O(), 0.0);
 
+    const trellis_tables tables1(FSM1);
+    const trellis_tables tables2(FSM2);
+
     // allocate space for priori, prioro and posti of FSM1
     std::vector<float> priori1(blocklength * FSM1.I(), 0.0);
     std::vector<float> prioro1(blocklength * FSM1.O());
@@ -1541,22 +1153,16 @@ void pccc_decoder_combined(const fsm& FSM1,
 
     for (int rep = 0; rep < iterations; rep++) {
         // run  SISO 1
-        siso_algorithm(FSM1.I(),
-                       FSM1.S(),
-                       FSM1.O(),
-                       FSM1.NS(),
-                       FSM1.OS(),
-                       FSM1.PS(),
-                       FSM1.PI(),
-                       blocklength,
-                       ST10,
-                       ST1K,
-                       true,
-                       false,
-                       p2mymin,
-                       &(priori1[0]),
-                       &(prioro1[0]),
-                       &(posti1[0]));
+        siso_kernel(tables1,
+                    blocklength,
+                    ST10,
+                    ST1K,
+                    true,
+                    false,
+                    p2mymin,
+                    &(priori1[0]),
+                    &(prioro1[0]),
+                    &(posti1[0]));
 
         // for(int k=0;k<blocklength;k++){
         // for(int i=0;i<FSM1.I();i++)
@@ -1576,22 +1182,16 @@ void pccc_decoder_combined(const fsm& FSM1,
         }
 
         // run SISO 2
-        siso_algorithm(FSM2.I(),
-                       FSM2.S(),
-                       FSM2.O(),
-                       FSM2.NS(),
-                       FSM2.OS(),
-                       FSM2.PS(),
-                       FSM2.PI(),
-                       blocklength,
-                       ST20,
-                       ST2K,
-                       true,
-                       false,
-                       p2mymin,
-                       &(priori2[0]),
-                       &(prioro2[0]),
-                       &(posti2[0]));
+        siso_kernel(tables2,
+                    blocklength,
+                    ST20,
+                    ST2K,
+                    true,
+                    false,
+                    p2mymin,
+                    &(priori2[0]),
+                    &(prioro2[0]),
+                    &(posti2[0]));
 
         // interleave soft info 2 --> 1
         for (int k = 0; k < blocklength; k++) {
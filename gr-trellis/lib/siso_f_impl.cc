@@ -64,8 +64,9 @@ siso_f_impl::siso_f_impl(
       d_SK(SK),
       d_POSTI(POSTI),
       d_POSTO(POSTO),
-      d_SISO_TYPE(SISO_TYPE) //,
-                             // d_alpha(FSM.S()*(K+1)),
+      d_SISO_TYPE(SISO_TYPE),
+      d_tables(FSM) //,
+                    // d_alpha(FSM.S()*(K+1)),
 // d_beta(FSM.S()*(K+1))
 {
     recalculate();
@@ -75,6 +76,7 @@ void siso_f_impl::set_FSM(const fsm& FSM)
 {
     gr::thread::scoped_lock guard(d_setlock);
     d_FSM = FSM;
+    d_tables = trellis_tables(d_FSM);
     recalculate();
 }
 
@@ -177,24 +179,16 @@ int siso_f_impl::general_work(int noutput_items,
         const float* in2 = (const float*)input_items[2 * m + 1];
         float* out = (float*)output_items[m];
         for (int n = 0; n < nblocks; n++) {
-            siso_algorithm(d_FSM.I(),
-                           d_FSM.S(),
-                           d_FSM.O(),
-                           d_FSM.NS(),
-                           d_FSM.OS(),
-                           d_FSM.PS(),
-                           d_FSM.PI(),
-                           d_K,
-                           d_S0,
-                           d_SK,
-                           d_POSTI,
-                           d_POSTO,
-                           p2min,
-                           &(in1[n * d_K * d_FSM.I()]),
-                           &(in2[n * d_K * d_FSM.O()]),
-                           &(out[n * d_K * multiple]) //,
-                                                      // d_alpha,d_beta
-            );
+            siso_kernel(d_tables,
+                        d_K,
+                        d_S0,
+                        d_SK,
+                        d_POSTI,
+                        d_POSTO,
+                        p2min,
+                        &(in1[n * d_K * d_FSM.I()]),
+                        &(in2[n * d_K * d_FSM.O()]),
+                        &(out[n * d_K * multiple]));
         }
     }
 
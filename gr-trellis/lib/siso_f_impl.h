@@ -12,6 +12,7 @@
 #define INCLUDED_TRELLIS_SISO_F_IMPL_H
 
 #include <gnuradio/trellis/api.h>
+#include "trellis_kernels.h"
 #include <gnuradio/trellis/core_algorithms.h>
 #include <gnuradio/trellis/fsm.h>
 #include <gnuradio/trellis/siso_f.h>
@@ -30,6 +31,7 @@ private:
     bool d_POSTI;
     bool d_POSTO;
     siso_type_t d_SISO_TYPE;
+    trellis_tables d_tables;
     void recalculate();
     // std::vector<float> d_alpha;
     // std::vector<float> d_beta;
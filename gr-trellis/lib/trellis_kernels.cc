@@ -0,0 +1,493 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#include "trellis_kernels.h"
+#include <gnuradio/trellis/core_algorithms.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gr {
+namespace trellis {
+
+namespace {
+
+constexpr float INF = 1.0e9;
+
+// decisions are stored as the index p of the surviving predecessor
+typedef std::uint16_t decision_t;
+
+// limits of the merge depth search
+const int MAX_MERGE = 64;
+const int MAX_MERGE_STATES = 4096;
+
+// number of steps after which every state reaches every state, 0 if none
+int merge_depth(const trellis_tables& t)
+{
+    const int S = t.S;
+    if (S > MAX_MERGE_STATES) {
+        return 0;
+    }
+
+    // reach[s * words + w]: bit set of the states reachable from s in d steps
+    const int words = (S + 63) / 64;
+    std::vector<std::uint64_t> reach(static_cast<size_t>(S) * words, 0);
+    std::vector<std::uint64_t> next(reach.size());
+    for (int i = 0; i < t.I; i++) {
+        for (int s = 0; s < S; s++) {
+            const int n = t.ns[i * S + s];
+            reach[s * words + n / 64] |= std::uint64_t(1) << (n % 64);
+        }
+    }
+
+    for (int d = 1; d <= MAX_MERGE; d++) {
+        bool all = true;
+        for (int s = 0; all && s < S; s++) {
+            for (int n = 0; all && n < S; n++) {
+                all = (reach[s * words + n / 64] >> (n % 64)) & 1;
+            }
+        }
+        if (all) {
+            return d;
+        }
+
+        // reachable in d + 1 steps: reachable in d steps from a successor
+        std::fill(next.begin(), next.end(), 0);
+        for (int s = 0; s < S; s++) {
+            for (int i = 0; i < t.I; i++) {
+                const std::uint64_t* r = &reach[t.ns[i * S + s] * words];
+                for (int w = 0; w < words; w++) {
+                    next[s * words + w] |= r[w];
+                }
+            }
+        }
+        reach.swap(next);
+    }
+    return 0;
+}
+
+trellis_tables build_tables(int I,
+                            int S,
+                            int O,
+                            const std::vector<int>& NS,
+                            const std::vector<int>& OS,
+                            const std::vector<std::vector<int>>& PS,
+                            const std::vector<std::vector<int>>& PI)
+{
+    trellis_tables t;
+    t.I = I;
+    t.S = S;
+    t.O = O;
+    t.P = 0;
+    for (int j = 0; j < S; j++) {
+        t.P = std::max(t.P, static_cast<int>(PS[j].size()));
+    }
+    if (t.P > std::numeric_limits<decision_t>::max()) {
+        throw std::runtime_error("trellis_tables: too many predecessors per state");
+    }
+
+    t.ps.resize(t.P * S);
+    t.pi.resize(t.P * S);
+    t.po.resize(t.P * S);
+    t.pvalid.resize(t.P * S);
+    for (int p = 0; p < t.P; p++) {
+        for (int j = 0; j < S; j++) {
+            const size_t idx = p * S + j;
+            const bool valid = p < static_cast<int>(PS[j].size());
+            const int q = valid ? p : 0;
+            if (PS[j].empty()) {
+                t.ps[idx] = 0;
+                t.pi[idx] = 0;
+                t.po[idx] = 0;
+            } else {
+                t.ps[idx] = PS[j][q];
+                t.pi[idx] = PI[j][q];
+                t.po[idx] = OS[PS[j][q] * I + PI[j][q]];
+            }
+            t.pvalid[idx] = valid;
+        }
+    }
+
+    t.ns.resize(I * S);
+    t.os.resize(I * S);
+    for (int i = 0; i < I; i++) {
+        for (int j = 0; j < S; j++) {
+            t.ns[i * S + j] = NS[j * I + i];
+            t.os[i * S + j] = OS[j * I + i];
+        }
+    }
+    t.merge = merge_depth(t);
+    return t;
+}
+
+/*
+ * Path metric arithmetic. Integer metrics saturate at their maximum, which doubles as
+ * "infinity"; path metrics are renormalized to a minimum of 0 every step and branch
+ * metrics are non-negative, so the lower end never needs clamping.
+ */
+template <class M>
+struct metric_traits {
+    static constexpr M inf() { return std::numeric_limits<M>::max(); }
+    typedef typename std::conditional<(sizeof(M) < 4), int, std::int64_t>::type wide_t;
+    static M add(M a, M b)
+    {
+        const wide_t s = static_cast<wide_t>(a) + b;
+        return static_cast<M>(std::min<wide_t>(s, inf()));
+    }
+};
+
+template <>
+struct metric_traits<float> {
+    static constexpr float inf() { return INF; }
+    static float add(float a, float b) { return a + b; }
+};
+
+// one add-compare-select step over all states
+template <class M>
+void acs(const trellis_tables& t,
+         const M* alpha,
+         const M* bm,
+         M* next,
+         decision_t* decision)
+{
+    typedef metric_traits<M> tr;
+    const int S = t.S;
+
+    std::fill(next, next + S, tr::inf());
+    std::fill(decision, decision + S, 0);
+    for (int p = 0; p < t.P; p++) {
+        const int* ps = &t.ps[p * S];
+        const int* po = &t.po[p * S];
+        const unsigned char* valid = &t.pvalid[p * S];
+        for (int j = 0; j < S; j++) {
+            const M cand = valid[j] ? tr::add(alpha[ps[j]], bm[po[j]]) : tr::inf();
+            const bool better = cand < next[j];
+            next[j] = better ? cand : next[j];
+            decision[j] = better ? static_cast<decision_t>(p) : decision[j];
+        }
+    }
+
+    // normalize total metrics so they do not explode; integer metrics stay at
+    // "infinity" for the states that cannot be reached yet
+    const M norm = *std::min_element(next, next + S);
+    for (int j = 0; j < S; j++) {
+        if (std::is_same<M, float>::value || next[j] != tr::inf()) {
+            next[j] -= norm;
+        }
+    }
+}
+
+// quantize the branch metrics of one step for integer path metrics
+template <class M>
+void quantize_metrics(const float* in, int O, float scale, M* bm)
+{
+    const float offset = *std::min_element(in, in + O);
+    const double top = metric_traits<M>::inf();
+    for (int o = 0; o < O; o++) {
+        const double q = std::nearbyint((in[o] - offset) * scale);
+        bm[o] = static_cast<M>(std::min(q, top));
+    }
+}
+
+template <class T>
+int traceback(const trellis_tables& t,
+              const std::vector<decision_t>& decisions,
+              int rows,
+              int from,
+              int to,
+              int st,
+              T* out)
+{
+    const int S = t.S;
+    for (int m = from; m >= to; m--) {
+        const int p = decisions[(m % rows) * S + st];
+        if (out) {
+            out[m] = static_cast<T>(t.pi[p * S + st]);
+        }
+        st = t.ps[p * S + st];
+    }
+    return st;
+}
+
+struct min_op {
+    float operator()(float a, float b) const { return a <= b ? a : b; }
+};
+
+struct min_star_op {
+    float operator()(float a, float b) const
+    {
+        return (a <= b ? a : b) - std::log(1 + std::exp(a <= b ? a - b : b - a));
+    }
+};
+
+struct pointer_op {
+    float (*f)(float, float);
+    float operator()(float a, float b) const { return f(a, b); }
+};
+
+template <class OP>
+void siso_impl(const trellis_tables& t,
+               int K,
+               int S0,
+               int SK,
+               bool POSTI,
+               bool POSTO,
+               OP op,
+               const float* priori,
+               const float* prioro,
+               float* post)
+{
+    const int I = t.I;
+    const int S = t.S;
+    const int O = t.O;
+    std::vector<float> alpha(S * (K + 1));
+    std::vector<float> beta(S * (K + 1));
+
+    if (S0 < 0) { // initial state not specified
+        std::fill(alpha.begin(), alpha.begin() + S, 0.0f);
+    } else {
+        std::fill(alpha.begin(), alpha.begin() + S, INF);
+        alpha[S0] = 0.0;
+    }
+
+    for (int k = 0; k < K; k++) { // forward recursion
+        const float* a = &alpha[k * S];
+        float* next = &alpha[(k + 1) * S];
+        std::fill(next, next + S, INF);
+        for (int p = 0; p < t.P; p++) {
+            const int* ps = &t.ps[p * S];
+            const int* pi = &t.pi[p * S];
+            const int* po = &t.po[p * S];
+            const unsigned char* valid = &t.pvalid[p * S];
+            for (int j = 0; j < S; j++) {
+                const float mm = valid[j] ? a[ps[j]] + priori[k * I + pi[j]] +
+                                                prioro[k * O + po[j]]
+                                          : INF;
+                next[j] = op(next[j], mm);
+            }
+        }
+        const float norm = *std::min_element(next, next + S);
+        for (int j = 0; j < S; j++) {
+            next[j] -= norm; // normalize total metrics so they do not explode
+        }
+    }
+
+    if (SK < 0) { // final state not specified
+        std::fill(beta.begin() + K * S, beta.end(), 0.0f);
+    } else {
+        std::fill(beta.begin() + K * S, beta.end(), INF);
+        beta[K * S + SK] = 0.0;
+    }
+
+    for (int k = K - 1; k >= 0; k--) { // backward recursion
+        const float* b = &beta[(k + 1) * S];
+        float* prev = &beta[k * S];
+        std::fill(prev, prev + S, INF);
+        for (int i = 0; i < I; i++) {
+            const int* ns = &t.ns[i * S];
+            const int* os = &t.os[i * S];
+            const float pri = priori[k * I + i];
+            for (int j = 0; j < S; j++) {
+                prev[j] = op(prev[j], b[ns[j]] + pri + prioro[k * O + os[j]]);
+            }
+        }
+        const float norm = *std::min_element(prev, prev + S);
+        for (int j = 0; j < S; j++) {
+            prev[j] -= norm; // normalize total metrics so they do not explode
+        }
+    }
+
+    const int stride = (POSTI ? I : 0) + (POSTO ? O : 0);
+    std::vector<float> acc(std::max(I, O));
+    for (int k = 0; k < K; k++) {
+        const float* a = &alpha[k * S];
+        const float* b = &beta[(k + 1) * S];
+        if (POSTI) { // input combining
+            float* po = &post[k * stride];
+            for (int i = 0; i < I; i++) {
+                const int* ns = &t.ns[i * S];
+                const int* os = &t.os[i * S];
+                float minm = INF;
+                for (int j = 0; j < S; j++) {
+                    minm = op(minm, a[j] + prioro[k * O + os[j]] + b[ns[j]]);
+                }
+                po[i] = minm;
+            }
+            const float norm = *std::min_element(po, po + I);
+            for (int i = 0; i < I; i++) {
+                po[i] -= norm; // normalize metrics
+            }
+        }
+        if (POSTO) { // output combining, scattered over the transitions
+            float* po = &post[k * stride + (POSTI ? I : 0)];
+            std::fill(acc.begin(), acc.begin() + O, INF);
+            for (int j = 0; j < S; j++) {
+                for (int i = 0; i < I; i++) {
+                    const int n = t.os[i * S + j];
+                    acc[n] = op(acc[n], a[j] + priori[k * I + i] + b[t.ns[i * S + j]]);
+                }
+            }
+            const float norm = *std::min_element(acc.begin(), acc.begin() + O);
+            for (int n = 0; n < O; n++) {
+                po[n] = acc[n] - norm; // normalize metrics
+            }
+        }
+    }
+}
+
+} // namespace
+
+trellis_tables::trellis_tables(const fsm& FSM)
+    : trellis_tables(FSM.I(), FSM.S(), FSM.O(), FSM.NS(), FSM.OS(), FSM.PS(), FSM.PI())
+{
+}
+
+trellis_tables::trellis_tables(int I,
+                               int S,
+                               int O,
+                               const std::vector<int>& NS,
+                               const std::vector<int>& OS,
+                               const std::vector<std::vector<int>>& PS,
+                               const std::vector<std::vector<int>>& PI)
+{
+    *this = build_tables(I, S, O, NS, OS, PS, PI);
+}
+
+template <class M, class T>
+void viterbi_kernel(const trellis_tables& t,
+                    int K,
+                    int S0,
+                    int SK,
+                    const float* in,
+                    T* out,
+                    int traceback_depth,
+                    float scale)
+{
+    typedef metric_traits<M> tr;
+    const int S = t.S;
+    const int O = t.O;
+    const int depth =
+        (traceback_depth > 0 && 2 * traceback_depth < K) ? traceback_depth : 0;
+    const int rows = depth ? 2 * depth : K;
+
+    std::vector<decision_t> decisions(static_cast<size_t>(rows) * S);
+    std::vector<M> alpha(S), next(S);
+    std::vector<M> bm(std::is_same<M, float>::value ? 0 : O);
+
+    if (S0 < 0) { // initial state not specified
+        std::fill(alpha.begin(), alpha.end(), M(0));
+    } else {
+        std::fill(alpha.begin(), alpha.end(), tr::inf());
+        alpha[S0] = 0;
+    }
+
+    int released = 0; // number of symbols written to out
+    for (int k = 0; k < K; k++) {
+        const M* metrics;
+        if constexpr (std::is_same<M, float>::value) {
+            metrics = &in[k * O];
+        } else {
+            quantize_metrics(&in[k * O], O, scale, bm.data());
+            metrics = bm.data();
+        }
+        acs(t, alpha.data(), metrics, next.data(), &decisions[(k % rows) * S]);
+        alpha.swap(next);
+
+        if (depth && k + 1 - released == rows) {
+            // follow the best survivor back for depth steps, where it has merged
+            // with all others, then release the depth steps before that
+            int st = std::min_element(alpha.begin(), alpha.end()) - alpha.begin();
+            st = traceback<T>(t, decisions, rows, k, k - depth + 1, st, nullptr);
+            traceback(t, decisions, rows, k - depth, released, st, out);
+            released = k - depth + 1;
+        }
+    }
+
+    int st = SK;
+    if (SK < 0) { // final state not specified
+        st = std::min_element(alpha.begin(), alpha.end()) - alpha.begin();
+    }
+    traceback(t, decisions, rows, K - 1, released, st, out);
+}
+
+template <class M>
+float metric_scale(const trellis_tables& t, int K, const float* in)
+{
+    if (t.merge == 0) {
+        return 0.0f;
+    }
+
+    // after merge steps every path metric is within merge branch metrics of the
+    // best one, and one more branch metric is added before the comparison
+    const float top =
+        std::floor(static_cast<float>(metric_traits<M>::inf()) / (t.merge + 1));
+    float spread = 0.0f;
+    for (int k = 0; k < K; k++) {
+        const auto mm = std::minmax_element(&in[k * t.O], &in[(k + 1) * t.O]);
+        spread = std::max(spread, *mm.second - *mm.first);
+    }
+    return spread > 0.0f ? top / spread : 1.0f;
+}
+
+void siso_kernel(const trellis_tables& tables,
+                 int K,
+                 int S0,
+                 int SK,
+                 bool POSTI,
+                 bool POSTO,
+                 float (*p2mymin)(float, float),
+                 const float* priori,
+                 const float* prioro,
+                 float* post)
+{
+    if (!POSTI && !POSTO) {
+        throw std::runtime_error("Not both POSTI and POSTO can be false.");
+    }
+    if (p2mymin == &min) {
+        siso_impl(tables, K, S0, SK, POSTI, POSTO, min_op(), priori, prioro, post);
+    } else if (p2mymin == &min_star) {
+        siso_impl(tables, K, S0, SK, POSTI, POSTO, min_star_op(), priori, prioro, post);
+    } else {
+        siso_impl(
+            tables, K, S0, SK, POSTI, POSTO, pointer_op{ p2mymin }, priori, prioro, post);
+    }
+}
+
+#define VITERBI_KERNEL(M, T)                                            \
+    template void viterbi_kernel<M, T>(const trellis_tables& tables,    \
+                                       int K,                           \
+                                       int S0,                          \
+                                       int SK,                          \
+                                       const float* in,                 \
+                                       T* out,                          \
+                                       int traceback_depth,             \
+                                       float scale);
+
+VITERBI_KERNEL(float, std::uint8_t)
+VITERBI_KERNEL(float, std::int16_t)
+VITERBI_KERNEL(float, std::int32_t)
+VITERBI_KERNEL(std::int32_t, std::uint8_t)
+VITERBI_KERNEL(std::int32_t, std::int16_t)
+VITERBI_KERNEL(std::int32_t, std::int32_t)
+VITERBI_KERNEL(std::int16_t, std::uint8_t)
+VITERBI_KERNEL(std::int16_t, std::int16_t)
+VITERBI_KERNEL(std::int16_t, std::int32_t)
+VITERBI_KERNEL(std::int8_t, std::uint8_t)
+VITERBI_KERNEL(std::int8_t, std::int16_t)
+VITERBI_KERNEL(std::int8_t, std::int32_t)
+
+template float metric_scale<std::int32_t>(const trellis_tables&, int, const float*);
+template float metric_scale<std::int16_t>(const trellis_tables&, int, const float*);
+template float metric_scale<std::int8_t>(const trellis_tables&, int, const float*);
+
+} /* namespace trellis */
+} /* namespace gr */
@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+#ifndef INCLUDED_TRELLIS_TRELLIS_KERNELS_H
+#define INCLUDED_TRELLIS_TRELLIS_KERNELS_H
+
+#include <gnuradio/trellis/fsm.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace trellis {
+
+/*!
+ * \brief Flattened, structure-of-arrays form of an FSM for the decoding kernels.
+ *
+ * Predecessor tables: transition p (0 <= p < P) into state j is stored at p * S + j,
+ * P being the largest number of predecessors of any state. States with fewer
+ * predecessors are padded with copies of their first transition, flagged in pvalid.
+ * Successor tables: the transition leaving state j with input i is stored at i * S + j.
+ * With this layout the add-compare-select loops run over all states with unit stride.
+ *
+ * merge is the number of steps after which every state can be reached from every
+ * state, which bounds the spread of the path metrics; 0 if there is no such number,
+ * or it is not found within 64 steps, or there are more than 4096 states.
+ */
+struct trellis_tables {
+    int I;
+    int S;
+    int O;
+    int P;
+    int merge;
+
+    std::vector<int> ps;               // predecessor state
+    std::vector<int> pi;               // input symbol of the transition
+    std::vector<int> po;               // output symbol of the transition
+    std::vector<unsigned char> pvalid; // 0 for padding entries
+
+    std::vector<int> ns; // next state
+    std::vector<int> os; // output symbol
+
+    trellis_tables() : I(0), S(0), O(0), P(0), merge(0) {}
+    explicit trellis_tables(const fsm& FSM);
+    trellis_tables(int I,
+                   int S,
+                   int O,
+                   const std::vector<int>& NS,
+                   const std::vector<int>& OS,
+                   const std::vector<std::vector<int>>& PS,
+                   const std::vector<std::vector<int>>& PI);
+};
+
+/*!
+ * \brief Viterbi decoder on precompiled tables.
+ *
+ * \param T       trellis tables
+ * \param K       number of trellis steps
+ * \param S0      initial state, or -1 if unknown
+ * \param SK      final state, or -1 if unknown
+ * \param in      K * O branch metrics (smaller is better)
+ * \param out     K decoded input symbols
+ * \param traceback_depth  0 traces back once over the whole block. Otherwise decisions
+ *                are kept for 2 * traceback_depth steps only, and symbols are released
+ *                traceback_depth steps behind the best survivor. Windowed traceback
+ *                is approximate: it may decide differently from the full traceback
+ *                when survivors have not merged within traceback_depth steps.
+ * \param scale   quantization step inverse for integer metric types; the branch metrics
+ *                of every step are offset to a minimum of 0, multiplied by scale and
+ *                saturated to the range of M. Ignored for float.
+ *
+ * M is the path metric type: float, or std::int32_t, std::int16_t or std::int8_t for
+ * saturating fixed point metrics, which pack 2, 4 or 8 times as many states into a
+ * vector register as float does. Path metrics are renormalized to a minimum of 0
+ * every step.
+ */
+template <class M, class T>
+void viterbi_kernel(const trellis_tables& tables,
+                    int K,
+                    int S0,
+                    int SK,
+                    const float* in,
+                    T* out,
+                    int traceback_depth = 0,
+                    float scale = 1.0f);
+
+/*!
+ * \brief Largest scale for viterbi_kernel<M> with which the path metrics of the K
+ * steps of branch metrics \p in cannot saturate.
+ *
+ * Branch metrics are quantized to at most max(M) / (merge + 1), so the renormalized
+ * path metrics stay below max(M). Returns 0 if tables.merge is 0, in which case the
+ * tables need float metrics.
+ */
+template <class M>
+float metric_scale(const trellis_tables& tables, int K, const float* in);
+
+/*!
+ * \brief SISO (forward-backward) algorithm on precompiled tables.
+ *
+ * Same interface and results as siso_algorithm(). min() and min_star() are
+ * recognized and inlined into the recursions; any other p2mymin is called through
+ * the pointer.
+ */
+void siso_kernel(const trellis_tables& tables,
+                 int K,
+                 int S0,
+                 int SK,
+                 bool POSTI,
+                 bool POSTO,
+                 float (*p2mymin)(float, float),
+                 const float* priori,
+                 const float* prioro,
+                 float* post);
+
+} /* namespace trellis */
+} /* namespace gr */
+
+#endif /* INCLUDED_TRELLIS_TRELLIS_KERNELS_H */
@@ -14,6 +14,7 @@
 
 #include "viterbi_combined_impl.h"
 #include <gnuradio/io_signature.h>
+#include <stdexcept>
 
 namespace gr {
 namespace trellis {
@@ -50,8 +51,11 @@ viterbi_combined_impl<IN_T, OUT_T>::viterbi_combined_impl(
       d_SK(SK),
       d_D(D),
       d_TABLE(TABLE),
-      d_TYPE(TYPE) //,
-                   // d_trace(FSM.S()*K)
+      d_TYPE(TYPE),
+      d_tables(FSM),
+      d_traceback_depth(0),
+      d_metric_bits(0) //,
+      // d_trace(FSM.S()*K)
 {
     this->set_relative_rate(1, (uint64_t)d_D);
     this->set_output_multiple(d_K);
@@ -78,6 +82,59 @@ void viterbi_combined_impl<IN_T, OUT_T>::set_FSM(const fsm& FSM)
 {
     gr::thread::scoped_lock guard(this->d_setlock);
     d_FSM = FSM;
+    d_tables = trellis_tables(d_FSM);
+}
+
+template <class IN_T, class OUT_T>
+void viterbi_combined_impl<IN_T, OUT_T>::set_traceback_depth(int depth)
+{
+    if (depth < 0) {
+        throw std::invalid_argument("viterbi_combined: traceback depth must be >= 0");
+    }
+    gr::thread::scoped_lock guard(this->d_setlock);
+    d_traceback_depth = depth;
+}
+
+template <class IN_T, class OUT_T>
+void viterbi_combined_impl<IN_T, OUT_T>::set_metric_bits(int bits)
+{
+    if (bits != 0 && bits != 8 && bits != 16 && bits != 32) {
+        throw std::invalid_argument(
+            "viterbi_combined: metric bits must be 0, 8, 16 or 32");
+    }
+    gr::thread::scoped_lock guard(this->d_setlock);
+    d_metric_bits = bits;
+}
+
+template <class IN_T, class OUT_T>
+void viterbi_combined_impl<IN_T, OUT_T>::decode(const float* metric, OUT_T* out)
+{
+    // fixed point metrics need the scale of the block; 0 if the FSM needs float
+    float scale = 0.0f;
+    switch (d_metric_bits) {
+    case 32:
+        scale = metric_scale<std::int32_t>(d_tables, d_K, metric);
+        break;
+    case 16:
+        scale = metric_scale<std::int16_t>(d_tables, d_K, metric);
+        break;
+    case 8:
+        scale = metric_scale<std::int8_t>(d_tables, d_K, metric);
+        break;
+    }
+
+    if (scale == 0.0f) {
+        viterbi_kernel<float>(d_tables, d_K, d_S0, d_SK, metric, out, d_traceback_depth);
+    } else if (d_metric_bits == 32) {
+        viterbi_kernel<std::int32_t>(
+            d_tables, d_K, d_S0, d_SK, metric, out, d_traceback_depth, scale);
+    } else if (d_metric_bits == 16) {
+        viterbi_kernel<std::int16_t>(
+            d_tables, d_K, d_S0, d_SK, metric, out, d_traceback_depth, scale);
+    } else {
+        viterbi_kernel<std::int8_t>(
+            d_tables, d_K, d_S0, d_SK, metric, out, d_traceback_depth, scale);
+    }
 }
 
 template <class IN_T, class OUT_T>
@@ -134,27 +191,19 @@ int viterbi_combined_impl<IN_T, OUT_T>::general_work(
     gr::thread::scoped_lock guard(this->d_setlock);
     int nstreams = input_items.size();
     int nblocks = noutput_items / d_K;
+    const int O = d_FSM.O();
+    d_metric.resize(d_K * O);
 
     for (int m = 0; m < nstreams; m++) {
         const IN_T* in = (const IN_T*)input_items[m];
         OUT_T* out = (OUT_T*)output_items[m];
 
         for (int n = 0; n < nblocks; n++) {
-            viterbi_algorithm_combined(d_FSM.I(),
-                                       d_FSM.S(),
-                                       d_FSM.O(),
-                                       d_FSM.NS(),
-                                       d_FSM.OS(),
-                                       d_FSM.PS(),
-                                       d_FSM.PI(),
-                                       d_K,
-                                       d_S0,
-                                       d_SK,
-                                       d_D,
-                                       d_TABLE,
-                                       d_TYPE,
-                                       &(in[n * d_K * d_D]),
-                                       &(out[n * d_K]));
+            const IN_T* blk = &(in[n * d_K * d_D]);
+            for (int k = 0; k < d_K; k++) {
+                calc_metric(O, d_D, d_TABLE, &(blk[k * d_D]), &(d_metric[k * O]), d_TYPE);
+            }
+            decode(d_metric.data(), &(out[n * d_K]));
         }
     }
 
@@ -11,6 +11,7 @@
 #ifndef VITERBI_COMBINED_IMPL_H
 #define VITERBI_COMBINED_IMPL_H
 
+#include "trellis_kernels.h"
 #include <gnuradio/trellis/viterbi_combined.h>
 
 namespace gr {
@@ -27,8 +28,14 @@ private:
     int d_D;
     std::vector<IN_T> d_TABLE;
     digital::trellis_metric_type_t d_TYPE;
+    trellis_tables d_tables;
+    int d_traceback_depth;
+    int d_metric_bits;
+    std::vector<float> d_metric;
     // std::vector<int> d_trace;
 
+    void decode(const float* metric, OUT_T* out);
+
 public:
     viterbi_combined_impl(const fsm& FSM,
                           int K,
@@ -46,6 +53,8 @@ public:
     int D() const override { return d_D; }
     std::vector<IN_T> TABLE() const override { return d_TABLE; }
     digital::trellis_metric_type_t TYPE() const override { return d_TYPE; }
+    int traceback_depth() const override { return d_traceback_depth; }
+    int metric_bits() const override { return d_metric_bits; }
     // std::vector<int> trace() const { return d_trace; }
 
     void set_FSM(const fsm& FSM) override;
@@ -55,6 +64,8 @@ public:
     void set_D(int D) override;
     void set_TABLE(const std::vector<IN_T>& table) override;
     void set_TYPE(digital::trellis_metric_type_t type) override;
+    void set_traceback_depth(int depth) override;
+    void set_metric_bits(int bits) override;
 
     void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
 
@@ -15,6 +15,7 @@
 
 #include "viterbi_impl.h"
 #include <gnuradio/io_signature.h>
+#include <stdexcept>
 
 namespace gr {
 namespace trellis {
@@ -33,8 +34,10 @@ viterbi_impl<T>::viterbi_impl(const fsm& FSM, int K, int S0, int SK)
       d_FSM(FSM),
       d_K(K),
       d_S0(S0),
-      d_SK(SK) //,
-               // d_trace(FSM.S()*K)
+      d_SK(SK),
+      d_tables(FSM),
+      d_traceback_depth(0) //,
+      // d_trace(FSM.S()*K)
 {
     this->set_relative_rate(1, (uint64_t)d_FSM.O());
     this->set_output_multiple(d_K);
@@ -45,6 +48,7 @@ void viterbi_impl<T>::set_FSM(const fsm& FSM)
 {
     gr::thread::scoped_lock guard(this->d_setlock);
     d_FSM = FSM;
+    d_tables = trellis_tables(d_FSM);
     this->set_relative_rate(1, (uint64_t)d_FSM.O());
 }
 
@@ -70,6 +74,16 @@ void viterbi_impl<T>::set_SK(int SK)
     d_SK = SK;
 }
 
+template <class T>
+void viterbi_impl<T>::set_traceback_depth(int depth)
+{
+    if (depth < 0) {
+        throw std::invalid_argument("viterbi: traceback depth must be >= 0");
+    }
+    gr::thread::scoped_lock guard(this->d_setlock);
+    d_traceback_depth = depth;
+}
+
 template <class T>
 viterbi_impl<T>::~viterbi_impl()
 {
@@ -100,18 +114,13 @@ int viterbi_impl<T>::general_work(int noutput_items,
         T* out = (T*)output_items[m];
 
         for (int n = 0; n < nblocks; n++) {
-            viterbi_algorithm(d_FSM.I(),
-                              d_FSM.S(),
-                              d_FSM.O(),
-                              d_FSM.NS(),
-                              d_FSM.OS(),
-                              d_FSM.PS(),
-                              d_FSM.PI(),
-                              d_K,
-                              d_S0,
-                              d_SK,
-                              &(in[n * d_K * d_FSM.O()]),
-                              &(out[n * d_K]));
+            viterbi_kernel<float>(d_tables,
+                                  d_K,
+                                  d_S0,
+                                  d_SK,
+                                  &(in[n * d_K * d_FSM.O()]),
+                                  &(out[n * d_K]),
+                                  d_traceback_depth);
         }
     }
 
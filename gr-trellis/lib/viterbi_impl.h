@@ -12,6 +12,7 @@
 #ifndef VITERBI_IMPL_H
 #define VITERBI_IMPL_H
 
+#include "trellis_kernels.h"
 #include <gnuradio/trellis/viterbi.h>
 
 namespace gr {
@@ -25,6 +26,8 @@ private:
     int d_K;
     int d_S0;
     int d_SK;
+    trellis_tables d_tables;
+    int d_traceback_depth;
     // std::vector<int> d_trace;
 
 public:
@@ -35,11 +38,13 @@ public:
     int K() const override { return d_K; }
     int S0() const override { return d_S0; }
     int SK() const override { return d_SK; }
+    int traceback_depth() const override { return d_traceback_depth; }
 
     void set_FSM(const fsm& FSM) override;
     void set_K(int K) override;
     void set_S0(int S0) override;
     void set_SK(int SK) override;
+    void set_traceback_depth(int depth) override;
     // std::vector<int> trace () const { return d_trace; }
 
     void forecast(int noutput_items, gr_vector_int& ninput_items_required) override;
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(viterbi_combined.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(42e9e8a3daa4ef03ff9d7110e4c37a62)                     */
+/* BINDTOOL_HEADER_FILE_HASH(d047fd39c714b3c10faaa503a365f229)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -55,7 +55,13 @@ void bind_viterbi_combined_template(py::module& m, const char* classname)
         .def("set_SK", &viterbi_combined::set_SK)
         .def("set_D", &viterbi_combined::set_D)
         .def("set_TABLE", &viterbi_combined::set_TABLE)
-        .def("set_TYPE", &viterbi_combined::set_TYPE);
+        .def("set_TYPE", &viterbi_combined::set_TYPE)
+        .def("traceback_depth", &viterbi_combined::traceback_depth)
+        .def("set_traceback_depth",
+             &viterbi_combined::set_traceback_depth,
+             py::arg("depth"))
+        .def("metric_bits", &viterbi_combined::metric_bits)
+        .def("set_metric_bits", &viterbi_combined::set_metric_bits, py::arg("bits"));
 }
 
 void bind_viterbi_combined(py::module& m)
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(viterbi.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(3dddfa88ff00d9ca651bb0b942244465)                     */
+/* BINDTOOL_HEADER_FILE_HASH(44d287377253007d90d9e0d8669fae24)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -46,7 +46,9 @@ void bind_viterbi_template(py::module& m, const char* classname)
         .def("set_FSM", &viterbi::set_FSM)
         .def("set_K", &viterbi::set_K)
         .def("set_S0", &viterbi::set_S0)
-        .def("set_SK", &viterbi::set_SK);
+        .def("set_SK", &viterbi::set_SK)
+        .def("traceback_depth", &viterbi::traceback_depth)
+        .def("set_traceback_depth", &viterbi::set_traceback_depth, py::arg("depth"));
 }
 
 void bind_viterbi(py::module& m)
@@ -11,6 +11,7 @@
 
 import math
 import os
+import random
 
 from gnuradio import gr, gr_unittest, trellis, digital, analog, blocks
 
@@ -79,6 +80,93 @@ class test_trellis (gr_unittest.TestCase):
             tb = trellis_comb_tb(ftype)
             tb.run()
 
+    def test_002_viterbi_traceback_depth(self):
+        """
+        Windowed traceback decodes a noisy stream the same way as the
+        full traceback, once the window is many constraint lengths.
+        """
+        f = trellis.fsm(*fsm_args["awgn1o2_4"])
+        constellation = constells[f.O()]
+        K = 4096
+        src = blocks.vector_source_s(
+            [(i * 7 + i // 5) % 2 for i in range(4 * K)])
+        enc = trellis.encoder_ss(f, 0)
+        mod = digital.chunks_to_symbols_sc(constellation.points(), 1)
+        add = blocks.add_cc()
+        noise = analog.noise_source_c(
+            analog.noise_type_t.GR_GAUSSIAN, math.sqrt(0.25 / 2), 42)
+        noise_head = blocks.head(gr.sizeof_gr_complex, 4 * K)
+        metrics = trellis.constellation_metrics_cf(
+            constellation.base(), digital.TRELLIS_EUCLIDEAN)
+        full = trellis.viterbi_s(f, K, 0, -1)
+        windowed = trellis.viterbi_s(f, K, 0, -1)
+        self.assertEqual(windowed.traceback_depth(), 0)
+        windowed.set_traceback_depth(32)
+        self.assertEqual(windowed.traceback_depth(), 32)
+        self.assertRaises(ValueError, windowed.set_traceback_depth, -1)
+        full_dst = blocks.vector_sink_s()
+        windowed_dst = blocks.vector_sink_s()
+
+        tb = gr.top_block()
+        tb.connect(src, enc, mod, (add, 0))
+        tb.connect(noise, noise_head, (add, 1))
+        tb.connect(add, metrics)
+        tb.connect(metrics, full, full_dst)
+        tb.connect(metrics, windowed, windowed_dst)
+        tb.run()
+
+        self.assertEqual(len(full_dst.data()), 4 * K)
+        self.assertEqual(full_dst.data(), windowed_dst.data())
+
+    def test_002_viterbi_combined_traceback_depth(self):
+        vbc = trellis.viterbi_combined_fb(
+            trellis.fsm(*fsm_args["awgn1o2_4"]), 100, 0, -1, 1,
+            [-1, 1, 1, -1], digital.TRELLIS_EUCLIDEAN)
+        self.assertEqual(vbc.traceback_depth(), 0)
+        vbc.set_traceback_depth(20)
+        self.assertEqual(vbc.traceback_depth(), 20)
+        self.assertRaises(ValueError, vbc.set_traceback_depth, -1)
+
+    def test_003_viterbi_combined_metric_bits(self):
+        """
+        Fixed point path metrics decode a noisy stream like float metrics:
+        16 and 32 bit ones exactly, 8 bit ones up to a few near ties.
+        """
+        f = trellis.fsm(*fsm_args["awgn1o2_4"])
+        table = [-1 - 1j, -1 + 1j, 1 - 1j, 1 + 1j]
+        K = 1000
+        rng = random.Random(6)
+        src = blocks.vector_source_s(
+            [(i * 7 + i // 5) % 2 for i in range(4 * K)])
+        enc = trellis.encoder_ss(f, 0)
+        mod = digital.chunks_to_symbols_sc(table, 1)
+        add = blocks.add_cc()
+        noise = blocks.vector_source_c(
+            [complex(rng.gauss(0, 0.7), rng.gauss(0, 0.7)) for i in range(4 * K)])
+
+        tb = gr.top_block()
+        tb.connect(src, enc, mod, (add, 0))
+        tb.connect(noise, (add, 1))
+        dsts = {}
+        for bits in [0, 32, 16, 8]:
+            vbc = trellis.viterbi_combined_cb(
+                f, K, 0, -1, 1, table, digital.TRELLIS_EUCLIDEAN)
+            self.assertEqual(vbc.metric_bits(), 0)
+            vbc.set_metric_bits(bits)
+            self.assertEqual(vbc.metric_bits(), bits)
+            dsts[bits] = blocks.vector_sink_b()
+            tb.connect(add, vbc, dsts[bits])
+        self.assertRaises(ValueError, vbc.set_metric_bits, 12)
+        tb.run()
+
+        reference = dsts[0].data()
+        self.assertEqual(len(reference), 4 * K)
+        self.assertEqual(dsts[32].data(), reference)
+        self.assertEqual(dsts[16].data(), reference)
+        differences = sum(
+            a != b for a, b in zip(dsts[8].data(), reference))
+        self.assertLess(differences, 4 * K // 100)
+
     def test_001_pccc_encoder(self):
         ftypes = ["bb", "bs", "bi", "ss", "si", "ii"]
         for ftype in ftypes: